@@ -1,5 +1,6 @@
 #include "pch.h" // 프로젝트의 Precompiled Header
 #include "Source/Component/Mesh/Public/StaticMesh.h" // UStaticMesh 클래스 자신의 헤더
+#include "Core/Public/Archive.h"
 
 // FStaticMesh 구조체에 대한 정의가 UStaticMesh.h에 이미 포함되어 있다고 가정합니다.
 
@@ -42,34 +43,22 @@ const FName& UStaticMesh::GetAssetPathFileName() const
 	return EmptyString;
 }
 
-const TArray<FNormalVertex>& UStaticMesh::GetVertices() const
+TConstArrayView<FNormalVertex> UStaticMesh::GetVertices() const
 {
 	if (StaticMeshAsset)
 	{
 		return StaticMeshAsset->Vertices;
 	}
-	static const TArray<FNormalVertex> EmptyVertices;
-	return EmptyVertices;
+	return {};
 }
 
-TArray<FNormalVertex>& UStaticMesh::GetVertices()
-{
-	if (StaticMeshAsset)
-	{
-		return StaticMeshAsset->Vertices;
-	}
-	static TArray<FNormalVertex> EmptyVertices;
-	return EmptyVertices;
-}
-
-const TArray<uint32>& UStaticMesh::GetIndices() const
+TConstArrayView<uint32> UStaticMesh::GetIndices() const
 {
 	if (StaticMeshAsset)
 	{
 		return StaticMeshAsset->Indices;
 	}
-	static const TArray<uint32> EmptyIndices;
-	return EmptyIndices;
+	return {};
 }
 
 UMaterial* UStaticMesh::GetMaterial(int32 MaterialIndex) const
@@ -104,3 +93,44 @@ const TArray<FMeshSection>& UStaticMesh::GetSections() const
 	static const TArray<FMeshSection> EmptySections;
 	return EmptySections;
 }
+
+FArchive& operator<<(FArchive& Ar, FNormalVertex& Vertex)
+{
+	Ar << Vertex.Position;
+	Ar << Vertex.Normal;
+	Ar << Vertex.Color;
+	Ar << Vertex.TexCoord;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FMaterial& Material)
+{
+	Ar << Material.Name;
+	Ar << Material.Ka;
+	Ar << Material.Kd;
+	Ar << Material.Ks;
+	Ar << Material.Ke;
+	Ar << Material.Ns;
+	Ar << Material.Ni;
+	Ar << Material.D;
+	Ar << Material.Illumination;
+	Ar << Material.KaMap;
+	Ar << Material.KdMap;
+	Ar << Material.KsMap;
+	Ar << Material.NsMap;
+	Ar << Material.DMap;
+	Ar << Material.BumpMap;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FStaticMesh& StaticMesh)
+{
+	Ar.SerializeAlignedArray(StaticMesh.VertexStorage, StaticMesh.Vertices);
+	Ar.SerializeAlignedArray(StaticMesh.IndexStorage, StaticMesh.Indices);
+	Ar << StaticMesh.MaterialInfo;
+	Ar << StaticMesh.Sections;
+
+	StaticMesh.BVH.Serialize(Ar, &StaticMesh);
+	StaticMesh.QBVH.Serialize(Ar, &StaticMesh);
+	return Ar;
+}
@@ -107,13 +107,13 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 	{
 		StaticMesh = NewStaticMesh;
 
-		Vertices = &(StaticMesh.Get()->GetVertices());
+		Vertices = StaticMesh.Get()->GetVertices();
 		VertexBuffer = AssetManager.GetVertexBuffer(InObjPath);
-		NumVertices = Vertices->size();
+		NumVertices = Vertices.size();
 
-		Indices = &(StaticMesh.Get()->GetIndices());
+		Indices = StaticMesh.Get()->GetIndices();
 		IndexBuffer = AssetManager.GetIndexBuffer(InObjPath);
-		NumIndices = Indices->size();
+		NumIndices = Indices.size();
 
 		RenderState.CullMode = ECullMode::Back;
 		RenderState.FillMode = EFillMode::Solid;
@@ -4,6 +4,9 @@
 #include "Core/Public/ObjectPtr.h" // TObjectPtr 사용
 #include "Global/CoreTypes.h"        // TArray 등
 #include "Global/BVH.h"
+#include "Global/QBVH.h"
+#include "Core/Public/MappedFile.h"
+#include <memory>
 
 // 전방 선언: FStaticMesh의 전체 정의를 포함할 필요 없이 포인터만 사용
 struct FMeshSection
@@ -21,9 +24,24 @@ struct FStaticMesh
 {
 	FName PathFileName;
 
-	TArray<FNormalVertex> Vertices;
-	TArray<uint32> Indices;
+	// 렌더링/피킹이 읽는 버텍스와 인덱스
+	// 임포트하거나 스트림으로 로드한 메시는 VertexStorage/IndexStorage를, 매핑으로 로드한 메시는 MappedFile 안을 가리킨다
+	TConstArrayView<FNormalVertex> Vertices;
+	TConstArrayView<uint32> Indices;
+
+	TArray<FNormalVertex> VertexStorage;
+	TArray<uint32> IndexStorage;
+	std::unique_ptr<FMappedFile> MappedFile;
+
+	// VertexStorage/IndexStorage를 채운 뒤 호출하여 Vertices/Indices가 이를 가리키게 한다
+	void UpdateGeometryViews()
+	{
+		Vertices = VertexStorage;
+		Indices = IndexStorage;
+	}
+
 	FBVH BVH; // 메시의 가속 구조
+	FQBVH QBVH; // BVH를 4-ary로 접은 피킹용 가속 구조 (SSE 순회)
 
 	// --- 2. 재질 정보 (Materials) ---
 	// 이 메시에 사용되는 모든 고유 재질의 목록 (페인트 팔레트)
@@ -36,6 +54,16 @@ struct FStaticMesh
 	TArray<FMeshSection> Sections;
 };
 
+FArchive& operator<<(FArchive& Ar, FNormalVertex& Vertex);
+FArchive& operator<<(FArchive& Ar, FMaterial& Material);
+
+/**
+ * @brief Cooked 메시 캐시용 직렬화: 버텍스/인덱스 버퍼, 재질 정보, 섹션, BVH/QBVH 노드 배열을 그대로 저장/로드
+ * @note PathFileName은 저장하지 않으며, 로드 후 다시 구축할 것이 없도록 가속 구조도 함께 기록한다
+ * 버텍스/인덱스는 정렬된 배열로 기록하므로, 매핑된 파일을 persistent FMemoryReader로 읽으면 복사 없이 파일을 가리킨다
+ */
+FArchive& operator<<(FArchive& Ar, FStaticMesh& StaticMesh);
+
 
 /**
  * @brief FStaticMesh(Cooked Data)를 엔진 오브젝트 시스템에 통합하는 래퍼 클래스.
@@ -68,9 +96,8 @@ public:
 	const FName& GetAssetPathFileName() const;
 
 	// Geometry Data
-	const TArray<FNormalVertex>& GetVertices() const;
-	TArray<FNormalVertex>& GetVertices();
-	const TArray<uint32>& GetIndices() const;
+	TConstArrayView<FNormalVertex> GetVertices() const;
+	TConstArrayView<uint32> GetIndices() const;
 
 	// Material Data
 	UMaterial* GetMaterial(int32 MaterialIndex) const;
@@ -4,12 +4,26 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
 
+#include <atomic>
+
 IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
 
+namespace
+{
+	// 0은 "수집된 적 없음"으로 쓰이므로 1부터 발급한다
+	std::atomic<uint64> GNextBoundsRevision{ 1 };
+
+	uint64 IssueBoundsRevision()
+	{
+		return GNextBoundsRevision.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
 UPrimitiveComponent::UPrimitiveComponent()
 {
 	ComponentType = EComponentType::Primitive;
 	bCanEverTick = true;
+	BoundsRevision = IssueBoundsRevision();
 }
 
 void UPrimitiveComponent::TickComponent()
@@ -87,12 +101,12 @@ const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 	return WorldTransformMatrixInverse;
 }
 
-const TArray<FNormalVertex>* UPrimitiveComponent::GetVerticesData() const
+TConstArrayView<FNormalVertex> UPrimitiveComponent::GetVerticesData() const
 {
 	return Vertices;
 }
 
-const TArray<uint32>* UPrimitiveComponent::GetIndicesData() const
+TConstArrayView<uint32> UPrimitiveComponent::GetIndicesData() const
 {
 	return Indices;
 }
@@ -177,6 +191,7 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
 void UPrimitiveComponent::MarkAsDirty()
 {
 	bIsAABBCacheDirty = true;
+	BoundsRevision = IssueBoundsRevision();
 	Super::MarkAsDirty();
 }
 
@@ -18,10 +18,10 @@ UTextComponent::UTextComponent()
 
 	UAssetManager& ResourceManager = UAssetManager::GetInstance();
 
-	Vertices = &PickingAreaVertex;
+	Vertices = PickingAreaVertex;
 	NumVertices = PickingAreaVertex.size();
 
-	Indices = &PickingAreaIndex;
+	Indices = PickingAreaIndex;
 	NumIndices = PickingAreaIndex.size();
 
 	RegulatePickingAreaByTextLength();
@@ -79,6 +79,7 @@ void UTextComponent::RegulatePickingAreaByTextLength()
 		};
 		PickingAreaVertex.push_back(NewVertex);
 	}
+	Vertices = PickingAreaVertex;
 
 	PickingAreaBoundingBox =
 		FAABB(
@@ -1,6 +1,9 @@
 ﻿#pragma once
 #include "Component/Public/SceneComponent.h"
 #include "Physics/Public/BoundingVolume.h"
+#include "Physics/Public/AABB.h"
+
+class FOctree;
 
 UCLASS()
 class UPrimitiveComponent : public USceneComponent
@@ -16,8 +19,8 @@ public:
 	virtual void OnSelected() override;
 	virtual void OnDeselected() override;
 
-	const TArray<FNormalVertex>* GetVerticesData() const;
-	const TArray<uint32>* GetIndicesData() const;
+	TConstArrayView<FNormalVertex> GetVerticesData() const;
+	TConstArrayView<uint32> GetIndicesData() const;
 	ID3D11Buffer* GetVertexBuffer() const;
 	ID3D11Buffer* GetIndexBuffer() const;
 	uint32 GetNumVertices() const;
@@ -38,6 +41,10 @@ public:
 	const IBoundingVolume* GetBoundingBox() const { return BoundingBox; }
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
 
+	// Transform이 바뀔 때마다 새로 발급되는 값 (외부에서 월드 AABB 캐시의 갱신 여부 판단용)
+	// 모든 프리미티브가 하나의 전역 카운터에서 받으므로, 해제된 주소를 재사용한 새 프리미티브와도 겹치지 않는다
+	uint64 GetBoundsRevision() const { return BoundsRevision; }
+
 	EPrimitiveType GetPrimitiveType() const { return Type; }
 
 	virtual void MarkAsDirty() override;
@@ -47,8 +54,9 @@ public:
 	mutable uint32 CachedFrame = 0;
 
 protected:
-	const TArray<FNormalVertex>* Vertices = nullptr;
-	const TArray<uint32>* Indices = nullptr;
+	// 비어 있는 Indices는 인덱스 없이 그리는 프리미티브를 뜻한다
+	TConstArrayView<FNormalVertex> Vertices;
+	TConstArrayView<uint32> Indices;
 
 	ID3D11Buffer* VertexBuffer = nullptr;
 	ID3D11Buffer* IndexBuffer = nullptr;
@@ -69,6 +77,22 @@ protected:
 	mutable FVector CachedWorldMin;
 	mutable FVector CachedWorldMax;
 	mutable bool bIsAABBCacheDirty = true;
+	uint64 BoundsRevision = 0;
+
+private:
+	// 아래 기록은 소유한 컨테이너만 갱신한다
+	friend class FOctree;
+	friend class FOctreeOwnerSnapshot;
+	friend class ULevel;
+	friend bool RunOctreeOwnerCheck(const TArray<UPrimitiveComponent*>& InPrimitives, const FAABB& InBoundingBox);
+
+	// 이 프리미티브를 보관 중인 옥트리 노드와 노드 내 인덱스 (FOctree가 관리하며, O(1) 제거에 사용)
+	FOctree* OctreeNode = nullptr;
+	int32 OctreeNodeIndex = -1;
+	// 옥트리에 마지막으로 배치될 때 사용한 월드 AABB (소유 노드 기록을 잃었을 때 이 경계로 기존 항목을 찾는다)
+	FAABB OctreeBounds;
+	// ULevel::DynamicPrimitives 안에서의 인덱스 (ULevel이 관리하며, -1이면 목록에 없음)
+	int32 DynamicPrimitiveIndex = -1;
 
 public:
 	virtual UObject* Duplicate() override;
@@ -1,9 +1,12 @@
 #include "pch.h"
 #include "Core/Public/Class.h"
 #include "Core/Public/Object.h"
+#include "Utility/Public/Benchmark.h"
 
 using std::stringstream;
 
+bool UClass::bIsClassTreeDirty = true;
+
 void UClass::SignUpClass(TObjectPtr<UClass> InClass)
 {
 	if (InClass)
@@ -13,6 +16,7 @@ void UClass::SignUpClass(TObjectPtr<UClass> InClass)
 			if (Class == InClass) return;
 		}
 		GetAllClasses().emplace_back(InClass);
+		bIsClassTreeDirty = true;
 		UE_LOG("UClass: Class registered: %s (Total: %llu)", InClass->GetName().ToString().data(), GetAllClasses().size());
 	}
 }
@@ -37,6 +41,23 @@ TArray<TObjectPtr<UClass>>& UClass::GetAllClasses()
 	return AllClasses;
 }
 
+TArray<UClass*>& UClass::GetClassTreeOrder()
+{
+	// 정적 초기화 중에 클래스 트리가 갱신될 수 있으므로 GetAllClasses와 같이 최초 호출 시 초기화한다
+	static TArray<UClass*> ClassTreeOrder;
+	return ClassTreeOrder;
+}
+
+const TArray<UClass*>& UClass::GetClassesInTreeOrder()
+{
+	if (bIsClassTreeDirty)
+	{
+		UpdateClassTree();
+	}
+
+	return GetClassTreeOrder();
+}
+
 /**
  * @brief UClass Constructor
  * @param InName Class 이름
@@ -49,39 +70,64 @@ UClass::UClass(const FName& InName, TObjectPtr<UClass> InSuperClass, size_t InCl
 	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor)
 {
 	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
+	SignUpClass(this);
 }
 
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(const TObjectPtr<UClass> InClass) const
+void UClass::UpdateClassTree()
 {
-	if (!InClass)
+	const TArray<TObjectPtr<UClass>>& AllClasses = GetAllClasses();
+
+	// 부모 클래스별 자식 목록 (부모가 없는 클래스가 루트)
+	TMap<const UClass*, TArray<UClass*>> Children;
+	TArray<UClass*> Roots;
+	for (UClass* Class : AllClasses)
 	{
-		return false;
+		const UClass* Super = Class->SuperClass.Get();
+		if (Super && Super != Class)
+		{
+			Children[Super].push_back(Class);
+		}
+		else
+		{
+			Roots.push_back(Class);
+		}
 	}
 
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
+	int32 NextIndex = 0;
+	for (UClass* Root : Roots)
 	{
-		return true;
+		NextIndex = AssignClassTreeRange(Root, Children, NextIndex);
 	}
 
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
+	TArray<UClass*>& ClassTreeOrder = GetClassTreeOrder();
+	ClassTreeOrder.resize(NextIndex);
+	for (UClass* Class : AllClasses)
 	{
-		if (CurrentClass->ClassName == InClass->ClassName)
+		ClassTreeOrder[Class->ClassTreeIndex] = Class;
+	}
+
+	bIsClassTreeDirty = false;
+}
+
+/**
+ * @brief InClass와 그 하위 클래스들에 전위 순회 순서를 부여
+ * @return 다음 클래스에 부여할 순서
+ */
+int32 UClass::AssignClassTreeRange(UClass* InClass, const TMap<const UClass*, TArray<UClass*>>& InChildren, int32 InNextIndex)
+{
+	InClass->ClassTreeIndex = InNextIndex++;
+
+	auto Iter = InChildren.find(InClass);
+	if (Iter != InChildren.end())
+	{
+		for (UClass* Child : Iter->second)
 		{
-			return true;
+			InNextIndex = AssignClassTreeRange(Child, InChildren, InNextIndex);
 		}
-
-		CurrentClass = CurrentClass->SuperClass.Get();
 	}
 
-	return false;
+	InClass->ClassTreeLastIndex = InNextIndex - 1;
+	return InNextIndex;
 }
 
 /**
@@ -96,4 +142,74 @@ TObjectPtr<UObject> UClass::CreateDefaultObject() const
 	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
+
+void RunCastBenchmark(const TArray<UObject*>& InObjects, const TArray<UClass*>& InTargetClasses)
+{
+	if (InObjects.empty() || InTargetClasses.empty())
+	{
+		return;
+	}
+
+	// 기존 방식: Cast<T>마다 T::StaticClass()가 SignUpClass로 등록 목록을 선형 탐색하고, IsChildOf가 부모 체인을 따라 이름을 비교
+	auto LegacyIsA = [](const UObject* InObject, UClass* InClass)
+	{
+		bool bIsSignedUp = false;
+		for (UClass* Class : UClass::GetAllClasses())
+		{
+			if (Class == InClass) { bIsSignedUp = true; break; }
+		}
+		if (!bIsSignedUp)
+		{
+			return false;
+		}
+
+		for (const UClass* Class = InObject->GetClass(); Class; Class = Class->SuperClass.Get())
+		{
+			if (Class->ClassName == InClass->ClassName)
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	auto CurrentIsA = [](const UObject* InObject, UClass* InClass)
+	{
+		return InObject->IsA(InClass);
+	};
+
+	// 객체마다 처음 일치하는 대상 클래스의 순서를 모아 두 방식의 결과를 비교
+	auto Measure = [&](const auto& InIsA, uint64& OutChecksum)
+	{
+		return FBenchmark::MeasureBest([&]()
+		{
+			uint64 Checksum = 0;
+			for (const UObject* Object : InObjects)
+			{
+				for (size_t TargetIndex = 0; TargetIndex < InTargetClasses.size(); ++TargetIndex)
+				{
+					if (InIsA(Object, InTargetClasses[TargetIndex]))
+					{
+						Checksum += TargetIndex + 1;
+						break;
+					}
+				}
+			}
+			OutChecksum = Checksum;
+		});
+	};
+
+	uint64 LegacyChecksum = 0;
+	uint64 CurrentChecksum = 0;
+	const double LegacyMs = Measure(LegacyIsA, LegacyChecksum);
+	const double CurrentMs = Measure(CurrentIsA, CurrentChecksum);
+
+	const double ObjectCount = static_cast<double>(InObjects.size());
+	UE_LOG_INFO("Cast Benchmark: %zu objects, %zu target classes, %zu registered classes%s", InObjects.size(), InTargetClasses.size(),
+		UClass::GetAllClasses().size(), LegacyChecksum == CurrentChecksum ? "" : " (MISMATCH)");
+	UE_LOG_INFO("  Legacy (list scan + super chain) : %.3f ms, %.1f ns/object, %.2f M objects/s", LegacyMs,
+		LegacyMs * 1.0e6 / ObjectCount, LegacyMs > 0.0 ? ObjectCount / (LegacyMs * 1000.0) : 0.0);
+	UE_LOG_INFO("  Class tree range                 : %.3f ms, %.1f ns/object, %.2f M objects/s", CurrentMs,
+		CurrentMs * 1.0e6 / ObjectCount, CurrentMs > 0.0 ? ObjectCount / (CurrentMs * 1000.0) : 0.0);
+}
@@ -87,16 +87,23 @@ int FClientApp::InitializeSystem() const
 	UInputManager::GetInstance();
 
 	auto& Renderer = URenderer::GetInstance();
-	Renderer.Init(Window->GetWindowHandle());
+	{
+		ALLOCATION_TAG(Render)
+		Renderer.Init(Window->GetWindowHandle());
+	}
+
+	{
+		ALLOCATION_TAG(UI)
 
-	// StatOverlay Initialize
-	auto& StatOverlay = UStatOverlay::GetInstance();
-	StatOverlay.Initialize();
+		// StatOverlay Initialize
+		auto& StatOverlay = UStatOverlay::GetInstance();
+		StatOverlay.Initialize();
 
-	// UIManager Initialize
-	auto& UIManger = UUIManager::GetInstance();
-	UIManger.Initialize(Window->GetWindowHandle());
-	UUIWindowFactory::CreateDefaultUILayout();
+		// UIManager Initialize
+		auto& UIManger = UUIManager::GetInstance();
+		UIManger.Initialize(Window->GetWindowHandle());
+		UUIWindowFactory::CreateDefaultUILayout();
+	}
 
 	UAssetManager::GetInstance().Initialize();
 
@@ -116,6 +123,7 @@ void FClientApp::UpdateSystem() const
 	auto& Renderer = URenderer::GetInstance();
 	{
 		TIME_PROFILE(GEditor)
+		ALLOCATION_TAG(Level)
 		GEditor->Tick(DT);
 	}
 	{
@@ -128,12 +136,17 @@ void FClientApp::UpdateSystem() const
 	}
 	{
 		TIME_PROFILE(UIManager)
+		ALLOCATION_TAG(UI)
 		UIManager.Update();
 	}	
 	{
 		TIME_PROFILE(Renderer)
+		ALLOCATION_TAG(Render)
 		Renderer.Update();
 	}
+
+	// 태그별 최고 사용량을 프레임마다 갱신
+	FAllocationTracker::Sample();
 }
 
 /**
@@ -0,0 +1,59 @@
+#include "pch.h"
+
+#include "Core/Public/MappedFile.h"
+
+FMappedFile::~FMappedFile()
+{
+	Close();
+}
+
+bool FMappedFile::Open(const std::filesystem::path& FilePath)
+{
+	Close();
+
+	HANDLE FileHandle = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (FileHandle == INVALID_HANDLE_VALUE)
+	{
+		UE_LOG_ERROR("매핑할 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	LARGE_INTEGER FileSize = {};
+	if (!GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart <= 0)
+	{
+		CloseHandle(FileHandle);
+		return false;
+	}
+
+	// 뷰가 매핑을 참조하므로 파일/매핑 핸들은 뷰를 만든 뒤 바로 닫아도 된다
+	HANDLE MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(FileHandle);
+	if (!MappingHandle)
+	{
+		UE_LOG_ERROR("파일 매핑을 만드는데 실패했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	const void* View = MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(MappingHandle);
+	if (!View)
+	{
+		UE_LOG_ERROR("파일 뷰를 매핑하는데 실패했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	Data = static_cast<const uint8*>(View);
+	Size = static_cast<size_t>(FileSize.QuadPart);
+	return true;
+}
+
+void FMappedFile::Close()
+{
+	if (Data)
+	{
+		UnmapViewOfFile(Data);
+		Data = nullptr;
+		Size = 0;
+	}
+}
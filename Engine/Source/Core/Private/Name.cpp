@@ -1,14 +1,65 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+#include "Utility/Public/Benchmark.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    constexpr uint32 FNV_OFFSET_BASIS = 2166136261u;
+    constexpr uint32 FNV_PRIME = 16777619u;
+
+    // ComparisonStringPool은 소문자로 저장하므로 std::tolower와 같은 ASCII 기준으로 변환
+    char ToLowerAscii(char C)
+    {
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C - 'A' + 'a') : C;
+    }
+
+    /**
+     * @brief 한 번의 순회로 대소문자를 무시한 해시(비교용)와 원본 해시(표시용)를 함께 계산 (FNV-1a)
+     */
+    void HashName(std::string_view Str, uint32& OutComparisonHash, uint32& OutDisplayHash)
+    {
+        uint32 ComparisonHash = FNV_OFFSET_BASIS;
+        uint32 DisplayHash = FNV_OFFSET_BASIS;
+        for (const char C : Str)
+        {
+            ComparisonHash = (ComparisonHash ^ static_cast<uint8>(ToLowerAscii(C))) * FNV_PRIME;
+            DisplayHash = (DisplayHash ^ static_cast<uint8>(C)) * FNV_PRIME;
+        }
+        OutComparisonHash = ComparisonHash;
+        OutDisplayHash = DisplayHash;
+    }
+
+    bool EqualsLowerCase(std::string_view Str, const FString& LowerStr)
+    {
+        if (Str.size() != LowerStr.size())
+        {
+            return false;
+        }
+        for (size_t Index = 0; Index < Str.size(); ++Index)
+        {
+            if (ToLowerAscii(Str[Index]) != LowerStr[Index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr int32 INITIAL_SLOT_COUNT = 1024;
+}
 
 /**@brief FName::None으로 초기화합니다.*/
 FName::FName() : ComparisonIndex(0), DisplayIndex(0), Number(-1)
 {
 }
 
-FName::FName(const FString& Str)
+FName::FName(const FString& Str) : FName(std::string_view(Str)) { }
+
+FName::FName(const char* Str) : FName(std::string_view(Str)) { }
+
+FName::FName(std::string_view Str)
 {
     TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str);
     ComparisonIndex = Indices.first;
@@ -16,8 +67,6 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str)) { }
-
 /**@brief NameTable에서 UniqueName을 만들 때 사용하는 생성자*/
 FName::FName(int32 InComparisonIndex, int32 InDisplayIndex, int32 InNumber)
     : ComparisonIndex(InComparisonIndex), DisplayIndex(InDisplayIndex), Number(InNumber)
@@ -65,8 +114,11 @@ const FName FName::None(0, 0, -1);
 
 FNameTable::FNameTable()
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    ComparisonSlots.resize(INITIAL_SLOT_COUNT);
+    DisplaySlots.resize(INITIAL_SLOT_COUNT);
+
+    // 0번은 None으로 예약 (FName::None, IsNone)
+    FindOrAddName("None");
 }
 
 FNameTable::~FNameTable() = default;
@@ -78,57 +130,118 @@ FNameTable& FNameTable::GetInstance()
 }
 
 /**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
+* @brief 문자열이 풀에 없으면 등록하고 인덱스를 반환
+* @param Str FName으로 등록되었는지 확인할 문자열
 * @return ComparisonIndex, DisplayIndex
 */
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+TPair<int32, int32> FNameTable::FindOrAddName(std::string_view Str)
 {
-    FString LowerStr = ToLower(Str);
+    uint32 ComparisonHash;
+    uint32 DisplayHash;
+    HashName(Str, ComparisonHash, DisplayHash);
+
+    std::lock_guard<std::mutex> Lock(TableMutex);
 
-    int32 ComparisonIndex;
-    auto ItComparison = ComparisonMap.find(LowerStr);
-    if (ItComparison != ComparisonMap.end())
+    // 두 테이블 모두 크기가 2의 거듭제곱인 선형 탐사 테이블
+    int32 ComparisonIndex = -1;
+    const uint32 ComparisonMask = static_cast<uint32>(ComparisonSlots.size()) - 1;
+    for (uint32 Slot = ComparisonHash & ComparisonMask; ComparisonSlots[Slot].Index >= 0; Slot = (Slot + 1) & ComparisonMask)
     {
-        ComparisonIndex = ItComparison->second;
+        const FNameHashSlot& Entry = ComparisonSlots[Slot];
+        if (Entry.Hash == ComparisonHash && EqualsLowerCase(Str, ComparisonStringPool[Entry.Index]))
+        {
+            ComparisonIndex = Entry.Index;
+            break;
+        }
     }
-    else
+    if (ComparisonIndex < 0)
     {
-        ComparisonIndex = ComparisonStringPool.size();
-        ComparisonStringPool.push_back(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        ComparisonIndex = AddComparisonName(Str, ComparisonHash);
     }
 
-    int32 DisplayIndex;
-    auto ItDisplay = DisplayMap.find(Str);
-    if (ItDisplay != DisplayMap.end())
+    int32 DisplayIndex = -1;
+    const uint32 DisplayMask = static_cast<uint32>(DisplaySlots.size()) - 1;
+    for (uint32 Slot = DisplayHash & DisplayMask; DisplaySlots[Slot].Index >= 0; Slot = (Slot + 1) & DisplayMask)
     {
-        DisplayIndex = ItDisplay->second;
+        const FNameHashSlot& Entry = DisplaySlots[Slot];
+        if (Entry.Hash == DisplayHash && std::string_view(DisplayStringPool[Entry.Index]) == Str)
+        {
+            DisplayIndex = Entry.Index;
+            break;
+        }
     }
-    else
+    if (DisplayIndex < 0)
     {
-        DisplayIndex = DisplayStringPool.size();
-        DisplayStringPool.push_back(Str);
-        DisplayMap[Str] = DisplayIndex;
+        DisplayIndex = AddDisplayName(Str, DisplayHash);
     }
 
     return { ComparisonIndex, DisplayIndex };
 }
 
-FName FNameTable::GetUniqueName(const FString& BaseStr)
+int32 FNameTable::AddComparisonName(std::string_view Str, uint32 Hash)
+{
+    const int32 NewIndex = static_cast<int32>(ComparisonStringPool.size());
+
+    FString LowerStr(Str);
+    for (char& C : LowerStr)
+    {
+        C = ToLowerAscii(C);
+    }
+    ComparisonStringPool.push_back(std::move(LowerStr));
+    NextNumbers.push_back(0);
+
+    AddSlot(ComparisonSlots, Hash, NewIndex, NewIndex + 1);
+    return NewIndex;
+}
+
+int32 FNameTable::AddDisplayName(std::string_view Str, uint32 Hash)
+{
+    const int32 NewIndex = static_cast<int32>(DisplayStringPool.size());
+    DisplayStringPool.emplace_back(Str);
+
+    AddSlot(DisplaySlots, Hash, NewIndex, NewIndex + 1);
+    return NewIndex;
+}
+
+/**
+* @brief 해시 테이블에 인덱스를 추가하고, 사용률이 절반을 넘으면 저장된 해시로 두 배 크기에 다시 배치 (문자열은 다시 해시하지 않음)
+* @param InCount 추가 후 테이블에 들어 있는 인덱스 수
+*/
+void FNameTable::AddSlot(TArray<FNameHashSlot>& InOutSlots, uint32 InHash, int32 InIndex, int32 InCount)
 {
-    TPair<int32, int32> Indices = FindOrAddName(BaseStr);
-    int32 ComparisonIndex = Indices.first;
-    int32 DisplayIndex = Indices.second;
+    if (static_cast<size_t>(InCount) * 2 > InOutSlots.size())
+    {
+        TArray<FNameHashSlot> OldSlots = std::move(InOutSlots);
+        InOutSlots.assign(OldSlots.size() * 2, FNameHashSlot());
+        for (const FNameHashSlot& OldSlot : OldSlots)
+        {
+            if (OldSlot.Index >= 0)
+            {
+                AddSlot(InOutSlots, OldSlot.Hash, OldSlot.Index, 0);
+            }
+        }
+    }
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+    const uint32 Mask = static_cast<uint32>(InOutSlots.size()) - 1;
+    uint32 Slot = InHash & Mask;
+    while (InOutSlots[Slot].Index >= 0)
+    {
+        Slot = (Slot + 1) & Mask;
+    }
+    InOutSlots[Slot].Hash = InHash;
+    InOutSlots[Slot].Index = InIndex;
+}
 
-    return FName(ComparisonIndex, DisplayIndex, Number);
+FName FNameTable::GetUniqueName(const FName& BaseName)
+{
+    std::lock_guard<std::mutex> Lock(TableMutex);
+    const int32 Number = NextNumbers[BaseName.GetComparisonIndex()]++;
+    return FName(BaseName.GetComparisonIndex(), BaseName.GetDisplayIndex(), Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
+    std::lock_guard<std::mutex> Lock(TableMutex);
     if (Idx >= 0 && Idx < DisplayStringPool.size())
     {
         return DisplayStringPool[Idx];
@@ -137,10 +250,87 @@ FString FNameTable::GetDisplayString(int32 Idx) const
     return EmptyString;
 }
 
-FString FNameTable::ToLower(const FString& Str)
+int32 FNameTable::GetDisplayNameCount() const
 {
-    FString LowerStr = Str;
-    std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(),
-        [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
-}
\ No newline at end of file
+    std::lock_guard<std::mutex> Lock(TableMutex);
+    return static_cast<int32>(DisplayStringPool.size());
+}
+
+void RunNameBenchmark(int32 InCount)
+{
+    FNameTable& NameTable = FNameTable::GetInstance();
+
+    // 이미 등록된 이름을 그대로 조회하므로 테이블에 새 이름이 늘어나지 않는다
+    TArray<FString> Names;
+    const int32 NameCount = NameTable.GetDisplayNameCount();
+    Names.reserve(NameCount);
+    for (int32 Index = 0; Index < NameCount; ++Index)
+    {
+        Names.push_back(NameTable.GetDisplayString(Index));
+    }
+
+    // 기존 방식: 소문자 사본을 만들어 TMap<FString, int32> 두 개를 조회
+    TMap<FString, int32> LegacyComparisonMap;
+    TMap<FString, int32> LegacyDisplayMap;
+    TMap<FString, int32> LegacyNextNumberMap;
+    auto LegacyFindOrAddName = [&LegacyComparisonMap, &LegacyDisplayMap](const FString& InStr)
+    {
+        FString LowerStr = InStr;
+        std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+        auto ComparisonIt = LegacyComparisonMap.find(LowerStr);
+        const int32 ComparisonIndex = ComparisonIt != LegacyComparisonMap.end() ? ComparisonIt->second
+            : (LegacyComparisonMap[LowerStr] = static_cast<int32>(LegacyComparisonMap.size()));
+        auto DisplayIt = LegacyDisplayMap.find(InStr);
+        const int32 DisplayIndex = DisplayIt != LegacyDisplayMap.end() ? DisplayIt->second
+            : (LegacyDisplayMap[InStr] = static_cast<int32>(LegacyDisplayMap.size()));
+        return TPair<int32, int32>(ComparisonIndex, DisplayIndex);
+    };
+    for (const FString& Name : Names)
+    {
+        LegacyFindOrAddName(Name);
+    }
+
+    int64 LegacyChecksum = 0;
+    int64 HashedChecksum = 0;
+    const double LegacyFindMs = FBenchmark::MeasureBest([&]()
+    {
+        for (int32 Index = 0; Index < InCount; ++Index)
+        {
+            LegacyChecksum += LegacyFindOrAddName(Names[Index % NameCount]).second;
+        }
+    });
+    const double HashedFindMs = FBenchmark::MeasureBest([&]()
+    {
+        for (int32 Index = 0; Index < InCount; ++Index)
+        {
+            HashedChecksum += FName(std::string_view(Names[Index % NameCount])).GetDisplayIndex();
+        }
+    });
+
+    // NewObject: 기존에는 클래스 이름을 ToString으로 만든 뒤 다시 이름 테이블과 번호 TMap을 조회했다
+    // 실제 클래스 이름의 번호를 올리지 않도록 벤치마크 전용 이름을 사용
+    const FName BaseName("NameBenchmark");
+    const double LegacyUniqueMs = FBenchmark::MeasureBest([&]()
+    {
+        for (int32 Index = 0; Index < InCount; ++Index)
+        {
+            const FString BaseStr = BaseName.ToString();
+            LegacyChecksum += LegacyFindOrAddName(BaseStr).first + LegacyNextNumberMap[BaseStr]++;
+        }
+    });
+    const double HashedUniqueMs = FBenchmark::MeasureBest([&]()
+    {
+        for (int32 Index = 0; Index < InCount; ++Index)
+        {
+            HashedChecksum += NameTable.GetUniqueName(BaseName).GetUniqueNumber();
+        }
+    });
+
+    UE_LOG_INFO("Name Benchmark: %d lookups over %d registered names (checksum %lld / %lld)", InCount, NameCount, LegacyChecksum,
+        HashedChecksum);
+    UE_LOG_INFO("  FName from string: Legacy %.3f ms, Hashed %.3f ms (%.1fx, %.1f ns/name)", LegacyFindMs, HashedFindMs,
+        HashedFindMs > 0.0 ? LegacyFindMs / HashedFindMs : 0.0, HashedFindMs * 1000000.0 / InCount);
+    UE_LOG_INFO("  Unique name: Legacy %.3f ms, Hashed %.3f ms (%.1fx, %.1f ns/name)", LegacyUniqueMs, HashedUniqueMs,
+        HashedUniqueMs > 0.0 ? LegacyUniqueMs / HashedUniqueMs : 0.0, HashedUniqueMs * 1000000.0 / InCount);
+}
@@ -1,4 +1,103 @@
 #include "pch.h"
 
 #include "Core/Public/ObjectIterator.h"
+#include "Utility/Public/Benchmark.h"
 
+FClassObjectIterator::FClassObjectIterator(UClass* InClass)
+	: ObjectArray(&GetUObjectArray())
+	, Classes(&UClass::GetClassesInTreeOrder())
+	, ClassIndex(InClass->GetClassTreeIndex())
+	, LastClassIndex(InClass->GetClassTreeLastIndex())
+{
+	ObjectArray->BeginIteration();
+	AdvanceToNextValidObject();
+}
+
+FClassObjectIterator::FClassObjectIterator(const FClassObjectIterator& Other)
+	: ObjectArray(Other.ObjectArray)
+	, Classes(Other.Classes)
+	, ClassIndex(Other.ClassIndex)
+	, LastClassIndex(Other.LastClassIndex)
+	, NextObjectIndex(Other.NextObjectIndex)
+	, CurrentObject(Other.CurrentObject)
+{
+	ObjectArray->BeginIteration();
+}
+
+FClassObjectIterator::~FClassObjectIterator()
+{
+	ObjectArray->EndIteration();
+}
+
+void FClassObjectIterator::AdvanceToNextValidObject()
+{
+	CurrentObject = nullptr;
+	while (true)
+	{
+		// 현재 클래스의 목록을 다 돌았으면 하위 트리의 다음 클래스 목록으로 넘어간다
+		while (NextObjectIndex < 0)
+		{
+			if (ClassIndex > LastClassIndex)
+			{
+				return;
+			}
+			NextObjectIndex = (*Classes)[ClassIndex++]->GetFirstObjectIndex();
+		}
+
+		// 순회 중에 삭제된 객체는 칸만 비워진 채 목록에 남아 있으므로 건너뛴다
+		const FUObjectItem& Item = ObjectArray->GetItem(NextObjectIndex);
+		NextObjectIndex = Item.NextIndex;
+		if (Item.Object)
+		{
+			CurrentObject = Item.Object;
+			return;
+		}
+	}
+}
+
+void RunObjectIteratorBenchmark(const TArray<UClass*>& InClasses)
+{
+	FUObjectArray& ObjectArray = GetUObjectArray();
+
+	// 기존 방식: 해제된 칸을 포함한 전체 칸을 훑으며 IsA 검사
+	auto CountByScan = [&ObjectArray](UClass* InClass)
+	{
+		int32 Count = 0;
+		for (int32 Index = 0; Index < ObjectArray.GetSlotCount(); ++Index)
+		{
+			const UObject* Object = ObjectArray.GetItem(Index).Object;
+			if (Object && Object->IsA(InClass))
+			{
+				++Count;
+			}
+		}
+		return Count;
+	};
+
+	auto CountByClassList = [](UClass* InClass)
+	{
+		int32 Count = 0;
+		for (FClassObjectIterator Iter(InClass); Iter; ++Iter)
+		{
+			++Count;
+		}
+		return Count;
+	};
+
+	auto Measure = [](const auto& InCount, UClass* InClass, int32& OutCount)
+	{
+		return FBenchmark::MeasureBest([&]() { OutCount = InCount(InClass); });
+	};
+
+	UE_LOG_INFO("Object Iterator Benchmark: %d objects, %d slots", ObjectArray.GetObjectCount(), ObjectArray.GetSlotCount());
+	for (UClass* Class : InClasses)
+	{
+		int32 ScanCount = 0;
+		int32 ListCount = 0;
+		const double ScanMs = Measure(CountByScan, Class, ScanCount);
+		const double ListMs = Measure(CountByClassList, Class, ListCount);
+
+		UE_LOG_INFO("  %s: %d instances%s, Full scan %.4f ms, Class list %.4f ms (%.1fx)", Class->GetName().ToString().data(), ListCount,
+			ScanCount == ListCount ? "" : " (MISMATCH)", ScanMs, ListMs, ListMs > 0.0 ? ScanMs / ListMs : 0.0);
+	}
+}
@@ -0,0 +1,219 @@
+#include "pch.h"
+#include "Core/Public/UObjectArray.h"
+#include "Core/Public/Object.h"
+
+FUObjectArray& GetUObjectArray()
+{
+	static FUObjectArray GUObjectArray;
+	return GUObjectArray;
+}
+
+/**
+ * @brief 빈 칸을 재사용하거나 새 칸을 추가하여 객체를 등록
+ * 객체의 실제 클래스는 생성자가 모두 끝나야 확정되므로 클래스 목록 연결은 다음 순회 시작까지 미룬다
+ * @return 객체가 들어간 칸의 인덱스
+ */
+int32 FUObjectArray::AllocateSlot(UObject* InObject)
+{
+	int32 Index;
+	if (FirstFreeIndex >= 0)
+	{
+		Index = FirstFreeIndex;
+		FirstFreeIndex = Items[Index].NextIndex;
+	}
+	else
+	{
+		Index = static_cast<int32>(Items.size());
+		Items.emplace_back();
+	}
+
+	FUObjectItem& Item = Items[Index];
+	Item.Object = InObject;
+	Item.PrevIndex = -1;
+	Item.NextIndex = -1;
+	Item.ListedClass = nullptr;
+
+	PendingObjects.push_back({ Index, Item.Generation });
+	++ObjectCount;
+	return Index;
+}
+
+void FUObjectArray::FreeSlot(int32 InIndex)
+{
+	if (InIndex < 0 || InIndex >= static_cast<int32>(Items.size()) || !Items[InIndex].Object)
+	{
+		return;
+	}
+
+	FUObjectItem& Item = Items[InIndex];
+	Item.Object = nullptr;
+	++Item.Generation;
+	--ObjectCount;
+
+	// 아직 연결 전이면 대기 목록의 핸들은 더 이상 Resolve되지 않는다
+	// 순회 없이 생성/삭제가 반복되어도 대기 목록이 커지지 않도록 삭제된 객체가 절반을 넘으면 한 번에 정리한다
+	if (!Item.ListedClass && ++StalePendingCount * 2 > static_cast<int32>(PendingObjects.size()))
+	{
+		PrunePendingObjects();
+	}
+
+	// 순회 중인 반복자가 이 칸을 거쳐 다음 객체로 넘어갈 수 있으므로 목록에서 떼어 내는 것은 순회가 끝난 뒤에 한다
+	if (IterationDepth > 0 && Item.ListedClass)
+	{
+		DeferredFreeIndices.push_back(InIndex);
+		return;
+	}
+
+	ReleaseSlot(InIndex);
+}
+
+FObjectHandle FUObjectArray::MakeHandle(const UObject* InObject) const
+{
+	if (!InObject)
+	{
+		return {};
+	}
+
+	const int32 Index = InObject->GetInternalIndex();
+	return { Index, Items[Index].Generation };
+}
+
+UObject* FUObjectArray::Resolve(const FObjectHandle& InHandle) const
+{
+	if (InHandle.Index < 0 || InHandle.Index >= static_cast<int32>(Items.size()))
+	{
+		return nullptr;
+	}
+
+	const FUObjectItem& Item = Items[InHandle.Index];
+	return Item.Generation == InHandle.Generation ? Item.Object : nullptr;
+}
+
+void FUObjectArray::BeginIteration()
+{
+	if (IterationDepth == 0)
+	{
+		FlushPendingObjects();
+	}
+	++IterationDepth;
+}
+
+void FUObjectArray::EndIteration()
+{
+	--IterationDepth;
+	if (IterationDepth > 0)
+	{
+		return;
+	}
+
+	for (int32 Index : DeferredFreeIndices)
+	{
+		ReleaseSlot(Index);
+	}
+	DeferredFreeIndices.clear();
+}
+
+/**
+ * @brief 대기 중인 객체를 실제 클래스 목록 끝에 연결
+ * 직전에 연결한 객체는 생성 도중(부모 클래스 생성자 안에서 순회가 시작된 경우)에 연결되었을 수 있으므로 클래스를 다시 확인하여 옮긴다
+ */
+void FUObjectArray::FlushPendingObjects()
+{
+	TArray<FObjectHandle> ObjectsToVerify;
+	ObjectsToVerify.swap(RecentlyLinkedObjects);
+
+	for (const FObjectHandle& Handle : ObjectsToVerify)
+	{
+		UObject* Object = Resolve(Handle);
+		if (!Object)
+		{
+			continue;
+		}
+
+		UClass* Class = Object->GetClass();
+		if (Class != Items[Handle.Index].ListedClass)
+		{
+			UnlinkObject(Handle.Index);
+			LinkObject(Handle.Index, Class);
+			RecentlyLinkedObjects.push_back(Handle);
+		}
+	}
+
+	for (const FObjectHandle& Handle : PendingObjects)
+	{
+		if (UObject* Object = Resolve(Handle))
+		{
+			LinkObject(Handle.Index, Object->GetClass());
+			RecentlyLinkedObjects.push_back(Handle);
+		}
+	}
+	PendingObjects.clear();
+	StalePendingCount = 0;
+}
+
+void FUObjectArray::PrunePendingObjects()
+{
+	PendingObjects.erase(std::remove_if(PendingObjects.begin(), PendingObjects.end(),
+		[this](const FObjectHandle& Handle) { return !Resolve(Handle); }), PendingObjects.end());
+	StalePendingCount = 0;
+}
+
+void FUObjectArray::LinkObject(int32 InIndex, UClass* InClass)
+{
+	FUObjectItem& Item = Items[InIndex];
+	Item.ListedClass = InClass;
+	Item.PrevIndex = InClass->LastObjectIndex;
+	Item.NextIndex = -1;
+
+	if (InClass->LastObjectIndex >= 0)
+	{
+		Items[InClass->LastObjectIndex].NextIndex = InIndex;
+	}
+	else
+	{
+		InClass->FirstObjectIndex = InIndex;
+	}
+	InClass->LastObjectIndex = InIndex;
+	++InClass->ObjectCount;
+}
+
+void FUObjectArray::UnlinkObject(int32 InIndex)
+{
+	FUObjectItem& Item = Items[InIndex];
+	UClass* Class = Item.ListedClass;
+	if (!Class)
+	{
+		return;
+	}
+
+	if (Item.PrevIndex >= 0)
+	{
+		Items[Item.PrevIndex].NextIndex = Item.NextIndex;
+	}
+	else
+	{
+		Class->FirstObjectIndex = Item.NextIndex;
+	}
+
+	if (Item.NextIndex >= 0)
+	{
+		Items[Item.NextIndex].PrevIndex = Item.PrevIndex;
+	}
+	else
+	{
+		Class->LastObjectIndex = Item.PrevIndex;
+	}
+
+	--Class->ObjectCount;
+	Item.ListedClass = nullptr;
+	Item.PrevIndex = -1;
+	Item.NextIndex = -1;
+}
+
+void FUObjectArray::ReleaseSlot(int32 InIndex)
+{
+	UnlinkObject(InIndex);
+
+	Items[InIndex].NextIndex = FirstFreeIndex;
+	FirstFreeIndex = InIndex;
+}
@@ -1,10 +1,64 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 
 #include "Global/CoreTypes.h"
 #include "Global/Vector.h"
 
+/**
+ * @brief TArray<T>를 원소 단위가 아니라 Serialize 한 번으로 통째로 직렬화할 수 있는지 여부
+ * trivially copyable 타입은 기본으로 허용하고, 복사 생성자만 직접 정의한 float 묶음 타입은 아래에서 따로 허용한다
+ * @note bool은 TArray<bool>이 연속 메모리가 아니므로 제외
+ */
+template<typename T>
+struct TCanBulkSerialize : std::bool_constant<std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>> {};
+
+template<> struct TCanBulkSerialize<FVector> : std::true_type {};
+template<> struct TCanBulkSerialize<FVector2> : std::true_type {};
+template<> struct TCanBulkSerialize<FVector4> : std::true_type {};
+// FVector4 정렬 때문에 Normal 뒤와 TexCoord 뒤의 패딩까지 기록된다 (원소 단위 직렬화와 레이아웃이 다름, 패딩은 TBulkSerializePadding이 0으로 채움)
+template<> struct TCanBulkSerialize<FNormalVertex> : std::true_type {};
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector must be tightly packed floats for bulk serialization");
+static_assert(sizeof(FVector2) == sizeof(float) * 2, "FVector2 must be tightly packed floats for bulk serialization");
+static_assert(sizeof(FVector4) == sizeof(float) * 4, "FVector4 must be tightly packed floats for bulk serialization");
+
+/**
+ * @brief 일괄 직렬화로 저장할 때 패딩 바이트를 0으로 지워야 하는 타입 (메모리에 남은 값이 파일에 기록되지 않도록)
+ * 패딩이 있는 TCanBulkSerialize 타입은 특수화하여 ZeroPadding에서 패딩 영역을 지운다
+ */
+template<typename T>
+struct TBulkSerializePadding
+{
+	static constexpr bool bHasPadding = false;
+	static void ZeroPadding(T&) {}
+};
+
+template<>
+struct TBulkSerializePadding<FNormalVertex>
+{
+	static constexpr bool bHasPadding = true;
+
+	static void ZeroPadding(FNormalVertex& InOutVertex)
+	{
+		uint8* Bytes = reinterpret_cast<uint8*>(&InOutVertex);
+		memset(Bytes + NORMAL_END, 0, offsetof(FNormalVertex, Color) - NORMAL_END);
+		memset(Bytes + TEX_COORD_END, 0, sizeof(FNormalVertex) - TEX_COORD_END);
+	}
+
+private:
+	static constexpr size_t NORMAL_END = offsetof(FNormalVertex, Normal) + sizeof(FVector);
+	static constexpr size_t TEX_COORD_END = offsetof(FNormalVertex, TexCoord) + sizeof(FVector2);
+};
+
+// 패딩 위치가 바뀌면 ZeroPadding과 COOKED_MESH_VERSION도 함께 고쳐야 한다
+static_assert(offsetof(FNormalVertex, Position) == 0 && offsetof(FNormalVertex, Normal) == 12 &&
+	offsetof(FNormalVertex, Color) == 32 && offsetof(FNormalVertex, TexCoord) == 48 && sizeof(FNormalVertex) == 64,
+	"FNormalVertex layout changed; update TBulkSerializePadding<FNormalVertex>");
+
 struct FArchive
 {
 	virtual ~FArchive() = default;
@@ -13,6 +67,18 @@ struct FArchive
 	virtual bool IsLoading() const = 0;
 	virtual void Serialize(void* V, size_t Length) = 0;
 
+	/** 지금까지 읽거나 쓴 바이트 수 */
+	virtual uint64 Tell() const = 0;
+
+	/**
+	 * @brief 현재 위치부터 Length바이트를 복사하지 않고 가리키는 포인터를 반환하고 위치를 Length만큼 옮긴다
+	 * 메모리 매핑 Archive만 지원하며, 지원하지 않거나 범위를 벗어나면 nullptr
+	 */
+	virtual const void* MapBytes(size_t Length) { return nullptr; }
+
+	/** false면 TCanBulkSerialize 타입의 TArray도 원소 단위로 직렬화한다 (Archive 생성 시 정해지며, 같은 설정으로 저장한 파일만 읽을 수 있다) */
+	bool IsBulkSerializeAllowed() const { return bAllowBulkSerialize; }
+
 	template<typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
 	FArchive& operator<<(T& Value)
 	{
@@ -20,8 +86,8 @@ struct FArchive
 		return *this;
 	}
 
-	template<typename T>
-	FArchive& operator<<(TArray<T>& Value)
+	template<typename T, typename Alloc>
+	FArchive& operator<<(TArray<T, Alloc>& Value)
 	{
 		size_t Length = Value.size();
 		*this << Length;
@@ -31,6 +97,25 @@ struct FArchive
 			Value.resize(Length);
 		}
 
+		if constexpr (TCanBulkSerialize<T>::value)
+		{
+			if (bAllowBulkSerialize)
+			{
+				if (IsLoading())
+				{
+					if (Length > 0)
+					{
+						Serialize(Value.data(), Length * sizeof(T));
+					}
+				}
+				else
+				{
+					WriteBulk(Value.data(), Length);
+				}
+				return *this;
+			}
+		}
+
 		for (T& Element : Value)
 		{
 			*this << Element;
@@ -39,6 +124,47 @@ struct FArchive
 		return *this;
 	}
 
+	/**
+	 * @brief 길이 뒤에 alignof(T) 경계로 맞춘 원소 배열을 직렬화 (메모리 매핑 상태로 바로 참조할 수 있는 레이아웃)
+	 * 저장 시에는 InOutView의 내용을 기록한다. 로드 시 MapBytes를 지원하면 InOutView가 매핑된 데이터를 가리키고
+	 * InOutStorage는 비워 두며, 그렇지 않으면 InOutStorage로 읽은 뒤 InOutView가 이를 가리킨다
+	 */
+	template<typename T>
+	void SerializeAlignedArray(TArray<T>& InOutStorage, TConstArrayView<T>& InOutView)
+	{
+		static_assert(TCanBulkSerialize<T>::value, "SerializeAlignedArray requires a bulk-serializable element type");
+
+		size_t Length = InOutView.size();
+		*this << Length;
+
+		uint8 Padding[alignof(T)] = {};
+		const size_t PaddingLength = static_cast<size_t>((alignof(T) - Tell() % alignof(T)) % alignof(T));
+		if (PaddingLength > 0)
+		{
+			Serialize(Padding, PaddingLength);
+		}
+
+		if (!IsLoading())
+		{
+			WriteBulk(InOutView.data(), Length);
+			return;
+		}
+
+		if (const void* MappedData = MapBytes(Length * sizeof(T)))
+		{
+			TArray<T>().swap(InOutStorage);
+			InOutView = TConstArrayView<T>(static_cast<const T*>(MappedData), Length);
+			return;
+		}
+
+		InOutStorage.resize(Length);
+		if (Length > 0)
+		{
+			Serialize(InOutStorage.data(), Length * sizeof(T));
+		}
+		InOutView = InOutStorage;
+	}
+
 	FArchive& operator<<(FString& Value)
 	{
 		size_t Length = Value.size();
@@ -56,4 +182,42 @@ struct FArchive
 
 		return *this;
 	}
+protected:
+	FArchive() = default;
+	explicit FArchive(bool bInAllowBulkSerialize)
+		: bAllowBulkSerialize(bInAllowBulkSerialize)
+	{
+	}
+
+private:
+	/**
+	 * @brief TCanBulkSerialize 타입 배열을 한 번에 기록. 패딩이 있는 타입은 복사본의 패딩을 0으로 지운 뒤 나누어 기록한다
+	 */
+	template<typename T>
+	void WriteBulk(const T* InData, size_t InLength)
+	{
+		if (InLength == 0) { return; }
+
+		if constexpr (!TBulkSerializePadding<T>::bHasPadding)
+		{
+			Serialize(const_cast<T*>(InData), InLength * sizeof(T));
+		}
+		else
+		{
+			constexpr size_t CHUNK_LENGTH = 256;
+			T Chunk[CHUNK_LENGTH];
+			for (size_t Offset = 0; Offset < InLength; Offset += CHUNK_LENGTH)
+			{
+				const size_t ChunkLength = std::min(CHUNK_LENGTH, InLength - Offset);
+				std::copy_n(InData + Offset, ChunkLength, Chunk);
+				for (size_t Index = 0; Index < ChunkLength; ++Index)
+				{
+					TBulkSerializePadding<T>::ZeroPadding(Chunk[Index]);
+				}
+				Serialize(Chunk, ChunkLength * sizeof(T));
+			}
+		}
+	}
+
+	const bool bAllowBulkSerialize = true;
 };
@@ -6,6 +6,8 @@ class UObject;
 /**
  * @brief UClass Metadata System
  * Runtime에 컴파일 시에 다양한 클래스 정보를 제공하기 위해 만들어진 클래스
+ * 생성 시 한 번만 등록되며, 등록된 클래스 트리의 전위 순회 순서로 [ClassTreeIndex, ClassTreeLastIndex] 범위를 부여받아
+ * IsChildOf를 부모 체인 탐색 없이 정수 비교 두 번으로 처리한다
  * @param ClassName 클래스 이름
  * @param SuperClass 부모 클래스
  * @param ClassSize 클래스 크기
@@ -19,9 +21,26 @@ public:
 public:
     static void SignUpClass(TObjectPtr<UClass> InClass);
     static TObjectPtr<UClass> FindClass(const FName& InClassName);
+
+    // 클래스 트리 전위 순서로 정렬된 전체 클래스 (한 클래스의 하위 트리는 [ClassTreeIndex, ClassTreeLastIndex] 연속 구간)
+    static const TArray<UClass*>& GetClassesInTreeOrder();
 private:
     static TArray<TObjectPtr<UClass>>& GetAllClasses();
-    
+    static TArray<UClass*>& GetClassTreeOrder();
+
+    /**
+     * @brief 등록된 클래스 트리를 전위 순회하며 각 클래스에 자신과 모든 하위 클래스를 덮는 인덱스 범위를 부여
+     */
+    static void UpdateClassTree();
+    static int32 AssignClassTreeRange(UClass* InClass, const TMap<const UClass*, TArray<UClass*>>& InChildren, int32 InNextIndex);
+
+    // 새 클래스가 등록되어 범위를 다시 계산해야 하는지 여부
+    static bool bIsClassTreeDirty;
+
+    // 클래스별 객체 목록의 머리/꼬리는 FUObjectArray가 관리
+    friend class FUObjectArray;
+    friend void RunCastBenchmark(const TArray<UObject*>& InObjects, const TArray<UClass*>& InTargetClasses);
+
 public:
     UClass(const FName& InName, TObjectPtr<UClass> InSuperClass, size_t InClassSize, ClassConstructorType InConstructor);
 
@@ -29,8 +48,34 @@ public:
     const FName& GetName() const { return ClassName; }
     TObjectPtr<UClass> GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
+    int32 GetClassTreeIndex() const { return ClassTreeIndex; }
+    int32 GetClassTreeLastIndex() const { return ClassTreeLastIndex; }
+
+    // 정확히 이 클래스인(하위 클래스 제외) 객체 목록의 첫 FUObjectArray 칸과 객체 수 (다음 순회 시작 전에 생성된 객체는 아직 포함되지 않음)
+    int32 GetFirstObjectIndex() const { return FirstObjectIndex; }
+    int32 GetObjectCount() const { return ObjectCount; }
     
-    bool IsChildOf(TObjectPtr<UClass> InClass) const;
+    /**
+     * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
+     * @param InClass 확인할 클래스
+     * @return 하위 클래스이거나 같은 클래스면 true
+     */
+    bool IsChildOf(TObjectPtr<UClass> InClass) const
+    {
+        if (!InClass)
+        {
+            return false;
+        }
+
+        if (bIsClassTreeDirty)
+        {
+            UpdateClassTree();
+        }
+
+        // 하위 클래스의 인덱스는 항상 부모 클래스의 범위 안에 있다
+        return InClass->ClassTreeIndex <= ClassTreeIndex && ClassTreeIndex <= InClass->ClassTreeLastIndex;
+    }
+
     TObjectPtr<UObject> CreateDefaultObject() const;
 
 
@@ -39,8 +84,23 @@ private:
     TObjectPtr<UClass> SuperClass;
     size_t ClassSize;
     ClassConstructorType Constructor;
+
+    // 클래스 트리 전위 순회 순서와, 마지막 하위 클래스의 순서
+    int32 ClassTreeIndex = 0;
+    int32 ClassTreeLastIndex = -1;
+
+    // 이 클래스 객체들의 연결 리스트 (FUObjectItem::PrevIndex/NextIndex로 이어짐)
+    int32 FirstObjectIndex = -1;
+    int32 LastObjectIndex = -1;
+    int32 ObjectCount = 0;
 };
 
+/**
+ * @brief InObjects 각각을 InTargetClasses 순서대로 IsA 검사하여 처음 일치하는 클래스를 찾는 처리량(URenderer::RenderLevel의 Cast 분기와 같은 형태)을
+ * 기존 방식(StaticClass 호출마다 등록 목록 선형 탐색 + 부모 체인을 따라 이름 비교)과 비교하여 로그로 출력
+ */
+void RunCastBenchmark(const TArray<UObject*>& InObjects, const TArray<UClass*>& InTargetClasses);
+
 /**
  * @brief RTTI 매크로 시스템
  *
@@ -68,14 +128,13 @@ static UObject* CreateDefaultObject##ClassName();
 #define IMPLEMENT_CLASS(ClassName, SuperClassName) \
 UClass* ClassName::StaticClass() \
 { \
-/* 정적 지역 변수를 사용하여 UClass 객체를 자동 관리 */ \
+/* 정적 지역 변수를 사용하여 UClass 객체를 자동 관리 (등록은 UClass 생성자에서 한 번만 수행) */ \
     static UClass Instance( \
         FString(#ClassName), \
         SuperClassName::StaticClass(), \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -114,14 +173,13 @@ private: \
 #define IMPLEMENT_SINGLETON_CLASS(ClassName, SuperClassName) \
 UClass* ClassName::StaticClass() \
 { \
-    /* 정적 지역 변수를 사용하여 UClass 객체를 자동 관리 */ \
+    /* 정적 지역 변수를 사용하여 UClass 객체를 자동 관리 (등록은 UClass 생성자에서 한 번만 수행) */ \
     static UClass Instance( \
         FString(#ClassName), \
         SuperClassName::StaticClass(), \
         sizeof(ClassName), \
         nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -179,7 +237,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
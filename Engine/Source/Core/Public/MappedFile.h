@@ -0,0 +1,34 @@
+#pragma once
+
+#include <filesystem>
+
+/**
+ * @brief 파일 전체를 읽기 전용으로 메모리에 매핑 (Win32 File Mapping)
+ * 매핑 시점에는 파일을 읽지 않으며, 페이지는 처음 접근할 때 OS가 읽어 들인다
+ * 매핑된 페이지는 파일을 백업 저장소로 쓰므로 메모리가 부족하면 OS가 쓰기 없이 회수할 수 있다
+ * @note 매핑이 유지되는 동안에는 같은 파일을 덮어쓸 수 없다
+ */
+class FMappedFile
+{
+public:
+	FMappedFile() = default;
+	~FMappedFile();
+
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	/**
+	 * @brief 파일을 열어 전체를 매핑 (이미 매핑 중이면 먼저 해제)
+	 * @return 빈 파일이거나 열기/매핑에 실패하면 false
+	 */
+	bool Open(const std::filesystem::path& FilePath);
+	void Close();
+
+	bool IsOpen() const { return Data != nullptr; }
+	const uint8* GetData() const { return Data; }
+	size_t GetSize() const { return Size; }
+
+private:
+	const uint8* Data = nullptr;
+	size_t Size = 0;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstring>
+
+#include "Core/Public/Archive.h"
+#include "Global/Macro.h"
+
+/**
+ * @brief 메모리에 올라와 있는 바이트 배열에서 역직렬화하는 Archive
+ * 파일을 한 번에 읽거나 매핑한 뒤 파싱할 때 사용하며, 범위를 벗어난 읽기는 0으로 채우고 IsError()로 알린다
+ */
+struct FMemoryReader : public FArchive
+{
+	explicit FMemoryReader(const TArray<uint8>& InBytes)
+		: FMemoryReader(InBytes.data(), InBytes.size())
+	{
+	}
+
+	/**
+	 * @param bInIsPersistent 메모리가 읽어 들인 객체보다 오래 유지되면(FMappedFile 등) true. MapBytes로 복사 없이 참조할 수 있다
+	 */
+	FMemoryReader(const uint8* InData, size_t InSize, bool bInIsPersistent = false)
+		: Data(InData)
+		, Size(InSize)
+		, bIsPersistent(bInIsPersistent)
+	{
+	}
+
+	bool IsLoading() const override { return true; }
+
+	void Serialize(void* V, size_t Length) override
+	{
+		if (!CheckRange(Length))
+		{
+			memset(V, 0, Length);
+			return;
+		}
+
+		memcpy(V, Data + Offset, Length);
+		Offset += Length;
+	}
+
+	uint64 Tell() const override { return Offset; }
+
+	const void* MapBytes(size_t Length) override
+	{
+		if (!bIsPersistent || !CheckRange(Length))
+		{
+			return nullptr;
+		}
+
+		const void* MappedData = Data + Offset;
+		Offset += Length;
+		return MappedData;
+	}
+
+	bool IsError() const { return bIsError; }
+	bool IsAtEnd() const { return Offset == Size; }
+
+private:
+	bool CheckRange(size_t Length)
+	{
+		if (bIsError || Length > Size - Offset)
+		{
+			if (!bIsError)
+			{
+				UE_LOG_ERROR("메모리 읽기 범위를 벗어났습니다: %zu + %zu > %zu", Offset, Length, Size);
+			}
+			bIsError = true;
+			return false;
+		}
+		return true;
+	}
+
+	const uint8* Data;
+	size_t Size;
+	size_t Offset = 0;
+	bool bIsPersistent;
+	bool bIsError = false;
+};
@@ -1,4 +1,6 @@
 #pragma once
+#include <mutex>
+#include <string_view>
 
 /**
  * @brief 오브젝트의 이름을 담당하는 구조체
@@ -12,6 +14,7 @@ public:
 	FName();
 	FName(const FString& Str);
 	FName(const char* Str);
+	explicit FName(std::string_view Str);
 	FName(int32 InComparisonIndex, int32 InDisplayIndex, int32 InNumber);
 
 	bool operator==(const FName& Other) const;
@@ -54,6 +57,12 @@ namespace std {
 }
 
 
+/**
+ * @brief FName 문자열 테이블
+ * 이름마다 대소문자를 무시한 해시와 원본 해시를 한 번에 계산해 두고, 인덱스만 담는 개방 주소 해시 테이블로 조회하므로
+ * 조회 과정에서 소문자 사본 같은 임시 문자열을 만들지 않는다 (새 이름을 등록할 때만 문자열을 저장)
+ * 0번은 None으로 예약되어 있다
+ */
 class FNameTable
 {
 public:
@@ -62,18 +71,45 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
-	TPair<int32, int32> FindOrAddName(const FString& Str);
-	FName GetUniqueName(const FString& BaseStr);
+	TPair<int32, int32> FindOrAddName(std::string_view Str);
+
+	/**
+	 * @brief BaseName과 같은 이름(대소문자 무시)에 붙일 다음 번호를 증가시켜 고유한 이름을 반환
+	 * 이름 문자열을 다시 만들거나 찾지 않는 O(1) 처리
+	 */
+	FName GetUniqueName(const FName& BaseName);
 
 	FString GetDisplayString(int32 Idx) const;
+	int32 GetDisplayNameCount() const;
 
 private:
-	static FString ToLower(const FString& Str);
+	// 해시 테이블 한 칸: 문자열 풀의 인덱스와 그 문자열의 해시 (Index가 -1이면 빈 칸)
+	struct FNameHashSlot
+	{
+		uint32 Hash = 0;
+		int32 Index = -1;
+	};
+
+	static void AddSlot(TArray<FNameHashSlot>& InOutSlots, uint32 InHash, int32 InIndex, int32 InCount);
+	int32 AddComparisonName(std::string_view Str, uint32 Hash);
+	int32 AddDisplayName(std::string_view Str, uint32 Hash);
 
+	// Asset 로드 Worker 스레드에서도 FName을 만들 수 있도록 테이블 접근을 직렬화
+	mutable std::mutex TableMutex;
+
+	// 비교용 이름은 소문자로 저장
 	TArray<FString> ComparisonStringPool;
 	TArray<FString> DisplayStringPool;
 
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
-};
\ No newline at end of file
+	TArray<FNameHashSlot> ComparisonSlots;
+	TArray<FNameHashSlot> DisplaySlots;
+
+	// ComparisonIndex별로 GetUniqueName이 다음에 붙일 번호
+	TArray<int32> NextNumbers;
+};
+
+/**
+ * @brief 이름 문자열로 FName을 만드는 비용(레벨 로드)과 클래스 이름으로 고유 이름을 만드는 비용(NewObject)을
+ * 기존 방식(소문자 사본 + TMap<FString, int32> 조회, 클래스 이름 ToString 후 번호 TMap 조회)과 비교하여 로그로 출력
+ */
+void RunNameBenchmark(int32 InCount);
@@ -2,6 +2,7 @@
 #include "Class.h"
 #include "Name.h"
 #include "ObjectPtr.h"
+#include "Global/ObjectPool.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -18,21 +19,55 @@ public:
 	explicit UObject(const FName& InName);
 	virtual ~UObject();
 
+	// 메모리 할당: UObject 파생 객체는 크기별 슬랩 풀에서 할당 (가상 소멸자 덕분에 sized delete가 동적 타입의 크기를 넘겨준다)
+	static void* operator new(size_t InSize)
+	{
+		return FObjectPoolAllocator::Allocate(InSize);
+	}
+
+	static void operator delete(void* InMemory, size_t InSize)
+	{
+		FObjectPoolAllocator::Free(InMemory, InSize);
+	}
+
+	static void* operator new(size_t InSize, std::align_val_t InAlignment)
+	{
+		if (static_cast<size_t>(InAlignment) <= FObjectPoolAllocator::POOL_ALIGNMENT)
+		{
+			return FObjectPoolAllocator::Allocate(InSize);
+		}
+		return ::operator new(InSize, InAlignment);
+	}
+
+	static void operator delete(void* InMemory, size_t InSize, std::align_val_t InAlignment)
+	{
+		if (static_cast<size_t>(InAlignment) <= FObjectPoolAllocator::POOL_ALIGNMENT)
+		{
+			FObjectPoolAllocator::Free(InMemory, InSize);
+			return;
+		}
+		::operator delete(InMemory, InAlignment);
+	}
+
+	static void* operator new(size_t InSize, void* InPlace) { return InPlace; }
+	static void operator delete(void* InMemory, void* InPlace) {}
+
 	// 2. 가상 함수 (인터페이스)
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
 
 	// 3. Public 멤버 함수
-	bool IsA(TObjectPtr<UClass> InClass) const;
+	// 해당 클래스가 내 클래스이거나 조상 클래스인지 판단 (UClass의 클래스 트리 범위 비교만 수행하므로 인라인)
+	bool IsA(TObjectPtr<UClass> InClass) const
+	{
+		return InClass && GetClass()->IsChildOf(InClass);
+	}
 	bool IsExactly(TObjectPtr<UClass> InClass) const;
-	void AddMemoryUsage(uint64 InBytes, uint32 InCount);
-	void RemoveMemoryUsage(uint64 InBytes, uint32 InCount);
 
 	// Getter & Setter
 	const FName& GetName() const { return Name; }
 	UObject* GetOuter() const { return Outer.Get(); }
-	uint64 GetAllocatedBytes() const { return AllocatedBytes; }
-	uint32 GetAllocatedCount() const { return AllocatedCounts; }
 	uint32 GetUUID() const { return UUID; }
+	int32 GetInternalIndex() const { return InternalIndex; }
 
 	FName GetName() { return Name; }
 	void SetName(const FName& InName) { Name = InName; }
@@ -48,17 +83,12 @@ protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject);
 
 private:
-	// 4. Private 멤버 함수
-	void PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta);
-
-private:
-	// 5. Private 멤버 변수
+	// 4. Private 멤버 변수
 	uint32 UUID;
-	uint32 InternalIndex;
+	// GUObjectArray에서 이 객체가 차지한 칸 (삭제되면 다른 객체가 재사용)
+	int32 InternalIndex;
 	FName Name;
 	TObjectPtr<UObject> Outer;
-	uint64 AllocatedBytes = 0;
-	uint32 AllocatedCounts = 0;
 };
 
 /**
@@ -233,5 +263,3 @@ bool IsValid(const TObjectPtr<U>& InObjectPtr)
 {
 	return InObjectPtr && IsA<T>(InObjectPtr);
 }
-
-TArray<TObjectPtr<UObject>>& GetUObjectArray();
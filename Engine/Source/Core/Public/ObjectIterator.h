@@ -1,35 +1,73 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+#include "Core/Public/UObjectArray.h"
+
+/**
+ * @brief InClass와 그 하위 클래스의 객체를 순회하는 반복자
+ * 클래스 트리 전위 순서에서 InClass의 하위 트리는 연속 구간이므로, 그 구간의 클래스별 객체 목록을 차례로 따라간다
+ */
+class FClassObjectIterator
+{
+public:
+	explicit FClassObjectIterator(UClass* InClass);
+	FClassObjectIterator(const FClassObjectIterator& Other);
+	FClassObjectIterator& operator=(const FClassObjectIterator& Other) = default;
+	~FClassObjectIterator();
+
+	explicit operator bool() const
+	{
+		return CurrentObject != nullptr;
+	}
+
+	UObject* GetObject() const
+	{
+		return CurrentObject;
+	}
+
+	FClassObjectIterator& operator++()
+	{
+		AdvanceToNextValidObject();
+		return *this;
+	}
+
+private:
+	void AdvanceToNextValidObject();
+
+	FUObjectArray* ObjectArray;
+	const TArray<UClass*>* Classes;
+	int32 ClassIndex;
+	int32 LastClassIndex;
+	int32 NextObjectIndex = -1;
+	UObject* CurrentObject = nullptr;
+};
+
 template<typename TObject>
 class TObjectIterator
 {
 public:
-	TObjectIterator() : UObjectArray(GetUObjectArray())
+	TObjectIterator() : Iterator(TObject::StaticClass())
 	{
-		CurrentIndex = 0;
-		AdvanceToNextValidObject();
 	}
 
 	explicit operator bool() const
 	{
-		return CurrentObject != nullptr;
+		return static_cast<bool>(Iterator);
 	}
 
 	TObject* operator*() const
 	{
-		return CurrentObject;
+		return static_cast<TObject*>(Iterator.GetObject());
 	}
 
 	TObject* operator->() const
 	{
-		return CurrentObject;
+		return static_cast<TObject*>(Iterator.GetObject());
 	}
 
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
-		AdvanceToNextValidObject();
+		++Iterator;
 		return *this;
 	}
 
@@ -42,30 +80,19 @@ public:
 
 	bool operator==(const TObjectIterator& Other) const
 	{
-		return CurrentObject == Other.CurrentObject;
+		return Iterator.GetObject() == Other.Iterator.GetObject();
 	}
 
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentObject != Other.CurrentObject;
+		return Iterator.GetObject() != Other.Iterator.GetObject();
 	}
 private:
-	void AdvanceToNextValidObject()
-	{
-		CurrentObject = nullptr;
-		while (CurrentIndex < UObjectArray.size())
-		{
-			UObject* Obj = UObjectArray[CurrentIndex];
-			if (Obj && Obj->IsA(TObject::StaticClass()))
-			{
-				CurrentObject = Cast<TObject>(Obj);
-				return;
-			}
-			++CurrentIndex;
-		}
-	}
-
-	int32 CurrentIndex;
-	TObject* CurrentObject = nullptr;
-	TArray<TObjectPtr<UObject>>& UObjectArray;
+	FClassObjectIterator Iterator;
 };
+
+/**
+ * @brief InClasses 각각의 인스턴스를 기존 방식(GUObjectArray 전체를 훑으며 IsA 검사)과
+ * 클래스별 객체 목록 순회로 세어 시간을 비교하여 로그로 출력
+ */
+void RunObjectIteratorBenchmark(const TArray<UClass*>& InClasses);
@@ -0,0 +1,80 @@
+#pragma once
+
+class UObject;
+class UClass;
+
+/**
+ * @brief FUObjectArray의 한 칸
+ * 사용 중인 칸은 같은 클래스의 객체끼리 PrevIndex/NextIndex로 이어지고, 빈 칸은 NextIndex로 빈 칸 목록을 이룬다
+ */
+struct FUObjectItem
+{
+	UObject* Object = nullptr;
+	// 칸이 해제될 때마다 증가하여, 재사용된 칸을 가리키는 오래된 FObjectHandle을 구별한다
+	uint32 Generation = 0;
+	int32 PrevIndex = -1;
+	int32 NextIndex = -1;
+	// 객체가 연결된 클래스 목록 (아직 연결 전이면 nullptr)
+	UClass* ListedClass = nullptr;
+};
+
+/**
+ * @brief 슬롯 인덱스와 세대로 객체를 가리키는 약한 핸들
+ * 객체가 삭제된 뒤 같은 칸이 재사용되어도 세대가 달라 Resolve가 nullptr을 반환한다
+ */
+struct FObjectHandle
+{
+	int32 Index = -1;
+	uint32 Generation = 0;
+};
+
+/**
+ * @brief 모든 UObject를 담는 전역 객체 테이블
+ * 삭제된 객체의 칸은 빈 칸 목록으로 재사용하고, 객체를 UClass별 연결 리스트로 묶어 두어
+ * TObjectIterator<T>가 T 하위 트리 클래스들의 목록만 따라가도록 한다 (비용이 전체 객체 수가 아닌 T 인스턴스 수에 비례)
+ * @note 생성자 안에서는 객체의 실제 클래스를 알 수 없으므로 새 객체는 대기 목록에 두었다가 순회를 시작할 때 클래스 목록에 연결하며,
+ * 순회 중에 삭제된 객체는 칸만 비워 두고 마지막 순회가 끝날 때 목록에서 떼어 낸다. 게임 스레드에서만 사용한다
+ */
+class FUObjectArray
+{
+public:
+	int32 AllocateSlot(UObject* InObject);
+	void FreeSlot(int32 InIndex);
+
+	const FUObjectItem& GetItem(int32 InIndex) const { return Items[InIndex]; }
+	int32 GetSlotCount() const { return static_cast<int32>(Items.size()); }
+	int32 GetObjectCount() const { return ObjectCount; }
+
+	FObjectHandle MakeHandle(const UObject* InObject) const;
+	UObject* Resolve(const FObjectHandle& InHandle) const;
+
+	/**
+	 * @brief TObjectIterator가 생성/소멸될 때 호출
+	 * 가장 바깥 순회가 시작될 때 대기 중인 객체를 클래스 목록에 연결하고, 끝날 때 미뤄 둔 칸 해제를 처리한다
+	 */
+	void BeginIteration();
+	void EndIteration();
+
+private:
+	void FlushPendingObjects();
+	void PrunePendingObjects();
+	void LinkObject(int32 InIndex, UClass* InClass);
+	void UnlinkObject(int32 InIndex);
+	void ReleaseSlot(int32 InIndex);
+
+	TArray<FUObjectItem> Items;
+	int32 FirstFreeIndex = -1;
+	int32 ObjectCount = 0;
+	int32 IterationDepth = 0;
+
+	// 아직 클래스 목록에 연결되지 않은 객체 (생성 순서 유지)
+	TArray<FObjectHandle> PendingObjects;
+	// PendingObjects 중 이미 삭제된 객체의 수 (정리 시점 판단용)
+	int32 StalePendingCount = 0;
+	// 직전 연결에서 목록에 넣은 객체: 생성 도중에 연결되어 부모 클래스 목록에 들어갔을 수 있으므로 다음 연결 때 클래스를 다시 확인한다
+	TArray<FObjectHandle> RecentlyLinkedObjects;
+	// 순회 중에 삭제되어 목록에서 떼어 내기를 미룬 칸
+	TArray<int32> DeferredFreeIndices;
+};
+
+FUObjectArray& GetUObjectArray();
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
 #include "Core/Public/Archive.h"
 #include "Global/Macro.h"
 
+/**
+ * @brief 파일에서 역직렬화하는 Archive
+ * 작은 Serialize 요청은 BufferSize 단위로 미리 읽어 둔 버퍼에서 복사하고, 버퍼보다 큰 요청은 파일에서 바로 읽는다
+ * BufferSize가 0이면 요청마다 파일을 직접 읽는다. 읽기에 실패하면 나머지를 0으로 채우고 IsError()로 알린다
+ */
 struct FWindowsBinReader : public FArchive
 {
+	static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
 	virtual ~FWindowsBinReader()
 	{
 		if (Stream.is_open())
@@ -16,13 +24,19 @@ struct FWindowsBinReader : public FArchive
 		}
 	}
 
-	FWindowsBinReader(const std::filesystem::path& FilePath)
-		: Stream(FilePath, std::ios::binary | std::ios::in)
+	/**
+	 * @param bInAllowBulkSerialize false면 배열을 원소 단위로 읽음 (저장할 때와 같은 설정이어야 한다)
+	 */
+	FWindowsBinReader(const std::filesystem::path& FilePath, size_t InBufferSize = DEFAULT_BUFFER_SIZE, bool bInAllowBulkSerialize = true)
+		: FArchive(bInAllowBulkSerialize)
+		, Stream(FilePath, std::ios::binary | std::ios::in)
+		, Buffer(InBufferSize)
 	{
 		if (!Stream)
 		{
-			UE_LOG_ERROR("읽기용 파일을 여는데 실패했습니다: %s", FilePath.string());
+			UE_LOG_ERROR("읽기용 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
 			//assert("읽기용 파일을 여는데 실패했습니다" && false);
+			bIsError = true;
 		}
 	}
 
@@ -30,15 +44,79 @@ struct FWindowsBinReader : public FArchive
 
 	void Serialize(void* V, size_t Length) override
 	{
-		Stream.read(reinterpret_cast<char*>(V), Length);
-		if (!Stream)
+		uint8* Dest = static_cast<uint8*>(V);
+		Position += Length;
+		if (bIsError)
+		{
+			memset(Dest, 0, Length);
+			return;
+		}
+
+		// 1. 버퍼에 남은 데이터부터 소비
+		const size_t Available = BufferEnd - BufferOffset;
+		if (Length <= Available)
+		{
+			memcpy(Dest, Buffer.data() + BufferOffset, Length);
+			BufferOffset += Length;
+			return;
+		}
+
+		memcpy(Dest, Buffer.data() + BufferOffset, Available);
+		Dest += Available;
+		Length -= Available;
+		BufferOffset = BufferEnd = 0;
+
+		// 2. 버퍼보다 큰 요청은 버퍼를 거치지 않고 바로 읽기
+		if (Length >= Buffer.size())
+		{
+			Stream.read(reinterpret_cast<char*>(Dest), Length);
+			if (!Stream)
+			{
+				const size_t ReadLength = static_cast<size_t>(Stream.gcount());
+				memset(Dest + ReadLength, 0, Length - ReadLength);
+				SetError();
+			}
+			return;
+		}
+
+		// 3. 버퍼를 다시 채운 뒤 복사 (파일 끝에서는 버퍼가 다 차지 않을 수 있음)
+		Stream.read(reinterpret_cast<char*>(Buffer.data()), Buffer.size());
+		BufferEnd = static_cast<size_t>(Stream.gcount());
+		if (BufferEnd < Length)
 		{
-			UE_LOG_ERROR("파일 읽기를 실패했습니다.");
-			//assert("파일 읽기를 실패했습니다." && false);
+			memcpy(Dest, Buffer.data(), BufferEnd);
+			memset(Dest + BufferEnd, 0, Length - BufferEnd);
+			BufferOffset = BufferEnd;
+			SetError();
+			return;
 		}
+
+		memcpy(Dest, Buffer.data(), Length);
+		BufferOffset = Length;
+	}
+
+	uint64 Tell() const override { return Position; }
+
+	bool IsError() const { return bIsError; }
+
+	// 버퍼와 파일에 더 읽을 데이터가 없으면 true
+	bool IsAtEnd()
+	{
+		return BufferOffset == BufferEnd && Stream.peek() == std::ifstream::traits_type::eof();
 	}
 
 private:
+	void SetError()
+	{
+		UE_LOG_ERROR("파일 읽기를 실패했습니다.");
+		//assert("파일 읽기를 실패했습니다." && false);
+		bIsError = true;
+	}
+
 	std::ifstream Stream;
+	TArray<uint8> Buffer;
+	size_t BufferOffset = 0;
+	size_t BufferEnd = 0;
+	uint64 Position = 0;
+	bool bIsError = false;
 };
-
@@ -1,34 +1,84 @@
 #pragma once
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 
 #include "Core/Public/Archive.h"
 #include "Global/Macro.h"
 
+/**
+ * @brief 파일로 직렬화하는 Archive
+ * 작은 Serialize 요청은 BufferSize만큼 모아서 한 번에 쓰고, 버퍼보다 큰 요청은 버퍼를 비운 뒤 파일에 바로 쓴다
+ * BufferSize가 0이면 요청마다 파일에 직접 쓴다. 남은 데이터는 Flush 또는 소멸자에서 기록된다
+ */
 struct FWindowsBinWriter : public FArchive
 {
+	static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
 	virtual ~FWindowsBinWriter()
 	{
 		if (Stream.is_open())
 		{
+			Flush();
 			Stream.close();
 		}
 	}
 
-	FWindowsBinWriter(const std::filesystem::path& FilePath)
-		: Stream(FilePath, std::ios::binary | std::ios::out)
+	/**
+	 * @param bInAllowBulkSerialize false면 배열을 원소 단위로 기록 (같은 설정의 FWindowsBinReader로 읽어야 한다)
+	 */
+	FWindowsBinWriter(const std::filesystem::path& FilePath, size_t InBufferSize = DEFAULT_BUFFER_SIZE, bool bInAllowBulkSerialize = true)
+		: FArchive(bInAllowBulkSerialize)
+		, Stream(FilePath, std::ios::binary | std::ios::out)
 	{
 		if (!Stream)
 		{
-			UE_LOG_ERROR("쓰기용 파일을 여는데 실패했습니다: %s", FilePath.string());
+			UE_LOG_ERROR("쓰기용 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
 			assert("쓰기용 파일을 여는데 실패했습니다" && false);
 		}
+
+		Buffer.reserve(InBufferSize);
 	}
 
 	bool IsLoading() const override { return false; }
 
 	void Serialize(void* V, size_t Length) override
+	{
+		Position += Length;
+		if (Buffer.size() + Length <= Buffer.capacity())
+		{
+			const size_t Offset = Buffer.size();
+			Buffer.resize(Offset + Length);
+			memcpy(Buffer.data() + Offset, V, Length);
+			return;
+		}
+
+		Flush();
+		if (Length < Buffer.capacity())
+		{
+			Buffer.resize(Length);
+			memcpy(Buffer.data(), V, Length);
+			return;
+		}
+
+		Write(V, Length);
+	}
+
+	uint64 Tell() const override { return Position; }
+
+	// 버퍼에 모아 둔 데이터를 파일에 기록
+	void Flush()
+	{
+		if (!Buffer.empty())
+		{
+			Write(Buffer.data(), Buffer.size());
+			Buffer.clear();
+		}
+	}
+
+private:
+	void Write(const void* V, size_t Length)
 	{
 		Stream.write(reinterpret_cast<const char*>(V), Length);
 		if (!Stream)
@@ -38,6 +88,7 @@ struct FWindowsBinWriter : public FArchive
 		}
 	}
 
-private:
 	std::ofstream Stream;
+	TArray<uint8> Buffer;
+	uint64 Position = 0;
 };
@@ -427,21 +427,12 @@ void UEditor::ProcessMouseInput()
 		{
 			if (GWorld->GetLevel()->GetShowFlags() & EEngineShowFlags::SF_Primitives)
 			{
-				TArray<UPrimitiveComponent*> Candidate;
-
 				ULevel* CurrentLevel = GWorld->GetLevel();
-				ObjectPicker.FindCandidateFromOctree(CurrentLevel->GetStaticOctree(), WorldRay, Candidate);
-
-				TArray<UPrimitiveComponent*>& DynamicCandidates = CurrentLevel->GetDynamicPrimitives();
-				if (!DynamicCandidates.empty())
-				{
-					Candidate.insert(Candidate.end(), DynamicCandidates.begin(), DynamicCandidates.end());
-				}
-				
 
 				TStatId StatId("Picking");
 				FScopeCycleCounter PickCounter(StatId);
-				UPrimitiveComponent* PrimitiveCollided = ObjectPicker.PickPrimitive(CurrentCamera, WorldRay, Candidate, &ActorDistance);
+				// 씬 BVH 갱신(Refit/재구축)도 피킹 비용에 포함
+				UPrimitiveComponent* PrimitiveCollided = ObjectPicker.PickPrimitive(CurrentCamera, WorldRay, *CurrentLevel->GetSceneBVH(), &ActorDistance);
 				ActorPicked = PrimitiveCollided ? PrimitiveCollided->GetOwner() : nullptr;
 				float ElapsedMs = PickCounter.Finish(); // 피킹 시간 측정 종료
 				UStatOverlay::GetInstance().RecordPickingStats(ElapsedMs);
@@ -9,8 +9,12 @@
 #include "Level/Public/Level.h"
 #include "Global/Quaternion.h"
 #include "Global/Octree.h"
+#include "Global/SceneBVH.h"
 #include "Physics/Public/AABB.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
 
 FRay UObjectPicker::GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive)
 {
@@ -23,7 +27,7 @@ FRay UObjectPicker::GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive)
 	return ModelRay;
 }
 
-UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, TArray<UPrimitiveComponent*> Candidate, float* Distance)
+UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, const TArray<UPrimitiveComponent*>& Candidate, float* Distance)
 {
 	UPrimitiveComponent* ShortestPrimitive = nullptr;
 	float ShortestDistance = D3D11_FLOAT32_MAX;
@@ -49,6 +53,39 @@ UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const
 	return ShortestPrimitive;
 }
 
+UPrimitiveComponent* UObjectPicker::PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, const FSceneBVH& SceneBVH, float* Distance)
+{
+	FSceneRayHit Hit;
+	SceneBVH.IntersectRayClosest(WorldRay, [this, InActiveCamera, &WorldRay](UPrimitiveComponent* Primitive, float& OutDistance)
+	{
+		if (Primitive->GetPrimitiveType() == EPrimitiveType::UUID) { return false; }
+
+		OutDistance = D3D11_FLOAT32_MAX;
+		return IsRayPrimitiveCollided(InActiveCamera, WorldRay, Primitive, Primitive->GetWorldTransformMatrix(), &OutDistance);
+	}, Hit);
+
+	*Distance = Hit.Distance;
+	return Hit.Primitive;
+}
+
+void UObjectPicker::PickPrimitives(UCamera* InActiveCamera, const TArray<FRay>& WorldRays, const FSceneBVH& SceneBVH,
+	TArray<UPrimitiveComponent*>& OutPrimitives, TArray<float>& OutDistances)
+{
+	TArray<FSceneRayHit> Hits;
+	SceneBVH.IntersectRaysClosest(WorldRays, [this, InActiveCamera](UPrimitiveComponent* Primitive, const FRay* PacketRays, uint32 RayMask, float* InOutDistances)
+	{
+		return IntersectPrimitiveRayPacket(InActiveCamera, Primitive, PacketRays, RayMask, InOutDistances);
+	}, Hits);
+
+	OutPrimitives.resize(Hits.size());
+	OutDistances.resize(Hits.size());
+	for (size_t Index = 0; Index < Hits.size(); ++Index)
+	{
+		OutPrimitives[Index] = Hits[Index].Primitive;
+		OutDistances[Index] = Hits[Index].Primitive ? Hits[Index].Distance : D3D11_FLOAT32_MAX;
+	}
+}
+
 void UObjectPicker::PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint)
 {
 	//Forward, Right, Up순으로 테스트할거임.
@@ -181,10 +218,31 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	float Distance = D3D11_FLOAT32_MAX; //Distance 초기화
 	bool bIsHit = false;
 	
-	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
-	const TArray<uint32>* Indices = Primitive->GetIndicesData();
+	const TConstArrayView<FNormalVertex> Vertices = Primitive->GetVerticesData();
+	const TConstArrayView<uint32> Indices = Primitive->GetIndicesData();
 
 	FRay ModelRay = GetModelRay(WorldRay, Primitive);
+
+	// 2-A. QBVH가 있는 Static Mesh는 가장 가까운 교차 하나만 찾는 4-wide 순회로 검사
+	if (const FQBVH* MeshQBVH = GetMeshQBVH(Primitive))
+	{
+		// 모델 공간 Ray 파라미터 T에 대해 월드 공간 이동량은 T * WorldDirection 이므로,
+		// IsRayTriangleCollided의 Near/Far 판정(카메라 전방 성분)을 T의 범위로 바꿔서 넘긴다
+		const FVector4 WorldDirection = ModelRay.Direction * ModelMatrix;
+		const float ForwardPerT = WorldDirection.Dot3(InActiveCamera->GetForward());
+		if (ForwardPerT <= 0.0f)
+		{
+			return false;
+		}
+
+		FBVHRayHit Hit;
+		if (MeshQBVH->IntersectRayClosest(ModelRay, InActiveCamera->GetNearZ() / ForwardPerT, InActiveCamera->GetFarZ() / ForwardPerT, Hit))
+		{
+			*ShortestDistance = std::min(*ShortestDistance, Hit.T * WorldDirection.Length());
+			return true;
+		}
+		return false;
+	}
 	
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
@@ -194,17 +252,17 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 	for (int32 TriIndex : CandidateTriangleIndices)
 	{
 		FVector V0, V1, V2;
-		if (Indices)
+		if (!Indices.empty())
 		{
-			V0 = (*Vertices)[(*Indices)[TriIndex * 3 + 0]].Position;
-			V1 = (*Vertices)[(*Indices)[TriIndex * 3 + 1]].Position;
-			V2 = (*Vertices)[(*Indices)[TriIndex * 3 + 2]].Position;
+			V0 = Vertices[Indices[TriIndex * 3 + 0]].Position;
+			V1 = Vertices[Indices[TriIndex * 3 + 1]].Position;
+			V2 = Vertices[Indices[TriIndex * 3 + 2]].Position;
 		}
 		else
 		{
-			V0 = (*Vertices)[TriIndex * 3 + 0].Position;
-			V1 = (*Vertices)[TriIndex * 3 + 1].Position;
-			V2 = (*Vertices)[TriIndex * 3 + 2].Position;
+			V0 = Vertices[TriIndex * 3 + 0].Position;
+			V1 = Vertices[TriIndex * 3 + 1].Position;
+			V2 = Vertices[TriIndex * 3 + 2].Position;
 		}
 
 		if (IsRayTriangleCollided(InActiveCamera, ModelRay, V0, V1, V2, ModelMatrix, &Distance))
@@ -303,29 +361,99 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
  */
 bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
 {
-	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
+	return Node && Node->FindRayCandidates(WorldRay, OutCandidate);
+}
+
+uint32 UObjectPicker::IntersectPrimitiveRayPacket(UCamera* InActiveCamera, UPrimitiveComponent* Primitive, const FRay* WorldRays, uint32 RayMask,
+	float* InOutDistances)
+{
+	if (Primitive->GetPrimitiveType() == EPrimitiveType::UUID) { return 0; }
 
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingBox()) == false) { return false; }
+	uint32 HitRayMask = 0;
+	const FMatrix ModelMatrix = Primitive->GetWorldTransformMatrix();
+	const FQBVH* MeshQBVH = GetMeshQBVH(Primitive);
+
+	// QBVH가 없으면 Ray마다 기존 정밀 검사
+	if (!MeshQBVH)
+	{
+		for (int32 RayIndex = 0; RayIndex < FQBVH::MAX_RAY_PACKET_SIZE; ++RayIndex)
+		{
+			if (!(RayMask & (1u << RayIndex))) { continue; }
+
+			float Distance = D3D11_FLOAT32_MAX;
+			if (IsRayPrimitiveCollided(InActiveCamera, WorldRays[RayIndex], Primitive, ModelMatrix, &Distance) && Distance < InOutDistances[RayIndex])
+			{
+				InOutDistances[RayIndex] = Distance;
+				HitRayMask |= 1u << RayIndex;
+			}
+		}
+		return HitRayMask;
+	}
 
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.empty())
+	// 1. 역행렬은 한 번만 구하고, Ray마다 모델 공간 Ray와 유효 T 범위를 계산 (IsRayPrimitiveCollided와 같은 Near/Far 판정)
+	// 현재 최단 거리보다 먼 교차는 필요 없으므로 Far를 최단 거리로 더 좁힌다
+	const FMatrix ModelInverse = Primitive->GetWorldTransformMatrixInverse();
+	FRay ModelRays[FQBVH::MAX_RAY_PACKET_SIZE];
+	float MinT[FQBVH::MAX_RAY_PACKET_SIZE];
+	float MaxT[FQBVH::MAX_RAY_PACKET_SIZE];
+	float WorldLengthPerT[FQBVH::MAX_RAY_PACKET_SIZE];
+	int32 RayIndices[FQBVH::MAX_RAY_PACKET_SIZE];
+	int32 PacketRayCount = 0;
+
+	for (int32 RayIndex = 0; RayIndex < FQBVH::MAX_RAY_PACKET_SIZE; ++RayIndex)
 	{
-		OutCandidate.insert(OutCandidate.end(), CurrentNodePrimitives.begin(), CurrentNodePrimitives.end());
+		if (!(RayMask & (1u << RayIndex))) { continue; }
+
+		FRay ModelRay;
+		ModelRay.Origin = WorldRays[RayIndex].Origin * ModelInverse;
+		ModelRay.Direction = WorldRays[RayIndex].Direction * ModelInverse;
+		ModelRay.Direction.Normalize();
+
+		const FVector4 WorldDirection = ModelRay.Direction * ModelMatrix;
+		const float ForwardPerT = WorldDirection.Dot3(InActiveCamera->GetForward());
+		if (ForwardPerT <= 0.0f) { continue; }
+
+		ModelRays[PacketRayCount] = ModelRay;
+		WorldLengthPerT[PacketRayCount] = WorldDirection.Length();
+		MinT[PacketRayCount] = InActiveCamera->GetNearZ() / ForwardPerT;
+		MaxT[PacketRayCount] = std::min(InActiveCamera->GetFarZ() / ForwardPerT, InOutDistances[RayIndex] / WorldLengthPerT[PacketRayCount]);
+		RayIndices[PacketRayCount] = RayIndex;
+		++PacketRayCount;
 	}
+	if (PacketRayCount == 0) { return 0; }
 
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
+	// 2. 패킷 전체를 QBVH 한 번의 순회로 검사
+	FBVHRayHit Hits[FQBVH::MAX_RAY_PACKET_SIZE];
+	MeshQBVH->IntersectRayPacketClosest(ModelRays, MinT, MaxT, PacketRayCount, Hits);
+
+	for (int32 PacketIndex = 0; PacketIndex < PacketRayCount; ++PacketIndex)
 	{
-		for (FOctree* Child : Node->GetChildren())
+		if (Hits[PacketIndex].TriangleIndex < 0) { continue; }
+
+		const int32 RayIndex = RayIndices[PacketIndex];
+		const float Distance = Hits[PacketIndex].T * WorldLengthPerT[PacketIndex];
+		if (Distance < InOutDistances[RayIndex])
 		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
+			InOutDistances[RayIndex] = Distance;
+			HitRayMask |= 1u << RayIndex;
 		}
 	}
+	return HitRayMask;
+}
 
-	return true;
+const FQBVH* UObjectPicker::GetMeshQBVH(UPrimitiveComponent* Primitive)
+{
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		if (StaticMeshComp->GetStaticMesh())
+		{
+			if (FStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset(); StaticMesh && !StaticMesh->QBVH.IsEmpty())
+			{
+				return &StaticMesh->QBVH;
+			}
+		}
+	}
+	return nullptr;
 }
 
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
@@ -342,9 +470,6 @@ void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, con
 	}
 
 	// fallback: 전체 삼각형 인덱스 채우기
-	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
-	const TArray<uint32>* Indices = Primitive->GetIndicesData();
-
 	const int32 NumVertices = Primitive->GetNumVertices();
 	const int32 NumIndices = Primitive->GetNumIndices();
 	const int32 NumTriangles = (NumIndices > 0) ? (NumIndices / 3) : (NumVertices / 3);
@@ -355,4 +480,116 @@ void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, con
 		OutCandidateIndices.push_back(TriIndex);
 	}
 	return;
-}
\ No newline at end of file
+}
+
+void RunPickRayBenchmark(UObjectPicker& InPicker, const TArray<UCamera*>& InCameras, ULevel* InLevel, int32 InRayCount)
+{
+	// 한 패킷은 화면의 작은 타일(8x4 픽셀 격자)에서 나온 Ray들로 구성 (박스 선택/호버처럼 서로 가까운 Ray)
+	constexpr int32 TILE_WIDTH = 8;
+	constexpr int32 TILE_HEIGHT = 4;
+	constexpr float TILE_RAY_SPACING = 0.005f;
+
+	if (!InLevel || !InLevel->GetStaticOctree() || InCameras.empty() || InRayCount <= 0) { return; }
+
+	// 1. 카메라를 번갈아 가며 타일 단위로 Ray 생성 (Ray별 카메라도 기록)
+	TArray<FRay> WorldRays;
+	TArray<int32> RayCameraIndices;
+	WorldRays.reserve(InRayCount);
+	RayCameraIndices.reserve(InRayCount);
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> TileCenter(-0.9f, 0.9f);
+	for (int32 TileIndex = 0; static_cast<int32>(WorldRays.size()) < InRayCount; ++TileIndex)
+	{
+		const int32 CameraIndex = TileIndex % static_cast<int32>(InCameras.size());
+		const float CenterX = TileCenter(Random);
+		const float CenterY = TileCenter(Random);
+		for (int32 Y = 0; Y < TILE_HEIGHT && static_cast<int32>(WorldRays.size()) < InRayCount; ++Y)
+		{
+			for (int32 X = 0; X < TILE_WIDTH && static_cast<int32>(WorldRays.size()) < InRayCount; ++X)
+			{
+				WorldRays.push_back(InCameras[CameraIndex]->ConvertToWorldRay(CenterX + X * TILE_RAY_SPACING, CenterY + Y * TILE_RAY_SPACING));
+				RayCameraIndices.push_back(CameraIndex);
+			}
+		}
+	}
+
+	const FSceneBVH& SceneBVH = *InLevel->GetSceneBVH();
+	TArray<UPrimitiveComponent*> CandidatePrimitives(InRayCount), ScenePrimitives(InRayCount), PacketPrimitives;
+	TArray<float> CandidateDistances(InRayCount), SceneDistances(InRayCount), PacketDistances;
+
+	// 2. 기존 방식: Ray마다 옥트리 후보 + Dynamic 목록 전체를 검사
+	const double CandidateSeconds = FBenchmark::MeasureOnce([&]()
+	{
+		for (int32 Index = 0; Index < InRayCount; ++Index)
+		{
+			TArray<UPrimitiveComponent*> Candidate;
+			InPicker.FindCandidateFromOctree(InLevel->GetStaticOctree(), WorldRays[Index], Candidate);
+			const TArray<UPrimitiveComponent*>& DynamicPrimitives = InLevel->GetDynamicPrimitives();
+			Candidate.insert(Candidate.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+			CandidatePrimitives[Index] = InPicker.PickPrimitive(InCameras[RayCameraIndices[Index]], WorldRays[Index], Candidate, &CandidateDistances[Index]);
+		}
+	}) / 1000.0;
+
+	// 3. 씬 BVH, Ray 하나씩
+	const double SceneSeconds = FBenchmark::MeasureOnce([&]()
+	{
+		for (int32 Index = 0; Index < InRayCount; ++Index)
+		{
+			ScenePrimitives[Index] = InPicker.PickPrimitive(InCameras[RayCameraIndices[Index]], WorldRays[Index], SceneBVH, &SceneDistances[Index]);
+		}
+	}) / 1000.0;
+
+	// 4. 씬 BVH 패킷 (Near/Far 판정에 쓰는 카메라가 같은 Ray끼리 묶어서 질의)
+	PacketPrimitives.resize(InRayCount);
+	PacketDistances.resize(InRayCount);
+	const double PacketSeconds = FBenchmark::MeasureOnce([&]()
+	{
+		for (int32 CameraIndex = 0; CameraIndex < static_cast<int32>(InCameras.size()); ++CameraIndex)
+		{
+			TArray<FRay> CameraRays;
+			TArray<int32> CameraRayIndices;
+			for (int32 Index = 0; Index < InRayCount; ++Index)
+			{
+				if (RayCameraIndices[Index] != CameraIndex) { continue; }
+				CameraRays.push_back(WorldRays[Index]);
+				CameraRayIndices.push_back(Index);
+			}
+
+			TArray<UPrimitiveComponent*> Primitives;
+			TArray<float> Distances;
+			InPicker.PickPrimitives(InCameras[CameraIndex], CameraRays, SceneBVH, Primitives, Distances);
+			for (size_t Index = 0; Index < CameraRayIndices.size(); ++Index)
+			{
+				PacketPrimitives[CameraRayIndices[Index]] = Primitives[Index];
+				PacketDistances[CameraRayIndices[Index]] = Distances[Index];
+			}
+		}
+	}) / 1000.0;
+
+	// 같은 프리미티브이거나 (겹친 면 등으로) 거리가 같으면 일치로 간주
+	auto CountMismatches = [InRayCount](const TArray<UPrimitiveComponent*>& APrimitives, const TArray<float>& ADistances,
+		const TArray<UPrimitiveComponent*>& BPrimitives, const TArray<float>& BDistances)
+	{
+		int32 MismatchCount = 0;
+		for (int32 Index = 0; Index < InRayCount; ++Index)
+		{
+			if (APrimitives[Index] != BPrimitives[Index] &&
+				fabs(ADistances[Index] - BDistances[Index]) > 1e-3f * max(1.0f, fabsf(ADistances[Index])))
+			{
+				++MismatchCount;
+			}
+		}
+		return MismatchCount;
+	};
+
+	int32 HitCount = 0;
+	for (UPrimitiveComponent* Primitive : PacketPrimitives) { HitCount += Primitive ? 1 : 0; }
+
+	UE_LOG_INFO("Pick Rays: %d rays from %zu viewport(s), %d primitives, %d hits", InRayCount, InCameras.size(), SceneBVH.GetPrimitiveCount(), HitCount);
+	UE_LOG_INFO("  Octree + dynamic list : %.0f rays/s", InRayCount / max(CandidateSeconds, 1e-9));
+	UE_LOG_INFO("  Scene BVH (per ray)   : %.0f rays/s, mismatch %d", InRayCount / max(SceneSeconds, 1e-9),
+		CountMismatches(CandidatePrimitives, CandidateDistances, ScenePrimitives, SceneDistances));
+	UE_LOG_INFO("  Scene BVH (packet %d) : %.0f rays/s, mismatch %d", FSceneBVH::MAX_RAY_PACKET_SIZE, InRayCount / max(PacketSeconds, 1e-9),
+		CountMismatches(ScenePrimitives, SceneDistances, PacketPrimitives, PacketDistances));
+}
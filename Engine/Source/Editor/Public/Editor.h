@@ -47,6 +47,7 @@ public:
 	void SelectActor(AActor* InActor);
 	TObjectPtr<AActor> GetSelectedActor() const { return SelectedActor; }
 	UUUIDTextComponent* GetPickedBillboard() const;
+	UObjectPicker& GetObjectPicker() { return ObjectPicker; }
 
 private:
 	void InitializeLayout();
@@ -8,22 +8,47 @@ class ULevel;
 class UCamera;
 class UGizmo;
 class FOctree;
+class FQBVH;
+class FSceneBVH;
 struct FRay;
 
 class UObjectPicker : public UObject
 {
 public:
 	UObjectPicker() = default;
-	UPrimitiveComponent* PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, TArray<UPrimitiveComponent*> Candidate, float* Distance);
+	UPrimitiveComponent* PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, const TArray<UPrimitiveComponent*>& Candidate, float* Distance);
+	/**
+	 * @brief 씬 BVH로 월드 AABB 진입 거리가 가까운 프리미티브부터 검사하며, 이미 찾은 교차보다 먼 프리미티브는 검사하지 않는다
+	 */
+	UPrimitiveComponent* PickPrimitive(UCamera* InActiveCamera, const FRay& WorldRay, const FSceneBVH& SceneBVH, float* Distance);
+	/**
+	 * @brief 여러 Ray를 패킷 단위로 한 번에 피킹 (박스 선택, 호버 하이라이트, 여러 뷰포트의 반복 Ray 등)
+	 * 씬 BVH와 메시 QBVH를 패킷당 한 번씩만 순회하며, 결과는 WorldRays와 같은 순서로 채운다 (교차가 없으면 nullptr / D3D11_FLOAT32_MAX)
+	 */
+	void PickPrimitives(UCamera* InActiveCamera, const TArray<FRay>& WorldRays, const FSceneBVH& SceneBVH,
+		TArray<UPrimitiveComponent*>& OutPrimitives, TArray<float>& OutDistances);
 	void PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint);
 	bool IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoint, FVector Normal, FVector& PointOnPlane);
 
 	bool FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate);
 
 private:
+	// Static Mesh이고 QBVH가 구축되어 있으면 QBVH를, 아니면 nullptr을 반환
+	const FQBVH* GetMeshQBVH(UPrimitiveComponent* Primitive);
 	void GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateTriangleIndices);
 	bool IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay& WorldRay, UPrimitiveComponent* Primitive, const FMatrix& ModelMatrix, float* ShortestDistance);
+	/**
+	 * @brief RayMask에 속한 월드 Ray들을 Primitive와 한 번에 정밀 검사
+	 * InOutDistances보다 가까운 교차를 찾은 Ray만 거리를 갱신하고 그 비트 마스크를 반환
+	 */
+	uint32 IntersectPrimitiveRayPacket(UCamera* InActiveCamera, UPrimitiveComponent* Primitive, const FRay* WorldRays, uint32 RayMask, float* InOutDistances);
 	FRay GetModelRay(const FRay& Ray, UPrimitiveComponent* Primitive);
 	bool IsRayTriangleCollided(UCamera* InActiveCamera, const FRay& Ray, const FVector& Vertex1, const FVector& Vertex2, const FVector& Vertex3,
 		const FMatrix& ModelMatrix, float* Distance);
 };
+
+/**
+ * @brief 레벨의 모든 뷰포트 카메라에서 화면 타일 단위로 묶인 Ray InRayCount개를 쏘아
+ * 기존 후보 수집(옥트리 + Dynamic 목록), 씬 BVH 단일 Ray, 씬 BVH 패킷 피킹의 초당 Ray 수를 비교하여 로그로 출력
+ */
+void RunPickRayBenchmark(UObjectPicker& InPicker, const TArray<UCamera*>& InCameras, ULevel* InLevel, int32 InRayCount);
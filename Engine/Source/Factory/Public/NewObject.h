@@ -16,7 +16,7 @@ TObjectPtr<T> NewObject(TObjectPtr<UObject> InOuter = nullptr)
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
 	T* NewObject = new T();
-	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName().ToString()));
+	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName()));
 
 	return NewObject;
 }
@@ -28,7 +28,7 @@ inline TObjectPtr<UObject> NewObject(UClass* ClassToCreate, TObjectPtr<UObject>
        
 	if (NewObject)
 	{
-		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName().ToString());
+		FName NewName = FNameTable::GetInstance().GetUniqueName(ClassToCreate->GetName());
 		NewObject->SetName(NewName);
 	}
 
@@ -0,0 +1,191 @@
+#include "pch.h"
+#include "Global/AllocationTracker.h"
+
+namespace
+{
+	constexpr int32 TAG_COUNT = static_cast<int32>(EAllocationTag::Count);
+
+	// 전용 카운터를 받는 스레드 수 (초과한 스레드는 원자적 RMW를 쓰는 공용 카운터를 함께 사용)
+	constexpr int32 MAX_TRACKED_THREADS = 64;
+
+	struct alignas(64) FThreadAllocationCounters
+	{
+		std::atomic<int64> Bytes[TAG_COUNT];
+		std::atomic<int64> Counts[TAG_COUNT];
+	};
+
+	// 정적 저장소는 0으로 초기화되므로 operator new가 정적 초기화 전에 호출되어도 안전하다
+	FThreadAllocationCounters GThreadCounters[MAX_TRACKED_THREADS];
+	FThreadAllocationCounters GSharedCounters;
+	std::atomic<int32> GThreadCounterCount{ 0 };
+
+	// [TAG_COUNT]는 전체 합계
+	std::atomic<int64> GPeakBytes[TAG_COUNT + 1];
+
+	thread_local FThreadAllocationCounters* LocalCounters = nullptr;
+	thread_local bool bIsUsingSharedCounters = false;
+	thread_local EAllocationTag CurrentTag = EAllocationTag::Default;
+
+	FThreadAllocationCounters* GetLocalCounters()
+	{
+		if (!LocalCounters)
+		{
+			const int32 Index = GThreadCounterCount.fetch_add(1);
+			if (Index < MAX_TRACKED_THREADS)
+			{
+				LocalCounters = &GThreadCounters[Index];
+			}
+			else
+			{
+				LocalCounters = &GSharedCounters;
+				bIsUsingSharedCounters = true;
+			}
+		}
+		return LocalCounters;
+	}
+
+	void AddCounter(std::atomic<int64>& InCounter, int64 InDelta)
+	{
+		// 전용 카운터는 이 스레드만 쓰므로 lock 접두어 없이 갱신하고, 조회 스레드는 찢어지지 않은 값을 읽는다
+		if (bIsUsingSharedCounters)
+		{
+			InCounter.fetch_add(InDelta, std::memory_order_relaxed);
+		}
+		else
+		{
+			InCounter.store(InCounter.load(std::memory_order_relaxed) + InDelta, std::memory_order_relaxed);
+		}
+	}
+
+	void UpdatePeak(std::atomic<int64>& InPeak, int64 InValue)
+	{
+		int64 Peak = InPeak.load(std::memory_order_relaxed);
+		while (InValue > Peak && !InPeak.compare_exchange_weak(Peak, InValue, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	void SumCounters(int64 (&OutBytes)[TAG_COUNT], int64 (&OutCounts)[TAG_COUNT])
+	{
+		for (int32 Tag = 0; Tag < TAG_COUNT; ++Tag)
+		{
+			OutBytes[Tag] = GSharedCounters.Bytes[Tag].load(std::memory_order_relaxed);
+			OutCounts[Tag] = GSharedCounters.Counts[Tag].load(std::memory_order_relaxed);
+		}
+
+		const int32 ThreadCount = std::min(GThreadCounterCount.load(), MAX_TRACKED_THREADS);
+		for (int32 Index = 0; Index < ThreadCount; ++Index)
+		{
+			for (int32 Tag = 0; Tag < TAG_COUNT; ++Tag)
+			{
+				OutBytes[Tag] += GThreadCounters[Index].Bytes[Tag].load(std::memory_order_relaxed);
+				OutCounts[Tag] += GThreadCounters[Index].Counts[Tag].load(std::memory_order_relaxed);
+			}
+		}
+	}
+}
+
+const char* FAllocationTracker::GetTagName(EAllocationTag InTag)
+{
+	switch (InTag)
+	{
+	case EAllocationTag::Default: return "Default";
+	case EAllocationTag::Asset: return "Asset";
+	case EAllocationTag::Level: return "Level";
+	case EAllocationTag::Render: return "Render";
+	case EAllocationTag::UI: return "UI";
+	case EAllocationTag::ObjectPool: return "ObjectPool";
+	default: return "Unknown";
+	}
+}
+
+EAllocationTag FAllocationTracker::GetCurrentTag()
+{
+	return CurrentTag;
+}
+
+void FAllocationTracker::SetCurrentTag(EAllocationTag InTag)
+{
+	CurrentTag = InTag;
+}
+
+void FAllocationTracker::TrackAllocation(EAllocationTag InTag, size_t InBytes)
+{
+	FThreadAllocationCounters* Counters = GetLocalCounters();
+	AddCounter(Counters->Bytes[static_cast<int32>(InTag)], static_cast<int64>(InBytes));
+	AddCounter(Counters->Counts[static_cast<int32>(InTag)], 1);
+}
+
+void FAllocationTracker::TrackFree(EAllocationTag InTag, size_t InBytes)
+{
+	FThreadAllocationCounters* Counters = GetLocalCounters();
+	AddCounter(Counters->Bytes[static_cast<int32>(InTag)], -static_cast<int64>(InBytes));
+	AddCounter(Counters->Counts[static_cast<int32>(InTag)], -1);
+}
+
+void FAllocationTracker::Sample()
+{
+	int64 Bytes[TAG_COUNT];
+	int64 Counts[TAG_COUNT];
+	SumCounters(Bytes, Counts);
+
+	int64 TotalBytes = 0;
+	for (int32 Tag = 0; Tag < TAG_COUNT; ++Tag)
+	{
+		UpdatePeak(GPeakBytes[Tag], Bytes[Tag]);
+		TotalBytes += Bytes[Tag];
+	}
+	UpdatePeak(GPeakBytes[TAG_COUNT], TotalBytes);
+}
+
+FAllocationStats FAllocationTracker::GetStats(EAllocationTag InTag)
+{
+	int64 Bytes[TAG_COUNT];
+	int64 Counts[TAG_COUNT];
+	SumCounters(Bytes, Counts);
+
+	const int32 Tag = static_cast<int32>(InTag);
+	UpdatePeak(GPeakBytes[Tag], Bytes[Tag]);
+
+	FAllocationStats Stats;
+	Stats.CurrentBytes = Bytes[Tag];
+	Stats.CurrentCount = Counts[Tag];
+	Stats.PeakBytes = GPeakBytes[Tag].load(std::memory_order_relaxed);
+	return Stats;
+}
+
+FAllocationStats FAllocationTracker::GetTotalStats()
+{
+	int64 Bytes[TAG_COUNT];
+	int64 Counts[TAG_COUNT];
+	SumCounters(Bytes, Counts);
+
+	FAllocationStats Stats;
+	for (int32 Tag = 0; Tag < TAG_COUNT; ++Tag)
+	{
+		Stats.CurrentBytes += Bytes[Tag];
+		Stats.CurrentCount += Counts[Tag];
+	}
+
+	UpdatePeak(GPeakBytes[TAG_COUNT], Stats.CurrentBytes);
+	Stats.PeakBytes = GPeakBytes[TAG_COUNT].load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FAllocationTracker::DumpStats()
+{
+	Sample();
+
+	constexpr double MEGA_BYTES = 1024.0 * 1024.0;
+
+	const FAllocationStats Total = GetTotalStats();
+	UE_LOG_INFO("Allocation Tracker: %.2f MB in %lld allocations (peak %.2f MB, %d threads)", Total.CurrentBytes / MEGA_BYTES,
+		Total.CurrentCount, Total.PeakBytes / MEGA_BYTES, std::min(GThreadCounterCount.load(), MAX_TRACKED_THREADS));
+
+	for (int32 Tag = 0; Tag < TAG_COUNT; ++Tag)
+	{
+		const FAllocationStats Stats = GetStats(static_cast<EAllocationTag>(Tag));
+		UE_LOG_INFO("  %-10s: %10.3f MB, %8lld allocations (peak %.3f MB)", GetTagName(static_cast<EAllocationTag>(Tag)),
+			Stats.CurrentBytes / MEGA_BYTES, Stats.CurrentCount, Stats.PeakBytes / MEGA_BYTES);
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+// 할당을 스레드의 현재 태그 범위로 구분하는 서브시스템
+enum class EAllocationTag : uint8
+{
+	Default,
+	Asset,
+	Level,
+	Render,
+	UI,
+	// UObject 슬랩 풀 (FObjectPoolAllocator)이 잡고 있는 슬랩
+	ObjectPool,
+	Count
+};
+
+// FScopedAllocationTag 범위 안의 전역 new를 Tag로 집계 (TIME_PROFILE과 같은 형태)
+#define ALLOCATION_TAG(Tag) FScopedAllocationTag Tag##AllocationTag(EAllocationTag::Tag);
+
+struct FAllocationStats
+{
+	int64 CurrentBytes = 0;
+	int64 CurrentCount = 0;
+	// Sample 시점마다 갱신되는 최고치
+	int64 PeakBytes = 0;
+};
+
+/**
+ * @brief 태그별 할당 추적기
+ * 할당/해제는 호출 스레드 전용 카운터만 갱신하고(원자적 RMW 없이 relaxed load/store), 조회할 때 모든 스레드의 카운터를 합산한다
+ * 다른 스레드에서 해제되면 그 스레드의 카운터가 음수가 될 수 있지만 합계는 정확하다
+ * @note 최고치는 합산할 때만 알 수 있으므로 Sample(매 프레임 호출)과 조회 시점에 갱신한다
+ */
+class FAllocationTracker
+{
+public:
+	static const char* GetTagName(EAllocationTag InTag);
+
+	static EAllocationTag GetCurrentTag();
+	static void SetCurrentTag(EAllocationTag InTag);
+
+	static void TrackAllocation(EAllocationTag InTag, size_t InBytes);
+	static void TrackFree(EAllocationTag InTag, size_t InBytes);
+
+	/**
+	 * @brief 모든 스레드의 카운터를 합산하여 태그별/전체 최고치를 갱신
+	 */
+	static void Sample();
+
+	static FAllocationStats GetStats(EAllocationTag InTag);
+	static FAllocationStats GetTotalStats();
+
+	/**
+	 * @brief 전체와 태그별 현재/최고 사용량을 로그(표준 출력 포함)로 출력
+	 */
+	static void DumpStats();
+};
+
+/**
+ * @brief 범위 동안 현재 스레드의 할당 태그를 바꾸고, 범위를 벗어나면 이전 태그로 되돌린다
+ */
+struct FScopedAllocationTag
+{
+	explicit FScopedAllocationTag(EAllocationTag InTag)
+		: PreviousTag(FAllocationTracker::GetCurrentTag())
+	{
+		FAllocationTracker::SetCurrentTag(InTag);
+	}
+
+	~FScopedAllocationTag()
+	{
+		FAllocationTracker::SetCurrentTag(PreviousTag);
+	}
+
+	FScopedAllocationTag(const FScopedAllocationTag&) = delete;
+	FScopedAllocationTag& operator=(const FScopedAllocationTag&) = delete;
+
+private:
+	EAllocationTag PreviousTag;
+};
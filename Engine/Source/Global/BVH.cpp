@@ -1,34 +1,106 @@
 ﻿#pragma once
 #include "pch.h"
 #include "Global/BVH.h"
+#include "Physics/Public/RayBoxIntersection.h"
+#include "Core/Public/Archive.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Utility/Public/Benchmark.h"
 
-FBVH::FBVH(FStaticMesh* InMesh)
+#include <random>
+
+namespace
 {
-	Build(InMesh);
+	// 축마다 삼각형 중심을 나누는 Bin 개수
+	constexpr int32 SAH_BIN_COUNT = 16;
+	// 병렬 구축 시 한 작업이 맡을 최소 삼각형 수
+	constexpr int32 MIN_PARALLEL_GRAIN_SIZE = 1024;
+
+	float GetAxis(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	struct FSAHBin
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		int32 Count = 0;
+	};
+
+	void SetNodeBounds(FBVHCompactNode& OutNode, const FVector& InMin, const FVector& InMax)
+	{
+		OutNode.Min[0] = InMin.X; OutNode.Min[1] = InMin.Y; OutNode.Min[2] = InMin.Z;
+		OutNode.Max[0] = InMax.X; OutNode.Max[1] = InMax.Y; OutNode.Max[2] = InMax.Z;
+	}
+
+	/**
+	 * @brief Ray-삼각형 교차 (UObjectPicker::IsRayTriangleCollided와 같은 Cramer's rule 판정)
+	 */
+	bool IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection,
+		const FVector& Vertex1, const FVector& Vertex2, const FVector& Vertex3, float& OutT)
+	{
+		const FVector E1 = Vertex2 - Vertex1;
+		const FVector E2 = Vertex3 - Vertex1;
+		const FVector Result = RayOrigin - Vertex1;
+
+		const FVector CrossE2Ray = E2.Cross(RayDirection);
+		const float Determinant = E1.Dot(CrossE2Ray);
+		if (fabs(Determinant) <= 0.0001f) { return false; }
+
+		const float V = Result.Dot(CrossE2Ray) / Determinant;
+		if (V < 0 || V > 1) { return false; }
+
+		const FVector CrossE1Result = E1.Cross(Result);
+		const float U = RayDirection.Dot(CrossE1Result) / Determinant;
+		if (U < 0 || U + V > 1) { return false; }
+
+		OutT = E2.Dot(CrossE1Result) / Determinant;
+		return true;
+	}
 }
 
-const FNode& FBVH::GetNode(uint32 Index) const
+FBVH::FBVH(FStaticMesh* InMesh, EBVHBuildMethod InMethod)
 {
-	assert(Index < Nodes.size());
-	return Nodes[Index];
+	Build(InMesh, InMethod);
 }
 
-FNode& FBVH::GetNode(uint32 Index)
+const FBVHCompactNode& FBVH::GetNode(uint32 Index) const
 {
 	assert(Index < Nodes.size());
 	return Nodes[Index];
 }
 
+FAABB FBVH::GetNodeBounds(uint32 Index) const
+{
+	const FBVHCompactNode& Node = GetNode(Index);
+	return FAABB(FVector(Node.Min[0], Node.Min[1], Node.Min[2]), FVector(Node.Max[0], Node.Max[1], Node.Max[2]));
+}
+
 void FBVH::Clear()
 {
 	Mesh = nullptr;
 	Nodes.clear();
 	RootIndex = -1;
+	BuildNodes.clear();
+	BuildRootIndex = -1;
 	Cost = 0.0f;
 }
 
+void FBVH::Serialize(FArchive& Ar, FStaticMesh* InMesh)
+{
+	if (Ar.IsLoading())
+	{
+		Clear();
+		Mesh = InMesh;
+	}
+
+	Ar << Nodes;
+	Ar << RootIndex;
+	Ar << Cost;
+}
+
 int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
 {
 	if(!Mesh)
@@ -51,7 +123,7 @@ int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
 
 	// 2. 새 Leaf node 생성
 	FNode NewNode;
-	NewNode.ObjectIndex = static_cast<int32>(Nodes.size());
+	NewNode.ObjectIndex = static_cast<int32>(BuildNodes.size());
 	NewNode.ParentIndex = -1; // Parent는 InsertInternalNode에서 설정
 	NewNode.Child1 = -1;
 	NewNode.Child2 = -1;
@@ -61,9 +133,9 @@ int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
 	// 빈 트리인 경우 새 노드를 루트로 설정하고 종료
 	if (NewNode.ObjectIndex == 0)
 	{
-		Nodes.push_back(NewNode);
-		RootIndex = 0;
-		Cost = GetCost(RootIndex);
+		BuildNodes.push_back(NewNode);
+		BuildRootIndex = 0;
+		Cost = GetBuildCost(BuildRootIndex);
 		return 0;
 	}
 
@@ -71,26 +143,26 @@ int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
 	int32 SiblingIndex = FindBestSibling(NewNode.Box);
 
 	// 4. 새 leaf node와 sibling의 새로운 부모 node 생성
-	Nodes.push_back(NewNode);
+	BuildNodes.push_back(NewNode);
 	InsertInternalNode(NewNode.ObjectIndex, SiblingIndex);
 
 	// 5. 새 node가 추가되었으므로 부모 거슬러올라가며 AABB 리피팅
 	// NewNode의 부모가 InsertInternalNode에서 설정했고, 부모의 AABB도 끝내둠.
 	// 리핏은 ParentIndex부터 시작
-	RefitAncestors(Nodes[SiblingIndex].ParentIndex);
+	RefitAncestors(BuildNodes[SiblingIndex].ParentIndex);
 
 	return NewNode.ObjectIndex;
 }
 
-float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
+float FBVH::GetBuildCost(int32 SubTreeRootIndex, bool bInternalOnly) const
 {
 	// 인덱스 벗어난 경우 0 반환
-	if (SubTreeRootIndex >= Nodes.size() || SubTreeRootIndex < 0)
+	if (SubTreeRootIndex >= BuildNodes.size() || SubTreeRootIndex < 0)
 	{
 		return 0.0f;
 	}
 
-	const FNode& SubTreeRoot = Nodes[SubTreeRootIndex];
+	const FNode& SubTreeRoot = BuildNodes[SubTreeRootIndex];
 	if (SubTreeRoot.bIsLeaf)
 	{
 		// InternalOnly면 leaf node의 cost는 0으로 계산
@@ -103,7 +175,7 @@ float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
 		return SubTreeRoot.Box.GetSurfaceArea();
 	}
 
-	return SubTreeRoot.Box.GetSurfaceArea() + GetCost(SubTreeRoot.Child1, bInternalOnly) + GetCost(SubTreeRoot.Child2, bInternalOnly);
+	return SubTreeRoot.Box.GetSurfaceArea() + GetBuildCost(SubTreeRoot.Child1, bInternalOnly) + GetBuildCost(SubTreeRoot.Child2, bInternalOnly);
 }
 
 int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
@@ -114,19 +186,19 @@ int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
 	// Branch and Bound 최적화를 위한 스택 기반 순회
 	// 루트부터 시작하여 더 나은 후보가 있을 수 있는 노드들만 방문
 	TArray<int32> CandidateStack;
-	CandidateStack.push_back(RootIndex);
+	CandidateStack.push_back(BuildRootIndex);
 
 	while (!CandidateStack.empty())
 	{
 		int32 CurrentIndex = CandidateStack.back();
 		CandidateStack.pop_back();
 
-		if (CurrentIndex < 0 || CurrentIndex >= static_cast<int32>(Nodes.size()))
+		if (CurrentIndex < 0 || CurrentIndex >= static_cast<int32>(BuildNodes.size()))
 		{
 			continue;
 		}
 
-		const FNode& CurrentNode = Nodes[CurrentIndex];
+		const FNode& CurrentNode = BuildNodes[CurrentIndex];
 		FAABB CombinedAABB = Union(NewLeafAABB, CurrentNode.Box);
 
 		// 하한 비용 계산: 이 서브트리의 어떤 리프를 선택하더라도 최소한 발생하는 '증가' 비용
@@ -137,11 +209,11 @@ int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
 		FAABB CurrentAABB = CombinedAABB;
 		while(AncestorIndex != -1)
 		{
-			const FNode& AncestorNode = Nodes[AncestorIndex];
+			const FNode& AncestorNode = BuildNodes[AncestorIndex];
 			int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
 				? AncestorNode.Child2
 				: AncestorNode.Child1;
-			const FNode& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex];
+			const FNode& SiblingOfCurrentChild = BuildNodes[SiblingOfCurrentChildIndex];
 
 			FAABB AncestorNewAABB = Union(SiblingOfCurrentChild.Box, CurrentAABB);
 			InheritedIncrease += AncestorNewAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
@@ -176,11 +248,11 @@ int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
 			if (LowerBoundIncrease < MinCostIncrease)
 			{
 				// 자식 노드들을 후보에 추가
-				if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+				if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(BuildNodes.size()))
 				{
 					CandidateStack.push_back(CurrentNode.Child1);
 				}
-				if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
+				if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(BuildNodes.size()))
 				{
 					CandidateStack.push_back(CurrentNode.Child2);
 				}
@@ -194,12 +266,12 @@ int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
 
 float FBVH::CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const
 {
-	if (CandidateIndex < 0 || CandidateIndex >= static_cast<int32>(Nodes.size()))
+	if (CandidateIndex < 0 || CandidateIndex >= static_cast<int32>(BuildNodes.size()))
 	{
 		return FLT_MAX;
 	}
 
-	const FNode& CandidateNode = Nodes[CandidateIndex];
+	const FNode& CandidateNode = BuildNodes[CandidateIndex];
 	const FAABB& SiblingAABB = CandidateNode.Box;
 
 	// 새 리프와 sibling을 묶는 새 internal node의 AABB 계산
@@ -214,18 +286,18 @@ float FBVH::CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB
 	int32 AncestorIndex = CandidateNode.ParentIndex;
 	int32 CurrentChildIndex = CandidateIndex;
 	FAABB CurrentAABB = CombinedAABB;
-	while (AncestorIndex != -1 && AncestorIndex < static_cast<int32>(Nodes.size()))
+	while (AncestorIndex != -1 && AncestorIndex < static_cast<int32>(BuildNodes.size()))
 	{
-		const FNode& AncestorNode = Nodes[AncestorIndex];
+		const FNode& AncestorNode = BuildNodes[AncestorIndex];
 
 		// 형제 노드의 AABB와 합쳐서 새로운 조상 AABB 계산
 		int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
 			? AncestorNode.Child2
 			: AncestorNode.Child1;
 
-		if (SiblingOfCurrentChildIndex >= 0 && SiblingOfCurrentChildIndex < static_cast<int32>(Nodes.size()))
+		if (SiblingOfCurrentChildIndex >= 0 && SiblingOfCurrentChildIndex < static_cast<int32>(BuildNodes.size()))
 		{
-			const FAABB& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex].Box;
+			const FAABB& SiblingOfCurrentChild = BuildNodes[SiblingOfCurrentChildIndex].Box;
 			FAABB NewAncestorAABB = Union(CurrentAABB, SiblingOfCurrentChild);
 			CostIncrease += NewAncestorAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
 			CurrentAABB = NewAncestorAABB;
@@ -242,7 +314,7 @@ void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
 {
 	// 새 부모(Internal) 노드 구성
 	FNode NewParent;
-	int32 OldParentIndex = Nodes[SiblingIndex].ParentIndex;
+	int32 OldParentIndex = BuildNodes[SiblingIndex].ParentIndex;
 	NewParent.ParentIndex = OldParentIndex;
 	NewParent.Child1 = SiblingIndex;
 	NewParent.Child2 = NewLeafIndex;
@@ -250,23 +322,23 @@ void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
 	NewParent.TriangleBaseIndex = -1; // Internal 노드는 삼각형 인덱스 없음
 
 	// 부모 AABB는 두 자식의 합집합
-	FAABB NewLeafAABB = Nodes[NewLeafIndex].Box;
-	FAABB SiblingAABB = Nodes[SiblingIndex].Box;
+	FAABB NewLeafAABB = BuildNodes[NewLeafIndex].Box;
+	FAABB SiblingAABB = BuildNodes[SiblingIndex].Box;
 	NewParent.Box = Union(NewLeafAABB, SiblingAABB);
 
 	// 새 부모 노드를 push하고 인덱스 확정
-	int32 NewParentIndex = static_cast<int32>(Nodes.size());
+	int32 NewParentIndex = static_cast<int32>(BuildNodes.size());
 	NewParent.ObjectIndex = NewParentIndex;
-	Nodes.push_back(NewParent);
+	BuildNodes.push_back(NewParent);
 
 	// 자식들의 부모 갱신
-	Nodes[SiblingIndex].ParentIndex = NewParentIndex;
-	Nodes[NewLeafIndex].ParentIndex = NewParentIndex;
+	BuildNodes[SiblingIndex].ParentIndex = NewParentIndex;
+	BuildNodes[NewLeafIndex].ParentIndex = NewParentIndex;
 
 	// 이전 부모가 있었다면 그 부모의 자식 포인터를 새 부모로 교체
 	if (OldParentIndex != -1)
 	{
-		FNode& OldParent = Nodes[OldParentIndex];
+		FNode& OldParent = BuildNodes[OldParentIndex];
 		if (OldParent.Child1 == SiblingIndex)
 		{
 			OldParent.Child1 = NewParentIndex;
@@ -284,104 +356,187 @@ void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
 	// sibling이 루트였던 경우, 새 부모가 루트가 됨
 	else
 	{
-		RootIndex = NewParentIndex;
+		BuildRootIndex = NewParentIndex;
 	}
 }
 
 void FBVH::RefitAncestors(int32 RefitStartIndex)
 {
 	// 시작점의 부모부터 루트까지 올라가며 InternalBox를 리핏
-	if (RefitStartIndex < 0 || RefitStartIndex >= static_cast<int32>(Nodes.size()))
+	if (RefitStartIndex < 0 || RefitStartIndex >= static_cast<int32>(BuildNodes.size()))
 	{
 		return;
 	}
 
-	int32 CurrentIndex = Nodes[RefitStartIndex].ParentIndex; // 부모부터 시작
+	int32 CurrentIndex = BuildNodes[RefitStartIndex].ParentIndex; // 부모부터 시작
 	while (CurrentIndex != -1)
 	{
-		FNode& Current = Nodes[CurrentIndex];
+		FNode& Current = BuildNodes[CurrentIndex];
 		// 두 자식의 AABB 합집합으로 현재 InternalBox 갱신
-		FAABB Child1AABB = Nodes[Current.Child1].Box;
-		FAABB Child2AABB = Nodes[Current.Child2].Box;
+		FAABB Child1AABB = BuildNodes[Current.Child1].Box;
+		FAABB Child2AABB = BuildNodes[Current.Child2].Box;
 		Current.Box = Union(Child1AABB, Child2AABB);
 
 		CurrentIndex = Current.ParentIndex;
 	}
 
 	// 전체 비용 갱신
-	Cost = GetCost(RootIndex);
+	Cost = GetBuildCost(BuildRootIndex);
+}
+
+void FBVH::FlattenBuildNodes()
+{
+	Nodes.clear();
+	RootIndex = -1;
+
+	if (BuildRootIndex >= 0 && BuildRootIndex < static_cast<int32>(BuildNodes.size()))
+	{
+		// 노드가 둘 이상이면 1번 칸을 비워 자식 쌍이 짝수 인덱스에서 시작하도록 한다
+		Nodes.resize(BuildNodes.size() > 1 ? BuildNodes.size() + 1 : BuildNodes.size());
+		RootIndex = 0;
+
+		// (작업용 노드, 압축 노드) 스택. 내부 노드를 만날 때마다 두 자식의 칸을 연속으로 할당
+		TArray<std::pair<int32, int32>> NodeStack;
+		NodeStack.push_back({ BuildRootIndex, 0 });
+		int32 NextIndex = PADDING_NODE_INDEX + 1;
+
+		while (!NodeStack.empty())
+		{
+			const auto [BuildIndex, CompactIndex] = NodeStack.back();
+			NodeStack.pop_back();
+
+			const FNode& BuildNode = BuildNodes[BuildIndex];
+			FBVHCompactNode& Node = Nodes[CompactIndex];
+			SetNodeBounds(Node, BuildNode.Box.Min, BuildNode.Box.Max);
+
+			if (BuildNode.bIsLeaf)
+			{
+				Node.Offset = static_cast<uint32>(BuildNode.TriangleBaseIndex);
+				Node.TriangleCount = 1;
+				continue;
+			}
+
+			Node.Offset = static_cast<uint32>(NextIndex);
+			Node.TriangleCount = 0;
+			NodeStack.push_back({ BuildNode.Child2, NextIndex + 1 });
+			NodeStack.push_back({ BuildNode.Child1, NextIndex });
+			NextIndex += 2;
+		}
+	}
+
+	// 작업용 트리는 더 이상 필요 없으므로 메모리 해제
+	TArray<FNode>().swap(BuildNodes);
+	BuildRootIndex = -1;
+}
+
+float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
+{
+	// 인덱스 벗어난 경우 0 반환
+	if (SubTreeRootIndex >= static_cast<int32>(Nodes.size()) || SubTreeRootIndex < 0)
+	{
+		return 0.0f;
+	}
+
+	const FBVHCompactNode& SubTreeRoot = Nodes[SubTreeRootIndex];
+	if (SubTreeRoot.IsLeaf())
+	{
+		return bInternalOnly ? 0.0f : GetSurfaceArea(SubTreeRoot.Min, SubTreeRoot.Max);
+	}
+
+	const int32 FirstChildIndex = static_cast<int32>(SubTreeRoot.Offset);
+	return GetSurfaceArea(SubTreeRoot.Min, SubTreeRoot.Max) + GetCost(FirstChildIndex, bInternalOnly) + GetCost(FirstChildIndex + 1, bInternalOnly);
 }
 
 bool FBVH::CheckValidity() const
 {
-	// 1. 루트의 인덱스가 유효한지 확인
-	if ((RootIndex < 0 && !Nodes.empty()) || RootIndex >= static_cast<int32>(Nodes.size()))
+	// 1. 비어있는 트리의 경우 값이 정상적인지 확인
+	if (Nodes.empty())
+	{
+		return RootIndex == -1 && Cost == 0.0f;
+	}
+
+	// 2. 루트는 항상 0번 노드이고, 노드가 둘 이상이면 1번 빈 칸 뒤에 자식 쌍이 이어지므로 개수는 짝수
+	const int32 NodeCount = static_cast<int32>(Nodes.size());
+	if (RootIndex != 0 || (NodeCount > 1 && NodeCount % 2 != 0))
 	{
 		return false;
 	}
 
-	// 2. 비어있는 트리의 경우 값이 정상적인지 확인
-	if (Nodes.empty())
+	// 3. 빈 칸을 제외한 모든 노드가 정확히 한 번씩 참조되고, 자식은 항상 부모보다 뒤에 있어야 함 (순환 방지)
+	TArray<uint8> ReferenceCounts(NodeCount, 0);
+	ReferenceCounts[0] = 1;
+	if (NodeCount > 1)
 	{
-		if (RootIndex != -1 || Cost != 0.0f)
-		{
-			return false;
-		}
+		ReferenceCounts[PADDING_NODE_INDEX] = 1;
 	}
+	uint64 LeafTriangleCount = 0;
 
-	// 3. 각 노드의 부모-자식 관계가 일관적인지 확인
-	for (int32 i = 0; i < static_cast<int32>(Nodes.size()); ++i)
+	for (int32 i = 0; i < NodeCount; ++i)
 	{
-		const FNode& Node = Nodes[i];
-		if (Node.bIsLeaf) // Leaf node 인 경우 자식이 없어야 함
+		if (i == PADDING_NODE_INDEX) { continue; }
+
+		const FBVHCompactNode& Node = Nodes[i];
+		if (Node.IsLeaf())
 		{
-			if (Node.Child1 != -1 || Node.Child2 != -1)
+			// 리프 노드는 반드시 유효한 인덱스 배열의 인덱스를 가져야 함
+			if (Node.Offset % 3 != 0)
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex < 0 || Node.TriangleBaseIndex % 3 != 0)
+			if (Mesh && Node.Offset + static_cast<uint64>(Node.TriangleCount) * 3 > Mesh->Indices.size())
 			{
-				return false; // 리프 노드는 반드시 유효한 인덱스 배열의 인덱스를 가져야 함
+				return false;
 			}
+			LeafTriangleCount += Node.TriangleCount;
 		}
-		else // Internal Node 인 경우 자식이 있어야 함
+		else
 		{
-			if (Node.Child1 == -1 || Node.Child2 == -1)
+			// 두 자식이 짝수 인덱스부터 배열 안에 인접해 있어야 함
+			if (Node.Offset <= static_cast<uint32>(PADDING_NODE_INDEX) || Node.Offset % 2 != 0 ||
+				Node.Offset <= static_cast<uint32>(i) || Node.Offset + 1 >= static_cast<uint32>(NodeCount))
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex != -1)
-			{
-				return false; // 내부 노드는 인덱스를 가져선 안됨
-			}
-			// 자식 노드들이 올바른 부모 인덱스를 가리키는지 확인
-			if (Node.Child1 < 0 || Node.Child1 >= static_cast<int32>(Nodes.size()) ||
-				Node.Child2 < 0 || Node.Child2 >= static_cast<int32>(Nodes.size()))
-			{
-				return false;
-			}
-			const FNode& Child1 = Nodes[Node.Child1];
-			const FNode& Child2 = Nodes[Node.Child2];
-			if (Child1.ParentIndex != i || Child2.ParentIndex != i)
+			if (++ReferenceCounts[Node.Offset] > 1 || ++ReferenceCounts[Node.Offset + 1] > 1)
 			{
 				return false;
 			}
 		}
+	}
 
-		// 부모 인덱스가 유효한지 확인 (루트는 제외)
-		if (Node.ParentIndex != -1)
-		{
-			if (Node.ParentIndex < 0 || Node.ParentIndex >= static_cast<int32>(Nodes.size()))
-			{
-				return false;
-			}
-		}
-		else if (i != RootIndex) // 루트가 아닌데 부모가 없는 경우
+	for (uint8 ReferenceCount : ReferenceCounts)
+	{
+		if (ReferenceCount != 1)
 		{
 			return false;
 		}
 	}
-	return true;
+
+	// 4. 모든 삼각형이 리프에 들어 있어야 함
+	return !Mesh || LeafTriangleCount == Mesh->Indices.size() / 3;
+}
+
+void MakeBVHBenchmarkRays(const FAABB& InBox, int32 InRayCount, TArray<FRay>& OutRays)
+{
+	const FVector Center = InBox.GetCenter();
+	const FVector Extent = (InBox.Max - InBox.Min) * 0.5f;
+	const float Radius = max(Extent.Length(), MATH_EPSILON) * 2.0f;
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	OutRays.resize(InRayCount);
+	for (FRay& Ray : OutRays)
+	{
+		FVector Offset(Unit(Random), Unit(Random), Unit(Random));
+		Offset.Normalize();
+		const FVector Origin = Center + Offset * Radius;
+		const FVector Target(Center.X + Extent.X * Unit(Random), Center.Y + Extent.Y * Unit(Random), Center.Z + Extent.Z * Unit(Random));
+		FVector Direction = Target - Origin;
+		Direction.Normalize();
+
+		Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+		Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+	}
 }
 
 FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2)
@@ -410,7 +565,9 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 	}
 	
 	// 스택을 사용한 반복적 순회로 구현 (재귀보다 성능상 유리)
+	const FRayTraversalData RayData = MakeRayTraversalData(Ray);
 	TArray<int32> NodeStack;
+	NodeStack.reserve(64);
 	NodeStack.push_back(RootIndex);
 	
 	while (!NodeStack.empty())
@@ -418,15 +575,16 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 		int32 CurrentNodeIndex = NodeStack.back();
 		NodeStack.pop_back();
 		
-		const FNode& CurrentNode = Nodes[CurrentNodeIndex];
+		const FBVHCompactNode& CurrentNode = Nodes[CurrentNodeIndex];
 		
-		// Ray와 현재 노드의 AABB 교차 검사
-		if (!CheckIntersectionRayBox(Ray, CurrentNode.Box))
+		// Ray와 현재 노드의 AABB 교차 검사 (CheckIntersectionRayBox와 같이 Ray 뒤쪽의 Box는 제외)
+		float EntryT;
+		if (!GetRayBoxEntry(RayData, CurrentNode.Min, CurrentNode.Max, 0.0f, FLT_MAX, EntryT))
 		{
 			continue; // AABB와 교차하지 않으면 이 노드의 자식들도 건너뜀
 		}
 		
-		if (CurrentNode.bIsLeaf)
+		if (CurrentNode.IsLeaf())
 		{
 			// 리프 노드인 경우 삼각형 인덱스 추가
 			// ------------------------------------------------------------------------------------
@@ -434,27 +592,120 @@ bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
 			// BVH 외부에서는 삼각형 인덱스 = 인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호를 의미하므로(Triangle ordinal)
 			// 의미 통일을 위해 외부 반환시 3으로 나누어 사용
 			// ------------------------------------------------------------------------------------
-			OutTriangleIndices.push_back(CurrentNode.TriangleBaseIndex / 3);
+			for (uint32 Triangle = 0; Triangle < CurrentNode.TriangleCount; ++Triangle)
+			{
+				OutTriangleIndices.push_back(static_cast<int32>(CurrentNode.Offset / 3 + Triangle));
+			}
 		}
 		else
 		{
-			// 내부 노드인 경우 자식들을 스택에 추가
-			// 자식 인덱스가 유효한지 확인
-			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+			// 내부 노드인 경우 인접한 두 자식을 스택에 추가
+			NodeStack.push_back(static_cast<int32>(CurrentNode.Offset) + 1);
+			NodeStack.push_back(static_cast<int32>(CurrentNode.Offset));
+		}
+	}
+	
+	return true; // Traverse successful
+}
+
+bool FBVH::IntersectRayClosest(const FRay& Ray, float InMinT, float InMaxT, FBVHRayHit& OutHit, FBVHTraversalStats* OutStats) const
+{
+	OutHit = FBVHRayHit();
+	if (!Mesh || RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()) || InMinT > InMaxT)
+	{
+		return false;
+	}
+
+	const FRayTraversalData RayData = MakeRayTraversalData(Ray);
+	const FVector RayOrigin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+	const FVector RayDirection(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+
+	float ClosestT = InMaxT;
+	uint32 NodeVisitCount = 0;
+	uint32 TriangleTestCount = 0;
+
+	// (노드, 진입 거리) 스택. 가까운 자식을 나중에 넣어 먼저 꺼낸다
+	TArray<std::pair<int32, float>> NodeStack;
+	NodeStack.reserve(64);
+
+	float RootEntryT;
+	if (GetRayBoxEntry(RayData, Nodes[RootIndex].Min, Nodes[RootIndex].Max, InMinT, ClosestT, RootEntryT))
+	{
+		NodeStack.push_back({ RootIndex, RootEntryT });
+	}
+
+	while (!NodeStack.empty())
+	{
+		const auto [CurrentNodeIndex, EntryT] = NodeStack.back();
+		NodeStack.pop_back();
+
+		// 스택에 넣은 뒤 더 가까운 교차가 발견되었다면 건너뜀
+		if (EntryT > ClosestT) { continue; }
+
+		const FBVHCompactNode& CurrentNode = Nodes[CurrentNodeIndex];
+		++NodeVisitCount;
+
+		if (CurrentNode.IsLeaf())
+		{
+			for (uint32 Triangle = 0; Triangle < CurrentNode.TriangleCount; ++Triangle)
+			{
+				++TriangleTestCount;
+				const uint32 BaseIndex = CurrentNode.Offset + Triangle * 3;
+				float HitT;
+				if (IntersectRayTriangle(RayOrigin, RayDirection,
+					Mesh->Vertices[Mesh->Indices[BaseIndex]].Position,
+					Mesh->Vertices[Mesh->Indices[BaseIndex + 1]].Position,
+					Mesh->Vertices[Mesh->Indices[BaseIndex + 2]].Position, HitT) &&
+					HitT >= InMinT && HitT <= ClosestT)
+				{
+					ClosestT = HitT;
+					OutHit.T = HitT;
+					OutHit.TriangleIndex = static_cast<int32>(BaseIndex / 3);
+				}
+			}
+			continue;
+		}
+
+		// 두 자식은 64 bytes 경계에서 시작하는 한 쌍이므로 한 번의 캐시 라인 접근으로 함께 읽힌다
+		const int32 Child1 = static_cast<int32>(CurrentNode.Offset);
+		const int32 Child2 = Child1 + 1;
+		float Child1EntryT, Child2EntryT;
+		const bool bHitChild1 = GetRayBoxEntry(RayData, Nodes[Child1].Min, Nodes[Child1].Max, InMinT, ClosestT, Child1EntryT);
+		const bool bHitChild2 = GetRayBoxEntry(RayData, Nodes[Child2].Min, Nodes[Child2].Max, InMinT, ClosestT, Child2EntryT);
+
+		if (bHitChild1 && bHitChild2)
+		{
+			if (Child1EntryT <= Child2EntryT)
 			{
-				NodeStack.push_back(CurrentNode.Child1);
+				NodeStack.push_back({ Child2, Child2EntryT });
+				NodeStack.push_back({ Child1, Child1EntryT });
 			}
-			if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
+			else
 			{
-				NodeStack.push_back(CurrentNode.Child2);
+				NodeStack.push_back({ Child1, Child1EntryT });
+				NodeStack.push_back({ Child2, Child2EntryT });
 			}
 		}
+		else if (bHitChild1)
+		{
+			NodeStack.push_back({ Child1, Child1EntryT });
+		}
+		else if (bHitChild2)
+		{
+			NodeStack.push_back({ Child2, Child2EntryT });
+		}
 	}
-	
-	return true; // Traverse successful
+
+	if (OutStats)
+	{
+		OutStats->NodeVisitCount += NodeVisitCount;
+		OutStats->TriangleTestCount += TriangleTestCount;
+	}
+
+	return OutHit.TriangleIndex >= 0;
 }
 
-void FBVH::Build(FStaticMesh* InMesh)
+void FBVH::Build(FStaticMesh* InMesh, EBVHBuildMethod InMethod)
 {
 	if (!InMesh)
 	{
@@ -463,12 +714,21 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 	Clear();
 	Mesh = InMesh;
-	// 모든 삼각형에 대해 Leaf 노드 삽입
-	int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
-	for (int32 i = 0; i < TriangleCount; ++i)
+
+	if (InMethod == EBVHBuildMethod::BinnedSAH)
+	{
+		BuildBinnedSAH();
+	}
+	else
 	{
-		int32 TriangleBaseIndex = i * 3;
-		InsertLeaf(TriangleBaseIndex);
+		// 모든 삼각형에 대해 Leaf 노드 삽입
+		int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
+		for (int32 i = 0; i < TriangleCount; ++i)
+		{
+			int32 TriangleBaseIndex = i * 3;
+			InsertLeaf(TriangleBaseIndex);
+		}
+		FlattenBuildNodes();
 	}
 	// 전체 비용 계산
 	Cost = GetCost(RootIndex);
@@ -479,3 +739,343 @@ void FBVH::Build(FStaticMesh* InMesh)
 	}
 }
 
+void FBVH::BuildBinnedSAH()
+{
+	const int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
+	if (TriangleCount == 0) { return; }
+
+	// 1. 삼각형마다 AABB와 중심을 미리 계산
+	TArray<FBuildTriangle> Triangles(TriangleCount);
+	FTaskScheduler::GetInstance().ParallelFor(TriangleCount, [&](int32 TriangleIndex)
+	{
+		const int32 TriangleBaseIndex = TriangleIndex * 3;
+		const FAABB TriangleAABB = GetTriangleAABB(
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex]],
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 1]],
+			Mesh->Vertices[Mesh->Indices[TriangleBaseIndex + 2]]);
+
+		FBuildTriangle& Triangle = Triangles[TriangleIndex];
+		Triangle.Min = TriangleAABB.Min;
+		Triangle.Max = TriangleAABB.Max;
+		Triangle.Centroid = (TriangleAABB.Min + TriangleAABB.Max) * 0.5f;
+		Triangle.TriangleBaseIndex = TriangleBaseIndex;
+	});
+
+	// 2. 리프가 삼각형 하나씩인 이진 트리이므로 노드 수는 정확히 2n - 1
+	//    루트 뒤의 빈 칸(1번)까지 2n칸을 잡고, 자손은 2번부터 배치한다
+	Nodes.resize(TriangleCount > 1 ? 2 * TriangleCount : 1);
+	RootIndex = 0;
+
+	// 3. 상위 레벨은 순차로 분할하고, 충분히 작아진 서브트리는 Worker들이 나누어 구축
+	const int32 ThreadCount = FTaskScheduler::GetInstance().GetThreadCount();
+	const int32 GrainSize = max(TriangleCount / (ThreadCount * 4), MIN_PARALLEL_GRAIN_SIZE);
+
+	TArray<FBuildTask> Tasks;
+	BuildBinnedSAHRange(Triangles, 0, TriangleCount, 0, PADDING_NODE_INDEX + 1, ThreadCount > 1 ? &Tasks : nullptr, GrainSize);
+
+	FTaskScheduler::GetInstance().ParallelFor(static_cast<int32>(Tasks.size()), [&](int32 TaskIndex)
+	{
+		const FBuildTask& Task = Tasks[TaskIndex];
+		BuildBinnedSAHRange(Triangles, Task.Begin, Task.End, Task.NodeIndex, Task.FirstChildIndex, nullptr, GrainSize);
+	});
+}
+
+void FBVH::BuildBinnedSAHRange(TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End, int32 NodeIndex, int32 FirstChildIndex,
+	TArray<FBuildTask>* OutDeferredTasks, int32 InGrainSize)
+{
+	if (OutDeferredTasks && End - Begin <= InGrainSize)
+	{
+		OutDeferredTasks->push_back({ Begin, End, NodeIndex, FirstChildIndex });
+		return;
+	}
+
+	// 구간의 AABB (노드 AABB)와 중심점 범위 계산
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX), CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (int32 Index = Begin; Index < End; ++Index)
+	{
+		GrowBounds(Min, Max, Triangles[Index].Min, Triangles[Index].Max);
+		GrowBounds(CentroidMin, CentroidMax, Triangles[Index].Centroid, Triangles[Index].Centroid);
+	}
+
+	FBVHCompactNode& Node = Nodes[NodeIndex];
+	SetNodeBounds(Node, Min, Max);
+
+	// 삼각형 하나만 남으면 리프
+	if (End - Begin == 1)
+	{
+		Node.Offset = static_cast<uint32>(Triangles[Begin].TriangleBaseIndex);
+		Node.TriangleCount = 1;
+		return;
+	}
+
+	const int32 Mid = PartitionBinnedSAH(Triangles, Begin, End, CentroidMin, CentroidMax);
+
+	// 자식 한 쌍은 [FirstChildIndex, FirstChildIndex + 2), 왼쪽 자식의 자손은 그 다음부터 2 * (왼쪽 삼각형 수) - 2칸,
+	// 오른쪽 자식의 자손은 그 뒤를 차지
+	Node.Offset = static_cast<uint32>(FirstChildIndex);
+	Node.TriangleCount = 0;
+
+	BuildBinnedSAHRange(Triangles, Begin, Mid, FirstChildIndex, FirstChildIndex + 2, OutDeferredTasks, InGrainSize);
+	BuildBinnedSAHRange(Triangles, Mid, End, FirstChildIndex + 1, FirstChildIndex + 2 * (Mid - Begin), OutDeferredTasks, InGrainSize);
+}
+
+int32 FBVH::PartitionBinnedSAH(TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End, const FVector& CentroidMin, const FVector& CentroidMax)
+{
+	float BestCost = FLT_MAX;
+	int32 BestAxis = -1;
+	int32 BestSplit = -1;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float AxisMin = GetAxis(CentroidMin, Axis);
+		const float Extent = GetAxis(CentroidMax, Axis) - AxisMin;
+		if (Extent <= 0.0f) { continue; }
+
+		// 1. 중심점을 Bin에 분배
+		FSAHBin Bins[SAH_BIN_COUNT];
+		const float BinScale = SAH_BIN_COUNT / Extent;
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FBuildTriangle& Triangle = Triangles[Index];
+			const int32 BinIndex = min(static_cast<int32>((GetAxis(Triangle.Centroid, Axis) - AxisMin) * BinScale), SAH_BIN_COUNT - 1);
+			GrowBounds(Bins[BinIndex].Min, Bins[BinIndex].Max, Triangle.Min, Triangle.Max);
+			++Bins[BinIndex].Count;
+		}
+
+		// 2. 오른쪽에서부터 누적한 표면적/개수를 구해두고, 왼쪽에서 누적하며 각 경계의 SAH 비용 계산
+		float RightArea[SAH_BIN_COUNT];
+		int32 RightCount[SAH_BIN_COUNT];
+		FVector AccumMin(FLT_MAX, FLT_MAX, FLT_MAX), AccumMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		int32 AccumCount = 0;
+		for (int32 BinIndex = SAH_BIN_COUNT - 1; BinIndex > 0; --BinIndex)
+		{
+			if (Bins[BinIndex].Count > 0) { GrowBounds(AccumMin, AccumMax, Bins[BinIndex].Min, Bins[BinIndex].Max); }
+			AccumCount += Bins[BinIndex].Count;
+			RightArea[BinIndex] = AccumCount > 0 ? GetSurfaceArea(AccumMin, AccumMax) : 0.0f;
+			RightCount[BinIndex] = AccumCount;
+		}
+
+		AccumMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		AccumMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		AccumCount = 0;
+		for (int32 Split = 1; Split < SAH_BIN_COUNT; ++Split)
+		{
+			const FSAHBin& LeftBin = Bins[Split - 1];
+			if (LeftBin.Count > 0) { GrowBounds(AccumMin, AccumMax, LeftBin.Min, LeftBin.Max); }
+			AccumCount += LeftBin.Count;
+
+			// 한쪽이 비는 분할은 제외
+			if (AccumCount == 0 || RightCount[Split] == 0) { continue; }
+
+			const float SplitCost = GetSurfaceArea(AccumMin, AccumMax) * AccumCount + RightArea[Split] * RightCount[Split];
+			if (SplitCost < BestCost)
+			{
+				BestCost = SplitCost;
+				BestAxis = Axis;
+				BestSplit = Split;
+			}
+		}
+	}
+
+	// 모든 중심점이 한 점에 모여 있으면 구간의 가운데에서 나눈다
+	if (BestAxis < 0)
+	{
+		return Begin + (End - Begin) / 2;
+	}
+
+	// 3. 선택한 경계를 기준으로 구간을 분할 (Bin 계산은 위와 같은 식을 사용해야 결과가 일치한다)
+	const float AxisMin = GetAxis(CentroidMin, BestAxis);
+	const float BinScale = SAH_BIN_COUNT / (GetAxis(CentroidMax, BestAxis) - AxisMin);
+	auto MidIt = std::partition(Triangles.begin() + Begin, Triangles.begin() + End, [&](const FBuildTriangle& Triangle)
+	{
+		return min(static_cast<int32>((GetAxis(Triangle.Centroid, BestAxis) - AxisMin) * BinScale), SAH_BIN_COUNT - 1) < BestSplit;
+	});
+
+	return static_cast<int32>(MidIt - Triangles.begin());
+}
+
+void RunBVHBuildBenchmark(FStaticMesh* InMesh)
+{
+	if (!InMesh) { return; }
+
+	auto MeasureBuild = [InMesh](EBVHBuildMethod InMethod, float& OutCost, int32& OutNodeCount, bool& bOutIsValid)
+	{
+		FBVH BVH;
+		const double ElapsedMs = FBenchmark::MeasureOnce([&]() { BVH.Build(InMesh, InMethod); });
+
+		OutCost = BVH.GetCost(BVH.GetRootIndex());
+		OutNodeCount = BVH.GetNodeCount();
+		bOutIsValid = BVH.CheckValidity();
+		return ElapsedMs;
+	};
+
+	float IncrementalCost, BinnedCost;
+	int32 IncrementalNodeCount, BinnedNodeCount;
+	bool bIsIncrementalValid, bIsBinnedValid;
+	const double IncrementalMs = MeasureBuild(EBVHBuildMethod::Incremental, IncrementalCost, IncrementalNodeCount, bIsIncrementalValid);
+	const double BinnedMs = MeasureBuild(EBVHBuildMethod::BinnedSAH, BinnedCost, BinnedNodeCount, bIsBinnedValid);
+
+	UE_LOG_INFO("BVH Build: %s (%zu triangles)", InMesh->PathFileName.ToString().c_str(), InMesh->Indices.size() / 3);
+	UE_LOG_INFO("  Incremental : %.2f ms, cost %.1f, nodes %d%s", IncrementalMs, IncrementalCost, IncrementalNodeCount, bIsIncrementalValid ? "" : " (INVALID)");
+	UE_LOG_INFO("  Binned SAH  : %.2f ms, cost %.1f, nodes %d%s", BinnedMs, BinnedCost, BinnedNodeCount, bIsBinnedValid ? "" : " (INVALID)");
+}
+
+void RunBVHPickBenchmark(FStaticMesh* InMesh)
+{
+	constexpr int32 RAY_COUNT = 4096;
+
+	if (!InMesh || InMesh->BVH.GetRootIndex() < 0) { return; }
+
+	// 메시를 둘러싼 구 위의 점에서 메시 경계 안의 임의의 점을 향하는 Ray
+	TArray<FRay> Rays;
+	MakeBVHBenchmarkRays(InMesh->BVH.GetNodeBounds(InMesh->BVH.GetRootIndex()), RAY_COUNT, Rays);
+
+	const FBVH& BVH = InMesh->BVH;
+
+	// 1. 기존 방식: 교차하는 리프의 삼각형을 모두 모은 뒤 전부 검사
+	uint64 AllCandidateTests = 0;
+	uint32 AllCandidateHits = 0;
+	TArray<int32> Candidates;
+	const double AllCandidateMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays)
+		{
+			BVH.TraverseRay(Ray, Candidates);
+			AllCandidateTests += Candidates.size();
+
+			const FVector Origin(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z);
+			const FVector Direction(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z);
+			bool bIsHit = false;
+			for (int32 TriangleIndex : Candidates)
+			{
+				float HitT;
+				if (IntersectRayTriangle(Origin, Direction,
+					InMesh->Vertices[InMesh->Indices[TriangleIndex * 3]].Position,
+					InMesh->Vertices[InMesh->Indices[TriangleIndex * 3 + 1]].Position,
+					InMesh->Vertices[InMesh->Indices[TriangleIndex * 3 + 2]].Position, HitT) && HitT >= 0.0f)
+				{
+					bIsHit = true;
+				}
+			}
+			AllCandidateHits += bIsHit ? 1 : 0;
+		}
+	});
+
+	// 2. Closest-hit 순회
+	FBVHTraversalStats Stats;
+	uint32 ClosestHits = 0;
+	const double ClosestMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays)
+		{
+			FBVHRayHit Hit;
+			ClosestHits += BVH.IntersectRayClosest(Ray, 0.0f, FLT_MAX, Hit, &Stats) ? 1 : 0;
+		}
+	});
+
+	UE_LOG_INFO("BVH Pick: %s (%zu triangles, %d rays)", InMesh->PathFileName.ToString().c_str(), InMesh->Indices.size() / 3, RAY_COUNT);
+	UE_LOG_INFO("  All candidates : %.1f triangle tests/pick, %.3f ms/pick, hits %u",
+		static_cast<double>(AllCandidateTests) / RAY_COUNT, AllCandidateMs / RAY_COUNT, AllCandidateHits);
+	UE_LOG_INFO("  Closest hit    : %.1f triangle tests/pick, %.1f nodes/pick, %.3f ms/pick, hits %u",
+		static_cast<double>(Stats.TriangleTestCount) / RAY_COUNT, static_cast<double>(Stats.NodeVisitCount) / RAY_COUNT,
+		ClosestMs / RAY_COUNT, ClosestHits);
+}
+
+void RunBVHLayoutBenchmark(FStaticMesh* InMesh)
+{
+	constexpr int32 RAY_COUNT = 4096;
+
+	if (!InMesh || InMesh->BVH.GetRootIndex() < 0) { return; }
+
+	const FBVH& BVH = InMesh->BVH;
+	const int32 NodeCount = BVH.GetNodeCount();
+	const size_t TriangleCount = max<size_t>(InMesh->Indices.size() / 3, 1);
+
+	// 1. 같은 트리를 기존 레이아웃(FNode, 부모/자식 인덱스와 FAABB를 가진 노드)으로 복원
+	TArray<FNode> LegacyNodes(NodeCount);
+	for (int32 Index = 0; Index < NodeCount; ++Index)
+	{
+		if (Index == FBVH::PADDING_NODE_INDEX) { continue; }
+
+		const FBVHCompactNode& Node = BVH.GetNode(Index);
+		FNode& LegacyNode = LegacyNodes[Index];
+		LegacyNode.ObjectIndex = Index;
+		LegacyNode.Box = BVH.GetNodeBounds(Index);
+		LegacyNode.bIsLeaf = Node.IsLeaf();
+		LegacyNode.Child1 = Node.IsLeaf() ? -1 : static_cast<int32>(Node.Offset);
+		LegacyNode.Child2 = Node.IsLeaf() ? -1 : static_cast<int32>(Node.Offset) + 1;
+		LegacyNode.TriangleBaseIndex = Node.IsLeaf() ? static_cast<int32>(Node.Offset) : -1;
+		if (Index == 0) { LegacyNode.ParentIndex = -1; }
+		if (!Node.IsLeaf())
+		{
+			LegacyNodes[Node.Offset].ParentIndex = Index;
+			LegacyNodes[Node.Offset + 1].ParentIndex = Index;
+		}
+	}
+
+	TArray<FRay> Rays;
+	MakeBVHBenchmarkRays(BVH.GetNodeBounds(BVH.GetRootIndex()), RAY_COUNT, Rays);
+
+	// 기존 TraverseRay와 같은 순회를 FNode 배열에서 수행 (bUseSlabData면 압축 노드 순회와 같은 Box 판정 사용)
+	auto TraverseLegacy = [&LegacyNodes](const FRay& Ray, bool bUseSlabData, TArray<int32>& OutTriangleIndices)
+	{
+		OutTriangleIndices.clear();
+		const FRayTraversalData RayData = MakeRayTraversalData(Ray);
+		TArray<int32> NodeStack;
+		NodeStack.reserve(64);
+		NodeStack.push_back(0);
+		while (!NodeStack.empty())
+		{
+			const FNode& Node = LegacyNodes[NodeStack.back()];
+			NodeStack.pop_back();
+
+			float EntryT;
+			const bool bIsHit = bUseSlabData
+				? GetRayBoxEntry(RayData, Node.Box.Min, Node.Box.Max, 0.0f, FLT_MAX, EntryT)
+				: CheckIntersectionRayBox(Ray, Node.Box);
+			if (!bIsHit) { continue; }
+
+			if (Node.bIsLeaf)
+			{
+				OutTriangleIndices.push_back(Node.TriangleBaseIndex / 3);
+			}
+			else
+			{
+				NodeStack.push_back(Node.Child2);
+				NodeStack.push_back(Node.Child1);
+			}
+		}
+	};
+
+	TArray<int32> Candidates;
+	auto Measure = [&](const TFunction<void(const FRay&)>& InTraverse, uint64& OutCandidateCount)
+	{
+		OutCandidateCount = 0;
+		return FBenchmark::MeasureAverage([&]()
+		{
+			for (const FRay& Ray : Rays)
+			{
+				InTraverse(Ray);
+				OutCandidateCount += Candidates.size();
+			}
+		}) / RAY_COUNT;
+	};
+
+	uint64 LegacyCandidates, LegacySlabCandidates, CompactCandidates;
+	const double LegacyMs = Measure([&](const FRay& Ray) { TraverseLegacy(Ray, false, Candidates); }, LegacyCandidates);
+	const double LegacySlabMs = Measure([&](const FRay& Ray) { TraverseLegacy(Ray, true, Candidates); }, LegacySlabCandidates);
+	const double CompactMs = Measure([&](const FRay& Ray) { BVH.TraverseRay(Ray, Candidates); }, CompactCandidates);
+
+	const double LegacyBytes = static_cast<double>(sizeof(FNode)) * NodeCount;
+	const double CompactBytes = static_cast<double>(sizeof(FBVHCompactNode)) * NodeCount;
+
+	UE_LOG_INFO("BVH Layout: %s (%zu triangles, %d nodes, %d rays)", InMesh->PathFileName.ToString().c_str(), InMesh->Indices.size() / 3, NodeCount, RAY_COUNT);
+	UE_LOG_INFO("  FNode (%zu B)           : %.1f B/triangle, %.4f ms/ray", sizeof(FNode), LegacyBytes / TriangleCount, LegacyMs);
+	UE_LOG_INFO("  FNode + same slab test : %.1f B/triangle, %.4f ms/ray", LegacyBytes / TriangleCount, LegacySlabMs);
+	UE_LOG_INFO("  Compact node (%zu B)    : %.1f B/triangle, %.4f ms/ray", sizeof(FBVHCompactNode), CompactBytes / TriangleCount, CompactMs);
+	if (LegacyCandidates != CompactCandidates || LegacySlabCandidates != CompactCandidates)
+	{
+		UE_LOG_INFO("  candidate count mismatch: %llu / %llu / %llu", LegacyCandidates, LegacySlabCandidates, CompactCandidates);
+	}
+}
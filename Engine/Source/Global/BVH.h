@@ -16,20 +16,71 @@ struct FNode
 	int32 TriangleBaseIndex; // �ε��� ���ۿ��� �ﰢ���� ���� �ε���
 };
 
+/**
+ * @brief 순회에 사용하는 압축 BVH 노드 (32 bytes)
+ * 두 자식은 항상 짝수 인덱스부터 인접한 두 칸에 저장되므로 내부 노드는 첫 번째 자식의 인덱스만 가진다
+ * FBVH는 노드 배열을 64 bytes 경계에 할당하므로 형제 한 쌍이 캐시 라인 하나에 들어간다
+ */
+struct alignas(32) FBVHCompactNode
+{
+	float Min[3];
+	float Max[3];
+	// 내부 노드: 첫 번째 자식 인덱스 (두 번째 자식은 Offset + 1) / 리프: 인덱스 버퍼에서 첫 삼각형의 위치
+	uint32 Offset;
+	// 리프가 가진 삼각형 수 (0이면 내부 노드)
+	uint32 TriangleCount;
+
+	bool IsLeaf() const { return TriangleCount != 0; }
+};
+static_assert(sizeof(FBVHCompactNode) == 32, "FBVHCompactNode must be 32 bytes");
+
+// FBVH::IntersectRayClosest의 결과
+struct FBVHRayHit
+{
+	int32 TriangleIndex = -1;	// 삼각형 번호 (인덱스 버퍼를 3개 단위로 묶었을 때의 번호)
+	float T = FLT_MAX;			// Ray 파라미터 (Origin + Direction * T)
+};
+
+// 순회 비용 측정용 통계
+struct FBVHTraversalStats
+{
+	uint32 NodeVisitCount = 0;
+	uint32 TriangleTestCount = 0;
+};
+
+// BVH 구축 방식
+enum class EBVHBuildMethod : uint8
+{
+	Incremental,	// 삼각형을 하나씩 삽입 (FindBestSibling으로 비용 증가가 가장 작은 위치 탐색)
+	BinnedSAH,		// 삼각형 중심을 축마다 Bin으로 나누어 SAH가 최소인 평면으로 Top-down 분할 (서브트리 병렬 구축)
+};
+
 //  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
+//  구축이 끝난 트리는 FBVHCompactNode 배열로 저장되며, 루트는 항상 0번 노드이다
+//  1번은 형제 쌍을 짝수 인덱스에 맞추기 위해 비워 두는 칸으로, 어떤 노드도 가리키지 않는다 (삼각형이 하나면 루트만 있음)
 class FBVH
 {
 public:
+	static constexpr int32 PADDING_NODE_INDEX = 1;
+	// 형제 한 쌍 (2 * 32 bytes)이 캐시 라인 하나에 맞도록 노드 배열을 정렬하는 단위
+	static constexpr size_t NODE_ARRAY_ALIGNMENT = 64;
+
 	FBVH() = default;
-	explicit FBVH(FStaticMesh* InMesh);
+	explicit FBVH(FStaticMesh* InMesh, EBVHBuildMethod InMethod = EBVHBuildMethod::BinnedSAH);
 
-	void Build(FStaticMesh* InMesh);
+	void Build(FStaticMesh* InMesh, EBVHBuildMethod InMethod = EBVHBuildMethod::BinnedSAH);
 	int32 GetRootIndex() const { return RootIndex; }
 	int32 GetNodeCount() const { return Nodes.size(); }
-	const FNode& GetNode(uint32 Index) const;
-	FNode& GetNode(uint32 Index);
+	const FBVHCompactNode& GetNode(uint32 Index) const;
+	FAABB GetNodeBounds(uint32 Index) const;
 	void Clear();
 
+	/**
+	* @brief 구축이 끝난 압축 노드 배열을 저장/로드 (Cooked 메시 캐시용)
+	* @param InMesh: 로드 시 트리가 참조할 메시 (Indices가 저장 당시와 같은 순서여야 함)
+	*/
+	void Serialize(FArchive& Ar, FStaticMesh* InMesh);
+
 	/**
 	* @brief 서브트리의 cost(노드가 가진 AABB의 표면적 합)을 계산.
 	* @param SubTreeRootIndex: cost 계산 시작 노드 인덱스
@@ -51,8 +102,20 @@ public:
 	*/
 	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
 
+	/**
+	* @brief: Ray와 가장 가까운 삼각형 교차를 찾음 (리프에서 직접 삼각형 교차 검사).
+	* 가까운 자식을 먼저 방문하고, 진입 거리가 현재 최단 교차보다 먼 서브트리는 건너뛴다.
+	* @param Ray: 교차 검사를 수행할 Ray (Local 좌표계)
+	* @param InMinT, InMaxT: 유효한 교차로 인정할 Ray 파라미터 범위
+	* @param OutHit: 가장 가까운 교차 (output)
+	* @param OutStats: 방문한 노드/검사한 삼각형 수를 누적할 통계 (nullptr 가능)
+	* @return: 범위 내 교차가 있으면 true
+	*/
+	bool IntersectRayClosest(const FRay& Ray, float InMinT, float InMaxT, FBVHRayHit& OutHit, FBVHTraversalStats* OutStats = nullptr) const;
+
 	/**
 	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
+	* @note: Incremental 구축 중의 작업용 트리(BuildNodes) 기준
 	* @param CandidateIndex: 후보 형제 노드 인덱스
 	* @param NewLeafAABB: 새로운 리프 노드의 AABB
 	* @return: 비용 증가량
@@ -75,11 +138,77 @@ private:
 	void InsertInternalNode(int32 LeafIndex, int32 SiblingIndex);
 	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
 	void RefitAncestors(int32 RefitStartIndex);
+	//@brief 작업용 트리(BuildNodes)의 서브트리 cost 계산 (GetCost와 같은 기준)
+	float GetBuildCost(int32 SubTreeRootIndex, bool bInternalOnly = false) const;
+	//@brief 작업용 트리를 형제가 인접한 압축 노드 배열로 옮기고 작업용 트리를 해제.
+	void FlattenBuildNodes();
+
+	// --- Binned SAH 구축 보조 ---
+
+	struct FBuildTriangle
+	{
+		FVector Min;
+		FVector Max;
+		FVector Centroid;
+		int32 TriangleBaseIndex;
+	};
+
+	// 병렬 처리로 미뤄둔 서브트리 구축 작업
+	struct FBuildTask
+	{
+		int32 Begin;
+		int32 End;
+		int32 NodeIndex;
+		int32 FirstChildIndex;
+	};
+
+	void BuildBinnedSAH();
+
+	/**
+	* @brief Triangles[Begin, End)로 NodeIndex를 루트로 하는 서브트리를 압축 노드 배열에 직접 구축.
+	* @note 삼각형 n개 서브트리의 자손 노드는 [FirstChildIndex, FirstChildIndex + 2n - 2)를 차지한다.
+	*       자식 한 쌍이 맨 앞 두 칸에 놓이고, 그 뒤에 왼쪽 자식의 자손, 오른쪽 자식의 자손이 차례로 이어지므로
+	*       서로 다른 서브트리는 겹치지 않는 구간에 독립적으로(병렬로) 기록할 수 있다.
+	* @param OutDeferredTasks nullptr이 아니면, 삼각형 수가 InGrainSize 이하인 서브트리는 구축하지 않고 작업으로 넘긴다
+	*/
+	void BuildBinnedSAHRange(TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End, int32 NodeIndex, int32 FirstChildIndex,
+		TArray<FBuildTask>* OutDeferredTasks, int32 InGrainSize);
+
+	/**
+	* @brief Triangles[Begin, End)를 SAH 비용이 최소인 Bin 경계로 분할하고 분할 위치를 반환.
+	* @note 중심점이 모두 같아 나눌 수 없으면 구간의 가운데에서 나눈다.
+	*/
+	static int32 PartitionBinnedSAH(TArray<FBuildTriangle>& Triangles, int32 Begin, int32 End, const FVector& CentroidMin, const FVector& CentroidMax);
 
 	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
-	TArray<FNode> Nodes;
+	TArray<FBVHCompactNode, TAlignedAllocator<FBVHCompactNode, NODE_ARRAY_ALIGNMENT>> Nodes;
 	int32 RootIndex = -1;
+	// Incremental 구축 중에만 사용하는 부모 링크가 있는 작업용 트리 (구축 후 Nodes로 옮기고 비운다)
+	TArray<FNode> BuildNodes;
+	int32 BuildRootIndex = -1;
 	float Cost = 0.0f;
 };
 
-FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
\ No newline at end of file
+FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
+
+/**
+* @brief 벤치마크용: Box를 둘러싼 구 위의 점에서 Box 안의 임의의 점을 향하는 Ray들을 생성 (고정 시드)
+*/
+void MakeBVHBenchmarkRays(const FAABB& InBox, int32 InRayCount, TArray<FRay>& OutRays);
+
+/**
+* @brief 같은 메시로 두 구축 방식의 구축 시간과 SAH 비용(GetCost)을 비교하여 로그로 출력
+*/
+void RunBVHBuildBenchmark(FStaticMesh* InMesh);
+
+/**
+* @brief 메시 경계를 향하는 임의의 Ray들로 TraverseRay(후보 전체 검사)와 IntersectRayClosest의
+* 피킹 1회당 삼각형 검사 수와 시간을 비교하여 로그로 출력
+*/
+void RunBVHPickBenchmark(FStaticMesh* InMesh);
+
+/**
+* @brief 같은 트리를 기존 노드 레이아웃(FNode)과 압축 노드 레이아웃으로 표현했을 때의
+* 삼각형당 메모리와 TraverseRay 시간을 비교하여 로그로 출력
+*/
+void RunBVHLayoutBenchmark(FStaticMesh* InMesh);
@@ -165,3 +165,12 @@ enum class EFillMode : uint8_t
 
 	End = 0xFF
 };
+
+/**
+ * @brief Occlusion Culling CPU 깊이 버퍼 형식
+ */
+enum class EOcclusionBufferType : uint8
+{
+	Float,	// 픽셀별 float 깊이 (256x256)
+	Masked,	// 32x8 타일별 Coverage Bitmask + 보수적 깊이 2개 (고해상도용)
+};
@@ -0,0 +1,729 @@
+#include "pch.h"
+#include "Global/LinearOctree.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Mesh/Public/CubeComponent.h"
+
+#include "Level/Public/Level.h"
+#include "Physics/Public/RayBoxIntersection.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <queue>
+#include <random>
+
+namespace
+{
+	constexpr uint32 CELL_RESOLUTION = 1u << MAX_DEPTH;
+
+	uint32 GetLocationDepth(uint32 InLocationCode)
+	{
+		uint32 Depth = 0;
+		while (InLocationCode > 1)
+		{
+			InLocationCode >>= 3;
+			++Depth;
+		}
+		return Depth;
+	}
+
+	/**
+	 * @brief 위치 코드를 최대 깊이로 정규화한 Morton 값에 깊이를 덧붙인 정렬 키
+	 * 정렬 결과는 전위 순회 순서와 같다 (같은 위치에서는 얕은 노드가 먼저)
+	 */
+	uint64 MakeSortKey(uint32 InLocationCode, uint32 InDepth)
+	{
+		const uint32 Morton = InLocationCode & ~(1u << (3 * InDepth));
+		const uint64 Normalized = static_cast<uint64>(Morton) << (3 * (MAX_DEPTH - InDepth));
+		return (Normalized << 4) | InDepth;
+	}
+
+	uint64 MakeSortKey(uint32 InLocationCode)
+	{
+		return MakeSortKey(InLocationCode, GetLocationDepth(InLocationCode));
+	}
+
+	uint32 InterleaveBits(uint32 InX, uint32 InY, uint32 InZ, uint32 InDepth)
+	{
+		uint32 Morton = 0;
+		for (uint32 Bit = 0; Bit < InDepth; ++Bit)
+		{
+			Morton |= ((InX >> Bit) & 1u) << (3 * Bit);
+			Morton |= ((InY >> Bit) & 1u) << (3 * Bit + 1);
+			Morton |= ((InZ >> Bit) & 1u) << (3 * Bit + 2);
+		}
+		return Morton;
+	}
+
+	void DeinterleaveBits(uint32 InMorton, uint32 InDepth, uint32& OutX, uint32& OutY, uint32& OutZ)
+	{
+		OutX = OutY = OutZ = 0;
+		for (uint32 Bit = 0; Bit < InDepth; ++Bit)
+		{
+			OutX |= ((InMorton >> (3 * Bit)) & 1u) << Bit;
+			OutY |= ((InMorton >> (3 * Bit + 1)) & 1u) << Bit;
+			OutZ |= ((InMorton >> (3 * Bit + 2)) & 1u) << Bit;
+		}
+	}
+
+	uint32 GetBitWidth(uint32 InValue)
+	{
+		uint32 Width = 0;
+		while (InValue)
+		{
+			InValue >>= 1;
+			++Width;
+		}
+		return Width;
+	}
+
+	template <typename T>
+	void ReplaceElements(TArray<T>& InOutArray, size_t Begin, size_t End, const TArray<T>& InElements)
+	{
+		const size_t OldCount = End - Begin;
+		const size_t CommonCount = min(OldCount, InElements.size());
+		std::copy(InElements.begin(), InElements.begin() + CommonCount, InOutArray.begin() + Begin);
+
+		if (InElements.size() > OldCount)
+		{
+			InOutArray.insert(InOutArray.begin() + End, InElements.begin() + CommonCount, InElements.end());
+		}
+		else if (InElements.size() < OldCount)
+		{
+			InOutArray.erase(InOutArray.begin() + Begin + CommonCount, InOutArray.begin() + End);
+		}
+	}
+}
+
+FLinearOctree::FLinearOctree()
+	: BoundingBox()
+{
+	Clear();
+}
+
+FLinearOctree::FLinearOctree(const FVector& InPosition, float InSize)
+{
+	const float HalfSize = InSize * 0.5f;
+	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
+	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
+	Clear();
+}
+
+FLinearOctree::FLinearOctree(const FAABB& InBoundingBox)
+	: BoundingBox(InBoundingBox)
+{
+	Clear();
+}
+
+void FLinearOctree::Clear()
+{
+	// 루트 노드는 항상 존재한다
+	Nodes.clear();
+	Nodes.push_back(MakeNode(1u, 0u, 0u, 1u));
+	Primitives.clear();
+}
+
+bool FLinearOctree::ComputeLocation(UPrimitiveComponent* InPrimitive, uint32& OutLocationCode, uint32& OutDepth) const
+{
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	const FAABB PrimitiveBox(Min, Max);
+
+	// 0. 영역 내에 객체가 없으면 삽입하지 않는다
+	if (BoundingBox.IsIntersected(PrimitiveBox) == false) { return false; }
+
+	// 1. 루트에 완전히 포함되지 않으면 루트에 보관
+	const FVector Size = BoundingBox.Max - BoundingBox.Min;
+	if (BoundingBox.IsContains(PrimitiveBox) == false || Size.X <= 0.f || Size.Y <= 0.f || Size.Z <= 0.f)
+	{
+		OutLocationCode = 1u;
+		OutDepth = 0;
+		return true;
+	}
+
+	// 2. 최대 깊이의 격자로 양자화한 뒤, Min/Max 셀이 처음으로 갈라지는 비트에서 포함 셀의 깊이가 결정된다
+	// Max가 셀 경계에 정확히 걸치면 아래쪽 셀로 취급 (FAABB::IsContains의 경계 포함 규칙과 일치)
+	const float Resolution = static_cast<float>(CELL_RESOLUTION);
+	const float MinCoord[3] = { Min.X - BoundingBox.Min.X, Min.Y - BoundingBox.Min.Y, Min.Z - BoundingBox.Min.Z };
+	const float MaxCoord[3] = { Max.X - BoundingBox.Min.X, Max.Y - BoundingBox.Min.Y, Max.Z - BoundingBox.Min.Z };
+	const float AxisSize[3] = { Size.X, Size.Y, Size.Z };
+
+	uint32 CellMin[3];
+	uint32 Difference = 0;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const int32 Low = clamp(static_cast<int32>(floorf(MinCoord[Axis] / AxisSize[Axis] * Resolution)), 0, static_cast<int32>(CELL_RESOLUTION) - 1);
+		const int32 High = clamp(static_cast<int32>(ceilf(MaxCoord[Axis] / AxisSize[Axis] * Resolution)) - 1, Low, static_cast<int32>(CELL_RESOLUTION) - 1);
+		CellMin[Axis] = static_cast<uint32>(Low);
+		Difference |= static_cast<uint32>(Low ^ High);
+	}
+
+	const uint32 Shift = GetBitWidth(Difference);
+	OutDepth = MAX_DEPTH - Shift;
+	OutLocationCode = (1u << (3 * OutDepth)) | InterleaveBits(CellMin[0] >> Shift, CellMin[1] >> Shift, CellMin[2] >> Shift, OutDepth);
+	return true;
+}
+
+FLinearOctreeNode FLinearOctree::MakeNode(uint32 InLocationCode, uint32 InFirstPrimitive, uint32 InPrimitiveCount, uint32 InSubtreeEnd) const
+{
+	const uint32 Depth = GetLocationDepth(InLocationCode);
+
+	uint32 X, Y, Z;
+	DeinterleaveBits(InLocationCode, Depth, X, Y, Z);
+
+	const FVector CellSize = (BoundingBox.Max - BoundingBox.Min) * (1.0f / static_cast<float>(1u << Depth));
+	const FVector Min(
+		BoundingBox.Min.X + CellSize.X * static_cast<float>(X),
+		BoundingBox.Min.Y + CellSize.Y * static_cast<float>(Y),
+		BoundingBox.Min.Z + CellSize.Z * static_cast<float>(Z));
+
+	// 루트는 부동소수점 오차 없이 원래 경계를 그대로 사용
+	const FVector Max = Depth == 0 ? BoundingBox.Max : Min + CellSize;
+	return { Depth == 0 ? BoundingBox.Min : Min, Max, InLocationCode, InFirstPrimitive, InPrimitiveCount, InPrimitiveCount, InSubtreeEnd };
+}
+
+void FLinearOctree::Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected)
+{
+	TArray<FBuildEntry> Entries;
+	Entries.reserve(InPrimitives.size());
+
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Primitive) { continue; }
+
+		uint32 LocationCode, Depth;
+		if (ComputeLocation(Primitive, LocationCode, Depth))
+		{
+			Entries.push_back({ MakeSortKey(LocationCode, Depth), LocationCode, Depth, Primitive });
+		}
+		else if (OutRejected)
+		{
+			OutRejected->push_back(Primitive);
+		}
+	}
+
+	// Morton 순서로 정렬하면 각 노드에 속하는 프리미티브가 전위 순회 순서로 연속 구간을 이룬다
+	std::sort(Entries.begin(), Entries.end(), [](const FBuildEntry& A, const FBuildEntry& B) { return A.SortKey < B.SortKey; });
+
+	Nodes.clear();
+	Primitives.clear();
+	Primitives.reserve(Entries.size());
+	BuildRange(Entries, 0, static_cast<int32>(Entries.size()), 1u, 0, Nodes, Primitives);
+}
+
+void FLinearOctree::BuildRange(const TArray<FBuildEntry>& InEntries, int32 Begin, int32 End, uint32 InLocationCode, uint32 InDepth,
+	TArray<FLinearOctreeNode>& OutNodes, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const uint32 NodeIndex = static_cast<uint32>(OutNodes.size());
+	OutNodes.push_back(MakeNode(InLocationCode, static_cast<uint32>(OutPrimitives.size()), 0u, NodeIndex + 1));
+
+	// 여유 공간이 있거나 최대 깊이에 도달했다면 리프로 전부 보관
+	if (End - Begin <= MAX_PRIMITIVES || InDepth == MAX_DEPTH)
+	{
+		for (int32 Index = Begin; Index < End; ++Index) { OutPrimitives.push_back(InEntries[Index].Primitive); }
+		OutNodes[NodeIndex].PrimitiveCount = static_cast<uint32>(End - Begin);
+		OutNodes[NodeIndex].PrimitiveCapacity = static_cast<uint32>(End - Begin);
+		return;
+	}
+
+	// 자식 셀에 완전히 포함되지 않는 프리미티브는 정렬 순서상 맨 앞에 있으며, 현재 노드에 보관
+	int32 Index = Begin;
+	while (Index < End && InEntries[Index].Depth == InDepth)
+	{
+		OutPrimitives.push_back(InEntries[Index].Primitive);
+		++Index;
+	}
+	OutNodes[NodeIndex].PrimitiveCount = static_cast<uint32>(Index - Begin);
+	OutNodes[NodeIndex].PrimitiveCapacity = static_cast<uint32>(Index - Begin);
+
+	// 나머지는 자식 번호(3비트)별로 연속 구간을 이루므로 구간마다 재귀적으로 구성
+	while (Index < End)
+	{
+		const uint32 ChildCode = InEntries[Index].LocationCode >> (3 * (InEntries[Index].Depth - InDepth - 1));
+		int32 ChildEnd = Index + 1;
+		while (ChildEnd < End && (InEntries[ChildEnd].LocationCode >> (3 * (InEntries[ChildEnd].Depth - InDepth - 1))) == ChildCode)
+		{
+			++ChildEnd;
+		}
+
+		BuildRange(InEntries, Index, ChildEnd, ChildCode, InDepth + 1, OutNodes, OutPrimitives);
+		Index = ChildEnd;
+	}
+
+	OutNodes[NodeIndex].SubtreeEnd = static_cast<uint32>(OutNodes.size());
+}
+
+bool FLinearOctree::Insert(UPrimitiveComponent* InPrimitive)
+{
+	// nullptr 체크
+	if (!InPrimitive) { return false; }
+
+	uint32 LocationCode, Depth;
+	if (ComputeLocation(InPrimitive, LocationCode, Depth) == false) { return false; }
+
+	uint32 NodeIndex = 0;
+	while (true)
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		const uint32 NodeDepth = GetLocationDepth(Node.LocationCode);
+
+		// 더 깊은 셀에 들어갈 수 없다면 현재 노드에 보관
+		if (Depth == NodeDepth)
+		{
+			InsertNodePrimitive(NodeIndex, InPrimitive);
+			return true;
+		}
+
+		if (IsLeafNode(NodeIndex))
+		{
+			// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면 해당 객체를 추가한다
+			if (Node.PrimitiveCount < MAX_PRIMITIVES || NodeDepth == MAX_DEPTH)
+			{
+				InsertNodePrimitive(NodeIndex, InPrimitive);
+			}
+			// 여유 공간이 없다면 서브트리를 다시 구성하여 분할한다
+			else
+			{
+				RebuildSubtree(NodeIndex, InPrimitive);
+			}
+			return true;
+		}
+
+		// 자식 노드가 있다면 넘겨주고, 없다면 새 리프를 만든다
+		const uint32 ChildCode = LocationCode >> (3 * (Depth - NodeDepth - 1));
+		const int32 ChildIndex = FindNode(ChildCode);
+		if (ChildIndex >= 0)
+		{
+			NodeIndex = static_cast<uint32>(ChildIndex);
+			continue;
+		}
+
+		const uint32 InsertNodeIndex = LowerBoundNode(ChildCode);
+		const uint32 InsertPrimitiveIndex = InsertNodeIndex < Nodes.size() ? Nodes[InsertNodeIndex].FirstPrimitive : static_cast<uint32>(Primitives.size());
+		ReplaceRange(InsertNodeIndex, InsertNodeIndex, InsertPrimitiveIndex, InsertPrimitiveIndex,
+			{ MakeNode(ChildCode, 0u, 1u, 1u) }, { InPrimitive }, ChildCode);
+		return true;
+	}
+}
+
+bool FLinearOctree::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (InPrimitive == nullptr) { return false; }
+
+	// 1. 현재 AABB가 가리키는 경로의 노드들을 깊은 쪽부터 확인
+	// (상위 노드일수록 걸쳐 있는 프리미티브가 많이 쌓이므로, 대부분이 속한 리프를 먼저 본다)
+	int64 FoundIndex = -1;
+	uint32 LocationCode, Depth;
+	if (ComputeLocation(InPrimitive, LocationCode, Depth))
+	{
+		for (int32 PathDepth = static_cast<int32>(Depth); PathDepth >= 0 && FoundIndex < 0; --PathDepth)
+		{
+			const int32 NodeIndex = FindNode(LocationCode >> (3 * (Depth - PathDepth)));
+			if (NodeIndex < 0) { continue; }
+
+			const FLinearOctreeNode& Node = Nodes[NodeIndex];
+			for (uint32 Index = Node.FirstPrimitive; Index < Node.FirstPrimitive + Node.PrimitiveCount; ++Index)
+			{
+				if (Primitives[Index] == InPrimitive)
+				{
+					FoundIndex = Index;
+					break;
+				}
+			}
+		}
+	}
+
+	// 2. 삽입 이후 이동하여 경로가 달라졌다면 packed 버퍼 전체에서 찾는다
+	if (FoundIndex < 0)
+	{
+		auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive);
+		if (It == Primitives.end()) { return false; }
+		FoundIndex = It - Primitives.begin();
+	}
+
+	// 3. 소유 노드는 FirstPrimitive에 대한 이진 탐색으로 찾는다
+	auto OwnerIt = std::upper_bound(Nodes.begin(), Nodes.end(), static_cast<uint32>(FoundIndex),
+		[](uint32 Value, const FLinearOctreeNode& Node) { return Value < Node.FirstPrimitive; });
+	const uint32 OwnerIndex = static_cast<uint32>(OwnerIt - Nodes.begin()) - 1;
+	FLinearOctreeNode& Owner = Nodes[OwnerIndex];
+	const uint32 OwnerCode = Owner.LocationCode;
+
+	// 노드 구간의 마지막 프리미티브와 자리를 바꾸고 빈 칸으로 남긴다 (버퍼를 밀지 않음)
+	const uint32 LastIndex = Owner.FirstPrimitive + Owner.PrimitiveCount - 1;
+	Primitives[FoundIndex] = Primitives[LastIndex];
+	Primitives[LastIndex] = nullptr;
+	--Owner.PrimitiveCount;
+
+	// 4. 빈 리프는 FOctree처럼 남겨두고 (다시 삽입될 때 구조 변경이 없도록), 조상 노드를 합칠 수 있는지 검사
+	TryMerge(OwnerCode);
+
+	return true;
+}
+
+void FLinearOctree::InsertNodePrimitive(uint32 NodeIndex, UPrimitiveComponent* InPrimitive)
+{
+	FLinearOctreeNode& Node = Nodes[NodeIndex];
+
+	// 빈 칸이 없으면 현재 크기의 절반만큼 늘리고, 뒤따르는 노드(자손 포함)의 구간을 민다
+	if (Node.PrimitiveCount == Node.PrimitiveCapacity)
+	{
+		const uint32 Growth = max(Node.PrimitiveCapacity / 2, 4u);
+		Primitives.insert(Primitives.begin() + Node.FirstPrimitive + Node.PrimitiveCapacity, Growth, nullptr);
+		Node.PrimitiveCapacity += Growth;
+		for (uint32 Index = NodeIndex + 1; Index < Nodes.size(); ++Index) { Nodes[Index].FirstPrimitive += Growth; }
+	}
+
+	Primitives[Node.FirstPrimitive + Node.PrimitiveCount] = InPrimitive;
+	++Node.PrimitiveCount;
+}
+
+void FLinearOctree::GatherSubtreePrimitives(uint32 NodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	for (uint32 Index = NodeIndex; Index < Nodes[NodeIndex].SubtreeEnd; ++Index)
+	{
+		const FLinearOctreeNode& Node = Nodes[Index];
+		OutPrimitives.insert(OutPrimitives.end(), Primitives.begin() + Node.FirstPrimitive, Primitives.begin() + Node.FirstPrimitive + Node.PrimitiveCount);
+	}
+}
+
+void FLinearOctree::RebuildSubtree(uint32 NodeIndex, UPrimitiveComponent* InExtra)
+{
+	const FLinearOctreeNode Node = Nodes[NodeIndex];
+	const uint32 NodeDepth = GetLocationDepth(Node.LocationCode);
+	const uint32 PrimitiveEnd = GetSubtreePrimitiveEnd(NodeIndex);
+
+	TArray<UPrimitiveComponent*> SubtreePrimitives;
+	GatherSubtreePrimitives(NodeIndex, SubtreePrimitives);
+
+	TArray<FBuildEntry> Entries;
+	Entries.reserve(SubtreePrimitives.size() + 1);
+
+	auto AddEntry = [&](UPrimitiveComponent* Primitive)
+	{
+		uint32 LocationCode, Depth;
+		// 이동하여 이 노드의 셀을 벗어난 프리미티브는 서브트리의 루트에 보관한다
+		if (ComputeLocation(Primitive, LocationCode, Depth) == false || Depth < NodeDepth ||
+			(LocationCode >> (3 * (Depth - NodeDepth))) != Node.LocationCode)
+		{
+			LocationCode = Node.LocationCode;
+			Depth = NodeDepth;
+		}
+		Entries.push_back({ MakeSortKey(LocationCode, Depth), LocationCode, Depth, Primitive });
+	};
+
+	for (UPrimitiveComponent* Primitive : SubtreePrimitives) { AddEntry(Primitive); }
+	if (InExtra) { AddEntry(InExtra); }
+
+	std::sort(Entries.begin(), Entries.end(), [](const FBuildEntry& A, const FBuildEntry& B) { return A.SortKey < B.SortKey; });
+
+	TArray<FLinearOctreeNode> NewNodes;
+	TArray<UPrimitiveComponent*> NewPrimitives;
+	NewPrimitives.reserve(Entries.size());
+	BuildRange(Entries, 0, static_cast<int32>(Entries.size()), Node.LocationCode, NodeDepth, NewNodes, NewPrimitives);
+
+	ReplaceRange(NodeIndex, Node.SubtreeEnd, Node.FirstPrimitive, PrimitiveEnd, NewNodes, NewPrimitives, Node.LocationCode);
+}
+
+void FLinearOctree::ReplaceRange(uint32 NodeBegin, uint32 NodeEnd, uint32 PrimitiveBegin, uint32 PrimitiveEnd,
+	const TArray<FLinearOctreeNode>& InNewNodes, const TArray<UPrimitiveComponent*>& InNewPrimitives, uint32 InLocationCode)
+{
+	TArray<FLinearOctreeNode> NewNodes = InNewNodes;
+	TArray<UPrimitiveComponent*> NewPrimitives = InNewPrimitives;
+
+	// 프리미티브 구간이 줄어든다면 남는 칸을 직전 구간의 빈 칸으로 넘겨, packed 버퍼 전체를 당기지 않는다
+	const uint32 OldPrimitiveCount = PrimitiveEnd - PrimitiveBegin;
+	if (NewPrimitives.size() < OldPrimitiveCount)
+	{
+		const uint32 Slack = OldPrimitiveCount - static_cast<uint32>(NewPrimitives.size());
+		if (!NewNodes.empty()) { NewNodes.back().PrimitiveCapacity += Slack; }
+		else if (NodeBegin > 0) { Nodes[NodeBegin - 1].PrimitiveCapacity += Slack; }
+		NewPrimitives.resize(OldPrimitiveCount, nullptr);
+	}
+
+	const int64 NodeDelta = static_cast<int64>(NewNodes.size()) - static_cast<int64>(NodeEnd - NodeBegin);
+	const int64 PrimitiveDelta = static_cast<int64>(NewPrimitives.size()) - static_cast<int64>(OldPrimitiveCount);
+
+	ReplaceElements(Primitives, PrimitiveBegin, PrimitiveEnd, NewPrimitives);
+	ReplaceElements(Nodes, NodeBegin, NodeEnd, NewNodes);
+
+	// 새 노드의 상대 인덱스를 절대 인덱스로 변환
+	const uint32 NewNodeEnd = NodeBegin + static_cast<uint32>(NewNodes.size());
+	for (uint32 Index = NodeBegin; Index < NewNodeEnd; ++Index)
+	{
+		Nodes[Index].FirstPrimitive += PrimitiveBegin;
+		Nodes[Index].SubtreeEnd += NodeBegin;
+	}
+
+	// 뒤따르는 노드들은 교체된 개수만큼 밀리거나 당겨진다
+	if (NodeDelta != 0 || PrimitiveDelta != 0)
+	{
+		for (uint32 Index = NewNodeEnd; Index < Nodes.size(); ++Index)
+		{
+			Nodes[Index].FirstPrimitive = static_cast<uint32>(Nodes[Index].FirstPrimitive + PrimitiveDelta);
+			Nodes[Index].SubtreeEnd = static_cast<uint32>(Nodes[Index].SubtreeEnd + NodeDelta);
+		}
+	}
+
+	// 조상 노드들은 앞쪽에 있으므로 서브트리 끝만 보정
+	if (NodeDelta != 0)
+	{
+		for (uint32 ParentCode = InLocationCode >> 3; ParentCode >= 1; ParentCode >>= 3)
+		{
+			const int32 ParentIndex = FindNode(ParentCode);
+			if (ParentIndex >= 0) { Nodes[ParentIndex].SubtreeEnd = static_cast<uint32>(Nodes[ParentIndex].SubtreeEnd + NodeDelta); }
+		}
+	}
+}
+
+void FLinearOctree::TryMerge(uint32 InLocationCode)
+{
+	for (uint32 LocationCode = InLocationCode; LocationCode >= 1; LocationCode >>= 3)
+	{
+		const int32 NodeIndex = FindNode(LocationCode);
+		if (NodeIndex < 0 || IsLeafNode(NodeIndex)) { continue; }
+
+		// 모든 자식 노드가 리프 노드인지 확인 (하나라도 아니면 조상도 합칠 수 없다)
+		const FLinearOctreeNode Node = Nodes[NodeIndex];
+		for (uint32 Child = NodeIndex + 1; Child < Node.SubtreeEnd; Child = Nodes[Child].SubtreeEnd)
+		{
+			if (!IsLeafNode(Child)) { return; }
+		}
+
+		// 프리미티브 총 개수가 최대치보다 크면 합치지 않음
+		TArray<UPrimitiveComponent*> MergedPrimitives;
+		GatherSubtreePrimitives(NodeIndex, MergedPrimitives);
+		const uint32 TotalPrimitives = static_cast<uint32>(MergedPrimitives.size());
+		if (TotalPrimitives > MAX_PRIMITIVES) { return; }
+
+		// 서브트리를 빈 칸 없는 하나의 리프로 교체
+		ReplaceRange(NodeIndex, Node.SubtreeEnd, Node.FirstPrimitive, GetSubtreePrimitiveEnd(NodeIndex),
+			{ MakeNode(LocationCode, 0u, TotalPrimitives, 1u) }, MergedPrimitives, LocationCode);
+	}
+}
+
+int32 FLinearOctree::FindNode(uint32 InLocationCode) const
+{
+	const uint32 Index = LowerBoundNode(InLocationCode);
+	return (Index < Nodes.size() && Nodes[Index].LocationCode == InLocationCode) ? static_cast<int32>(Index) : -1;
+}
+
+uint32 FLinearOctree::LowerBoundNode(uint32 InLocationCode) const
+{
+	const uint64 Key = MakeSortKey(InLocationCode);
+	auto It = std::lower_bound(Nodes.begin(), Nodes.end(), Key,
+		[](const FLinearOctreeNode& Node, uint64 Value) { return MakeSortKey(Node.LocationCode) < Value; });
+	return static_cast<uint32>(It - Nodes.begin());
+}
+
+uint32 FLinearOctree::GetSubtreePrimitiveEnd(uint32 NodeIndex) const
+{
+	const uint32 SubtreeEnd = Nodes[NodeIndex].SubtreeEnd;
+	return SubtreeEnd < Nodes.size() ? Nodes[SubtreeEnd].FirstPrimitive : static_cast<uint32>(Primitives.size());
+}
+
+void FLinearOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	// 모든 프리미티브가 하나의 버퍼에 있으므로 빈 칸만 건너뛰며 복사
+	GatherSubtreePrimitives(0, OutPrimitives);
+}
+
+TArray<UPrimitiveComponent*> FLinearOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const
+{
+	// FOctree::FindNearestPrimitives와 동일하게 Dynamic Primitive를 먼저 후보로 넣는다
+	TArray<UPrimitiveComponent*> Candidates;
+	if (GWorld && GWorld->GetLevel()) { Candidates = GWorld->GetLevel()->GetDynamicPrimitives(); }
+	Candidates.reserve(MaxPrimitiveCount);
+
+	std::priority_queue<std::pair<float, uint32>, TArray<std::pair<float, uint32>>, std::greater<std::pair<float, uint32>>> NodeQueue;
+	NodeQueue.push({ GetNodeBoundingBox(0).GetCenterDistanceSquared(FindPos), 0u });
+
+	while (!NodeQueue.empty() && Candidates.size() < MaxPrimitiveCount)
+	{
+		const uint32 NodeIndex = NodeQueue.top().second;
+		NodeQueue.pop();
+
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		if (IsLeafNode(NodeIndex))
+		{
+			Candidates.insert(Candidates.end(), Primitives.begin() + Node.FirstPrimitive, Primitives.begin() + Node.FirstPrimitive + Node.PrimitiveCount);
+		}
+		else
+		{
+			for (uint32 Child = NodeIndex + 1; Child < Node.SubtreeEnd; Child = Nodes[Child].SubtreeEnd)
+			{
+				NodeQueue.push({ GetNodeBoundingBox(Child).GetCenterDistanceSquared(FindPos), Child });
+			}
+		}
+	}
+
+	return Candidates;
+}
+
+bool FLinearOctree::FindRayCandidates(const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate) const
+{
+	bool bIsFound = false;
+
+	// 전위 순회 배열을 앞에서부터 훑고, 레이가 지나지 않는 노드는 서브트리 전체를 건너뛴다
+	uint32 NodeIndex = 0;
+	while (NodeIndex < Nodes.size())
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		if (CheckIntersectionRayBox(WorldRay, GetNodeBoundingBox(NodeIndex)) == false)
+		{
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+
+		OutCandidate.insert(OutCandidate.end(), Primitives.begin() + Node.FirstPrimitive, Primitives.begin() + Node.FirstPrimitive + Node.PrimitiveCount);
+		bIsFound = true;
+		++NodeIndex;
+	}
+
+	return bIsFound;
+}
+
+void FLinearOctree::FindOverlapCandidates(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutCandidate) const
+{
+	uint32 NodeIndex = 0;
+	while (NodeIndex < Nodes.size())
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		if (GetNodeBoundingBox(NodeIndex).IsIntersected(InBox) == false)
+		{
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+
+		OutCandidate.insert(OutCandidate.end(), Primitives.begin() + Node.FirstPrimitive, Primitives.begin() + Node.FirstPrimitive + Node.PrimitiveCount);
+		++NodeIndex;
+	}
+}
+
+void RunOctreeBenchmark(const TArray<UPrimitiveComponent*>& InPrimitives, const FAABB& InBoundingBox)
+{
+	constexpr int32 RAY_QUERY_COUNT = 1024;
+	constexpr int32 OVERLAP_QUERY_COUNT = 1024;
+	constexpr int32 NEAREST_QUERY_COUNT = 16;
+
+	const FVector Center = InBoundingBox.GetCenter();
+	const FVector Extent = (InBoundingBox.Max - InBoundingBox.Min) * 0.5f;
+	const uint32 NearestCount = max(static_cast<uint32>(InPrimitives.size() / 10), 1u);
+
+	// 두 트리에 같은 질의를 던지도록 고정 시드로 미리 생성
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	TArray<FRay> Rays(RAY_QUERY_COUNT);
+	for (FRay& Ray : Rays)
+	{
+		Ray.Origin = FVector4(Center.X + Extent.X * Unit(Random), Center.Y + Extent.Y * Unit(Random), Center.Z + Extent.Z * Unit(Random), 1.0f);
+		Ray.Direction = FVector4(Unit(Random), Unit(Random), Unit(Random), 0.0f);
+	}
+	TArray<FAABB> Boxes(OVERLAP_QUERY_COUNT);
+	for (FAABB& Box : Boxes)
+	{
+		const FVector BoxCenter(Center.X + Extent.X * Unit(Random), Center.Y + Extent.Y * Unit(Random), Center.Z + Extent.Z * Unit(Random));
+		Box = FAABB(BoxCenter - Extent * 0.05f, BoxCenter + Extent * 0.05f);
+	}
+	TArray<FVector> NearestPositions(NEAREST_QUERY_COUNT);
+	for (FVector& Position : NearestPositions)
+	{
+		Position = FVector(Center.X + Extent.X * Unit(Random), Center.Y + Extent.Y * Unit(Random), Center.Z + Extent.Z * Unit(Random));
+	}
+
+	// PointerOctree에 넣으면 레벨 옥트리의 소유 노드 기록이 덮어써지므로, PointerOctree가 소멸된 뒤 되돌린다 (선언 순서 유지)
+	const FOctreeOwnerSnapshot OwnerSnapshot(InPrimitives);
+	FOctree PointerOctree(InBoundingBox, 0);
+	FLinearOctree LinearOctree(InBoundingBox);
+	TArray<UPrimitiveComponent*> Candidates;
+	size_t PointerCandidateCount = 0;
+	size_t LinearCandidateCount = 0;
+
+	// 1. 구성: FOctree는 하나씩 Insert, FLinearOctree는 Morton 정렬 기반 Bulk Build
+	const double PointerBuildMs = FBenchmark::MeasureOnce([&]() { for (UPrimitiveComponent* Primitive : InPrimitives) { PointerOctree.Insert(Primitive); } });
+	const double LinearBuildMs = FBenchmark::MeasureOnce([&]() { LinearOctree.Build(InPrimitives); });
+
+	// 2. 질의
+	const double PointerRayMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays) { Candidates.clear(); PointerOctree.FindRayCandidates(Ray, Candidates); PointerCandidateCount += Candidates.size(); }
+	});
+	const double LinearRayMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays) { Candidates.clear(); LinearOctree.FindRayCandidates(Ray, Candidates); LinearCandidateCount += Candidates.size(); }
+	});
+
+	const double PointerOverlapMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FAABB& Box : Boxes) { Candidates.clear(); PointerOctree.FindOverlapCandidates(Box, Candidates); }
+	});
+	const double LinearOverlapMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FAABB& Box : Boxes) { Candidates.clear(); LinearOctree.FindOverlapCandidates(Box, Candidates); }
+	});
+
+	const double PointerNearestMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FVector& Position : NearestPositions) { PointerOctree.FindNearestPrimitives(Position, NearestCount); }
+	});
+	const double LinearNearestMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FVector& Position : NearestPositions) { LinearOctree.FindNearestPrimitives(Position, NearestCount); }
+	});
+
+	// 3. 편집: 1%를 제거했다가 다시 삽입 (에디터에서 객체를 옮길 때의 Remove + Insert 패턴)
+	TArray<UPrimitiveComponent*> EditPrimitives;
+	for (size_t Index = 0; Index < InPrimitives.size(); Index += 100) { EditPrimitives.push_back(InPrimitives[Index]); }
+
+	const double PointerEditMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (UPrimitiveComponent* Primitive : EditPrimitives) { PointerOctree.Remove(Primitive); }
+		for (UPrimitiveComponent* Primitive : EditPrimitives) { PointerOctree.Insert(Primitive); }
+	});
+	const double LinearEditMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (UPrimitiveComponent* Primitive : EditPrimitives) { LinearOctree.Remove(Primitive); }
+		for (UPrimitiveComponent* Primitive : EditPrimitives) { LinearOctree.Insert(Primitive); }
+	});
+	const double EditCount = static_cast<double>(max(EditPrimitives.size() * 2, static_cast<size_t>(1)));
+
+	UE_LOG_INFO("Octree Benchmark: %zu primitives, Linear nodes %zu", InPrimitives.size(), LinearOctree.GetNodes().size());
+	UE_LOG_INFO("  Build        : Pointer %.2f ms | Linear %.2f ms", PointerBuildMs, LinearBuildMs);
+	UE_LOG_INFO("  Ray x%d    : Pointer %.2f ms | Linear %.2f ms (candidates %zu / %zu)", RAY_QUERY_COUNT, PointerRayMs, LinearRayMs, PointerCandidateCount, LinearCandidateCount);
+	UE_LOG_INFO("  Box x%d    : Pointer %.2f ms | Linear %.2f ms", OVERLAP_QUERY_COUNT, PointerOverlapMs, LinearOverlapMs);
+	UE_LOG_INFO("  Nearest x%d  : Pointer %.2f ms | Linear %.2f ms", NEAREST_QUERY_COUNT, PointerNearestMs, LinearNearestMs);
+	UE_LOG_INFO("  Edit x%zu    : Pointer %.2f us/op | Linear %.2f us/op", EditPrimitives.size() * 2,
+		PointerEditMs * 1000.0 / EditCount, LinearEditMs * 1000.0 / EditCount);
+}
+
+void RunSyntheticOctreeBenchmark(int32 InPrimitiveCount)
+{
+	if (InPrimitiveCount <= 0) { return; }
+
+	// 개수가 늘어도 밀도가 비슷하도록 월드 크기를 개수의 세제곱근에 비례시킨다
+	const float WorldExtent = 10.0f * std::cbrt(static_cast<float>(InPrimitiveCount));
+
+	std::mt19937 Random(1234);
+	std::uniform_real_distribution<float> Position(-WorldExtent, WorldExtent);
+	std::uniform_real_distribution<float> Scale(0.5f, 4.0f);
+
+	TArray<UPrimitiveComponent*> Primitives;
+	Primitives.reserve(InPrimitiveCount);
+	FVector BoundsMin(FLT_MAX, FLT_MAX, FLT_MAX), BoundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	const double GenerateMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (int32 Index = 0; Index < InPrimitiveCount; ++Index)
+		{
+			UCubeComponent* Cube = new UCubeComponent();
+			Cube->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+			Cube->SetRelativeScale3D(FVector(Scale(Random), Scale(Random), Scale(Random)));
+
+			FVector Min, Max;
+			Cube->GetWorldAABB(Min, Max);
+			GrowBounds(BoundsMin, BoundsMax, Min, Max);
+			Primitives.push_back(Cube);
+		}
+	});
+
+	UE_LOG_INFO("Synthetic Octree: %d cubes in [-%.0f, %.0f]^3 (seed 1234, generated in %.2f ms)", InPrimitiveCount, WorldExtent, WorldExtent, GenerateMs);
+	RunOctreeBenchmark(Primitives, FAABB(BoundsMin, BoundsMax));
+
+	for (UPrimitiveComponent*& Primitive : Primitives) { SafeDelete(Primitive); }
+}
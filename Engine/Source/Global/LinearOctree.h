@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Global/Octree.h"
+
+class UPrimitiveComponent;
+struct FRay;
+
+/**
+ * @brief FLinearOctree의 노드
+ * 노드 배열은 전위 순회(pre-order) 순서로 저장되며, 이는 Morton 코드를 최대 깊이로 정규화한 순서와 같다
+ * 각 노드의 프리미티브는 공유 버퍼의 [FirstPrimitive, FirstPrimitive + PrimitiveCount) 구간에 연속으로 저장되며,
+ * [PrimitiveCount, PrimitiveCapacity) 구간은 삽입/삭제 시 버퍼 전체를 밀지 않도록 남겨둔 빈 칸(nullptr)이다
+ */
+struct FLinearOctreeNode
+{
+	// 셀 경계 (위치 코드로부터 계산 가능하지만, 탐색 시 매번 복원하지 않도록 보관)
+	FVector Min;
+	FVector Max;
+	// 최상위 비트(Sentinel) 1 뒤에 깊이마다 3비트(x, y, z)의 자식 번호가 이어지는 위치 코드 (루트 = 1)
+	uint32 LocationCode;
+	uint32 FirstPrimitive;
+	uint32 PrimitiveCount;
+	uint32 PrimitiveCapacity;
+	// 이 노드의 서브트리가 끝난 다음 노드의 인덱스 (리프라면 자신의 인덱스 + 1)
+	uint32 SubtreeEnd;
+};
+
+/**
+ * @brief 포인터 없이 하나의 연속 배열로 표현되는 선형 옥트리
+ * FOctree와 같은 분할 규칙(MAX_PRIMITIVES, MAX_DEPTH, 자식에 완전히 포함되지 않는 프리미티브는 부모에 보관)을 따르며,
+ * 노드는 Morton 위치 코드로 주소 지정되고 프리미티브는 하나의 버퍼에 전위 순회 순서로 packed 되어 있다
+ * 탐색은 SubtreeEnd로 서브트리를 건너뛰는 선형 순회로 수행되어 힙 포인터를 따라가지 않는다
+ */
+class FLinearOctree
+{
+public:
+	FLinearOctree();
+	FLinearOctree(const FVector& InPosition, float InSize);
+	explicit FLinearOctree(const FAABB& InBoundingBox);
+
+	/**
+	 * @brief 기존 내용을 지우고, 프리미티브들을 Morton 코드로 정렬한 뒤 한 번에 트리를 구성
+	 * @param InPrimitives 삽입할 프리미티브 목록
+	 * @param OutRejected 루트 영역과 겹치지 않아 삽입되지 못한 프리미티브를 받을 배열 (nullptr 가능)
+	 */
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives, TArray<UPrimitiveComponent*>* OutRejected = nullptr);
+
+	bool Insert(UPrimitiveComponent* InPrimitive);
+	bool Remove(UPrimitiveComponent* InPrimitive);
+	void Clear();
+
+	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const;
+
+	/**
+	 * @brief 레이와 교차하는 노드들의 프리미티브를 후보로 수집 (UObjectPicker::FindCandidateFromOctree와 동일한 기준)
+	 */
+	bool FindRayCandidates(const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate) const;
+
+	/**
+	 * @brief InBox와 겹치는 노드들의 프리미티브를 후보로 수집
+	 */
+	void FindOverlapCandidates(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutCandidate) const;
+
+	const FAABB& GetBoundingBox() const { return BoundingBox; }
+	FAABB GetNodeBoundingBox(uint32 NodeIndex) const { return FAABB(Nodes[NodeIndex].Min, Nodes[NodeIndex].Max); }
+	const TArray<FLinearOctreeNode>& GetNodes() const { return Nodes; }
+	const TArray<UPrimitiveComponent*>& GetPackedPrimitives() const { return Primitives; }
+	bool IsLeafNode(uint32 NodeIndex) const { return Nodes[NodeIndex].SubtreeEnd == NodeIndex + 1; }
+
+private:
+	// 정렬 및 부분 재구성에 사용하는 프리미티브 정보
+	struct FBuildEntry
+	{
+		uint64 SortKey;
+		uint32 LocationCode;
+		uint32 Depth;
+		UPrimitiveComponent* Primitive;
+	};
+
+	/**
+	 * @brief 프리미티브를 완전히 포함하는 가장 깊은 셀(최대 MAX_DEPTH)의 위치 코드와 깊이를 계산
+	 * @return 루트 영역과 겹치지 않으면 false
+	 */
+	bool ComputeLocation(UPrimitiveComponent* InPrimitive, uint32& OutLocationCode, uint32& OutDepth) const;
+	FLinearOctreeNode MakeNode(uint32 InLocationCode, uint32 InFirstPrimitive, uint32 InPrimitiveCount, uint32 InSubtreeEnd) const;
+
+	void BuildRange(const TArray<FBuildEntry>& InEntries, int32 Begin, int32 End, uint32 InLocationCode, uint32 InDepth,
+		TArray<FLinearOctreeNode>& OutNodes, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/**
+	 * @brief NodeIndex의 서브트리에 있는 프리미티브를 OutPrimitives에 추가 (빈 칸 제외)
+	 */
+	void GatherSubtreePrimitives(uint32 NodeIndex, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/**
+	 * @brief NodeIndex의 서브트리를 (InExtra를 더해) 빈 칸 없이 다시 구성
+	 */
+	void RebuildSubtree(uint32 NodeIndex, UPrimitiveComponent* InExtra);
+
+	/**
+	 * @brief 노드 구간 [NodeBegin, NodeEnd)과 프리미티브 구간 [PrimitiveBegin, PrimitiveEnd)을 새 내용으로 교체하고,
+	 * 뒤따르는 노드들의 인덱스와 InLocationCode의 조상 노드들의 SubtreeEnd를 보정
+	 * InNewNodes의 FirstPrimitive/SubtreeEnd는 0부터 시작하는 상대 인덱스여야 한다
+	 */
+	void ReplaceRange(uint32 NodeBegin, uint32 NodeEnd, uint32 PrimitiveBegin, uint32 PrimitiveEnd,
+		const TArray<FLinearOctreeNode>& InNewNodes, const TArray<UPrimitiveComponent*>& InNewPrimitives, uint32 InLocationCode);
+
+	void InsertNodePrimitive(uint32 NodeIndex, UPrimitiveComponent* InPrimitive);
+	void TryMerge(uint32 InLocationCode);
+
+	int32 FindNode(uint32 InLocationCode) const;
+	uint32 LowerBoundNode(uint32 InLocationCode) const;
+	uint32 GetSubtreePrimitiveEnd(uint32 NodeIndex) const;
+
+	FAABB BoundingBox;
+	TArray<FLinearOctreeNode> Nodes;
+	TArray<UPrimitiveComponent*> Primitives;
+};
+
+/**
+ * @brief 같은 프리미티브 집합으로 FOctree와 FLinearOctree의 구성/삽입/삭제/질의 시간을 비교하여 로그로 출력
+ */
+void RunOctreeBenchmark(const TArray<UPrimitiveComponent*>& InPrimitives, const FAABB& InBoundingBox);
+
+/**
+ * @brief 고정 시드로 무작위 위치/크기의 큐브 프리미티브 InPrimitiveCount개를 만들어 RunOctreeBenchmark를 실행 (레벨과 무관한 대규모 비교용)
+ */
+void RunSyntheticOctreeBenchmark(int32 InPrimitiveCount);
@@ -5,10 +5,6 @@
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
-
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
  * @param InSize 할당 size
@@ -16,16 +12,14 @@ uint32 TotalAllocationCount = 0;
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
-
-	// Debug Print
-	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+	const EAllocationTag Tag = FAllocationTracker::GetCurrentTag();
+	FAllocationTracker::TrackAllocation(Tag, InSize);
 
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
 	MemoryHeader->size = InSize;
 	MemoryHeader->bIsAligned = false;
+	MemoryHeader->Tag = Tag;
+	MemoryHeader->AlignedOffset = sizeof(AllocHeader);
 
 	return MemoryHeader + 1;
 }
@@ -44,31 +38,11 @@ void operator delete(void* InMemory) noexcept
 	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(InMemory) - 1;
 	size_t MemoryAllocSize = MemoryHeader->size;
 
-	// Debug Print
-	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
-
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
-	}
-
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
-	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
-	}
+	FAllocationTracker::TrackFree(MemoryHeader->Tag, MemoryAllocSize);
 
 	if (MemoryHeader->bIsAligned)
 	{
-		_aligned_free(MemoryHeader);
+		_aligned_free(static_cast<uint8*>(InMemory) - MemoryHeader->AlignedOffset);
 	}
 	else
 	{
@@ -103,27 +77,33 @@ void* operator new(size_t InSize, align_val_t InAlignment)
 {
 	size_t Alignment = static_cast<size_t>(InAlignment);
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	const EAllocationTag Tag = FAllocationTracker::GetCurrentTag();
+	FAllocationTracker::TrackAllocation(Tag, InSize);
 
-	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
-	size_t TotalSize = sizeof(AllocHeader) + InSize;
+	// 헤더는 사용자 영역 바로 앞에 두고, 사용자 영역이 정렬 경계에서 시작하도록 헤더 공간을 정렬 단위로 올린다
+	const size_t HeaderSize = (sizeof(AllocHeader) + Alignment - 1) & ~(Alignment - 1);
+	size_t TotalSize = HeaderSize + InSize;
 
 	// aligned_alloc 사용
 	// 크기는 정렬값의 배수로 처리해야 함
 	size_t AlignedTotalSize = (TotalSize + Alignment - 1) & ~(Alignment - 1);
 
 #ifdef _MSC_VER
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
+	uint8* Block = static_cast<uint8*>(_aligned_malloc(AlignedTotalSize, Alignment));
 #else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
+	uint8* Block = static_cast<uint8*>(aligned_malloc(Alignment, AlignedTotalSize));
 #endif
 
+	uint8* UserMemory = Block + HeaderSize;
+	AllocHeader* MemoryHeader = reinterpret_cast<AllocHeader*>(UserMemory) - 1;
+
 	// 실제 할당된 크기를 저장
 	MemoryHeader->size = InSize;
 	MemoryHeader->bIsAligned = true;
+	MemoryHeader->Tag = Tag;
+	MemoryHeader->AlignedOffset = static_cast<uint32>(HeaderSize);
 
-	return MemoryHeader + 1;
+	return UserMemory;
 }
 
 void operator delete(void* InMemory, align_val_t InAlignment) noexcept
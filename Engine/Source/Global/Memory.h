@@ -1,11 +1,53 @@
 #pragma once
+#include <atomic>
+#include <new>
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+#include "Global/AllocationTracker.h"
 
+// 전역 new/delete의 사용량은 FAllocationTracker가 스레드별/태그별로 집계한다
 struct AllocHeader
 {
 	size_t size;
 	bool bIsAligned;
+	// 할당 시점의 태그 (해제하는 스레드의 태그와 다를 수 있으므로 저장)
+	EAllocationTag Tag;
+	// 정렬 할당에서 블록 시작부터 사용자 영역까지의 거리 (해제 시 블록 시작 주소 복원용)
+	uint32 AlignedOffset;
+};
+// 일반 할당은 malloc 결과 + 헤더를 반환하므로, 헤더가 16 bytes여야 16 bytes 정렬이 유지된다
+static_assert(sizeof(AllocHeader) == 16, "AllocHeader must keep 16-byte alignment of plain allocations");
+
+/**
+ * @brief 정렬 operator new로 Alignment 경계에서 시작하는 메모리를 받는 STL 할당자
+ * 캐시 라인 단위로 배치해야 하는 배열용 (예: TArray<T, TAlignedAllocator<T, 64>>)
+ */
+template<typename T, size_t Alignment>
+struct TAlignedAllocator
+{
+	static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(T), "Alignment must be a power of two no smaller than alignof(T)");
+
+	using value_type = T;
+
+	template<typename U>
+	struct rebind { using other = TAlignedAllocator<U, Alignment>; };
+
+	TAlignedAllocator() = default;
+	template<typename U>
+	TAlignedAllocator(const TAlignedAllocator<U, Alignment>&) {}
+
+	T* allocate(size_t InCount)
+	{
+		return static_cast<T*>(::operator new(InCount * sizeof(T), std::align_val_t(Alignment)));
+	}
+
+	void deallocate(T* InMemory, size_t)
+	{
+		::operator delete(InMemory, std::align_val_t(Alignment));
+	}
+
+	template<typename U>
+	bool operator==(const TAlignedAllocator<U, Alignment>&) const { return true; }
+	template<typename U>
+	bool operator!=(const TAlignedAllocator<U, Alignment>&) const { return false; }
 };
 
@@ -0,0 +1,351 @@
+#include "pch.h"
+#include "Global/ObjectPool.h"
+#include "Global/AllocationTracker.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <mutex>
+
+namespace
+{
+	constexpr size_t SIZE_CLASS_COUNT = FObjectPoolAllocator::MAX_POOLED_SIZE / FObjectPoolAllocator::SIZE_CLASS_GRANULARITY;
+
+	struct FObjectPool;
+
+	/**
+	 * @brief 슬랩 맨 앞에 두는 헤더
+	 * 슬랩은 SLAB_SIZE로 정렬되어 있어 객체 주소의 하위 비트를 지우면 헤더를 찾을 수 있다
+	 */
+	struct alignas(64) FSlabHeader
+	{
+		FObjectPool* Owner;
+		// 빈 칸이 있는 슬랩 목록 연결
+		FSlabHeader* PrevPartial;
+		FSlabHeader* NextPartial;
+		// 해제되어 돌아온 칸 (칸의 첫 8바이트에 다음 칸 주소를 저장)
+		void* FreeList;
+		// 한 번도 쓰지 않은 칸의 시작 순서 (슬랩을 처음부터 차례로 채운다)
+		uint32 BumpIndex;
+		uint32 UsedCount;
+		bool bIsInPartialList;
+	};
+
+	struct FObjectPool
+	{
+		std::mutex Mutex;
+		size_t SlotSize = 0;
+		uint32 SlotsPerSlab = 0;
+		FSlabHeader* PartialSlabs = nullptr;
+		uint32 ObjectCount = 0;
+		uint32 SlabCount = 0;
+		// 비었지만 다시 쓰기 위해 남겨 둔 슬랩 수 (PartialSlabs에 함께 들어 있다)
+		uint32 EmptySlabCount = 0;
+	};
+
+	std::atomic<uint64> GPoolSlabBytes{ 0 };
+	std::atomic<uint64> GPoolUsedBytes{ 0 };
+	std::atomic<uint32> GPoolObjectCount{ 0 };
+	std::atomic<uint32> GPoolSlabCount{ 0 };
+	std::atomic<uint32> GPoolEmptySlabCount{ 0 };
+
+	FObjectPool* GetPools()
+	{
+		// 정적 소멸 순서와 관계없이 종료 중에 해제되는 객체도 처리할 수 있도록 해제하지 않는다
+		static FObjectPool* Pools = []()
+		{
+			FObjectPool* NewPools = new FObjectPool[SIZE_CLASS_COUNT];
+			for (size_t Index = 0; Index < SIZE_CLASS_COUNT; ++Index)
+			{
+				NewPools[Index].SlotSize = (Index + 1) * FObjectPoolAllocator::SIZE_CLASS_GRANULARITY;
+				NewPools[Index].SlotsPerSlab = static_cast<uint32>((FObjectPoolAllocator::SLAB_SIZE - sizeof(FSlabHeader)) / NewPools[Index].SlotSize);
+			}
+			return NewPools;
+		}();
+		return Pools;
+	}
+
+	FObjectPool& GetPool(size_t InSize)
+	{
+		const size_t SizeClass = InSize == 0 ? 0 : (InSize - 1) / FObjectPoolAllocator::SIZE_CLASS_GRANULARITY;
+		return GetPools()[SizeClass];
+	}
+
+	uint8* GetSlot(FSlabHeader* InSlab, size_t InSlotSize, uint32 InIndex)
+	{
+		return reinterpret_cast<uint8*>(InSlab) + sizeof(FSlabHeader) + InSlotSize * InIndex;
+	}
+
+	void PushPartial(FObjectPool& InPool, FSlabHeader* InSlab)
+	{
+		InSlab->PrevPartial = nullptr;
+		InSlab->NextPartial = InPool.PartialSlabs;
+		if (InPool.PartialSlabs)
+		{
+			InPool.PartialSlabs->PrevPartial = InSlab;
+		}
+		InPool.PartialSlabs = InSlab;
+		InSlab->bIsInPartialList = true;
+	}
+
+	void RemovePartial(FObjectPool& InPool, FSlabHeader* InSlab)
+	{
+		if (InSlab->PrevPartial)
+		{
+			InSlab->PrevPartial->NextPartial = InSlab->NextPartial;
+		}
+		else
+		{
+			InPool.PartialSlabs = InSlab->NextPartial;
+		}
+
+		if (InSlab->NextPartial)
+		{
+			InSlab->NextPartial->PrevPartial = InSlab->PrevPartial;
+		}
+
+		InSlab->PrevPartial = nullptr;
+		InSlab->NextPartial = nullptr;
+		InSlab->bIsInPartialList = false;
+	}
+
+	void* AllocateSlab()
+	{
+#ifdef _MSC_VER
+		return _aligned_malloc(FObjectPoolAllocator::SLAB_SIZE, FObjectPoolAllocator::SLAB_SIZE);
+#else
+		return aligned_alloc(FObjectPoolAllocator::SLAB_SIZE, FObjectPoolAllocator::SLAB_SIZE);
+#endif
+	}
+
+	void FreeSlab(void* InSlab)
+	{
+#ifdef _MSC_VER
+		_aligned_free(InSlab);
+#else
+		free(InSlab);
+#endif
+	}
+}
+
+void* FObjectPoolAllocator::Allocate(size_t InSize)
+{
+	if (InSize > MAX_POOLED_SIZE)
+	{
+		return ::operator new(InSize);
+	}
+
+	FObjectPool& Pool = GetPool(InSize);
+	std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+	FSlabHeader* Slab = Pool.PartialSlabs;
+	if (!Slab)
+	{
+		Slab = static_cast<FSlabHeader*>(AllocateSlab());
+		if (!Slab)
+		{
+			throw std::bad_alloc();
+		}
+
+		*Slab = {};
+		Slab->Owner = &Pool;
+		PushPartial(Pool, Slab);
+
+		++Pool.SlabCount;
+		++GPoolSlabCount;
+		GPoolSlabBytes += SLAB_SIZE;
+		FAllocationTracker::TrackAllocation(EAllocationTag::ObjectPool, SLAB_SIZE);
+	}
+	else if (Slab->UsedCount == 0)
+	{
+		--Pool.EmptySlabCount;
+		--GPoolEmptySlabCount;
+	}
+
+	void* Memory;
+	if (Slab->FreeList)
+	{
+		Memory = Slab->FreeList;
+		Slab->FreeList = *static_cast<void**>(Memory);
+	}
+	else
+	{
+		Memory = GetSlot(Slab, Pool.SlotSize, Slab->BumpIndex++);
+	}
+
+	++Slab->UsedCount;
+	if (Slab->UsedCount == Pool.SlotsPerSlab)
+	{
+		RemovePartial(Pool, Slab);
+	}
+
+	++Pool.ObjectCount;
+	++GPoolObjectCount;
+	GPoolUsedBytes += Pool.SlotSize;
+	return Memory;
+}
+
+void FObjectPoolAllocator::Free(void* InMemory, size_t InSize)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	if (InSize > MAX_POOLED_SIZE)
+	{
+		::operator delete(InMemory);
+		return;
+	}
+
+	FSlabHeader* Slab = reinterpret_cast<FSlabHeader*>(reinterpret_cast<uintptr_t>(InMemory) & ~(static_cast<uintptr_t>(SLAB_SIZE) - 1));
+	FObjectPool& Pool = *Slab->Owner;
+	std::lock_guard<std::mutex> Lock(Pool.Mutex);
+
+	*static_cast<void**>(InMemory) = Slab->FreeList;
+	Slab->FreeList = InMemory;
+	--Slab->UsedCount;
+
+	--Pool.ObjectCount;
+	--GPoolObjectCount;
+	GPoolUsedBytes -= Pool.SlotSize;
+
+	// 가득 차 있던 슬랩은 다시 빈 칸 목록 앞에 넣어 다음 할당이 방금 비운 칸을 재사용하도록 한다
+	if (!Slab->bIsInPartialList)
+	{
+		PushPartial(Pool, Slab);
+	}
+
+	if (Slab->UsedCount > 0)
+	{
+		return;
+	}
+
+	// 생성/삭제가 반복될 때 새 슬랩의 페이지 폴트를 피하도록 빈 슬랩은 전체 MAX_CACHED_EMPTY_SLAB_BYTES까지 남겨 둔다
+	if (GPoolEmptySlabCount < MAX_CACHED_EMPTY_SLAB_BYTES / SLAB_SIZE)
+	{
+		++Pool.EmptySlabCount;
+		++GPoolEmptySlabCount;
+		return;
+	}
+
+	RemovePartial(Pool, Slab);
+	FreeSlab(Slab);
+
+	--Pool.SlabCount;
+	--GPoolSlabCount;
+	GPoolSlabBytes -= SLAB_SIZE;
+	FAllocationTracker::TrackFree(EAllocationTag::ObjectPool, SLAB_SIZE);
+}
+
+FObjectPoolAllocator::FStats FObjectPoolAllocator::GetStats()
+{
+	FStats Stats;
+	Stats.SlabBytes = GPoolSlabBytes.load(std::memory_order_relaxed);
+	Stats.UsedBytes = GPoolUsedBytes.load(std::memory_order_relaxed);
+	Stats.ObjectCount = GPoolObjectCount.load(std::memory_order_relaxed);
+	Stats.SlabCount = GPoolSlabCount.load(std::memory_order_relaxed);
+	Stats.EmptySlabCount = GPoolEmptySlabCount.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FObjectPoolAllocator::DumpStats()
+{
+	const FStats Stats = GetStats();
+	UE_LOG_INFO("UObject Pool: %u objects, %u slabs (%u empty), %.2f / %.2f MB used", Stats.ObjectCount, Stats.SlabCount, Stats.EmptySlabCount,
+		static_cast<double>(Stats.UsedBytes) / (1024.0 * 1024.0), static_cast<double>(Stats.SlabBytes) / (1024.0 * 1024.0));
+
+	FObjectPool* Pools = GetPools();
+	for (size_t Index = 0; Index < SIZE_CLASS_COUNT; ++Index)
+	{
+		FObjectPool& Pool = Pools[Index];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		if (Pool.SlabCount == 0)
+		{
+			continue;
+		}
+
+		UE_LOG_INFO("  %4zu bytes: %u objects, %u slabs (%u empty, %u slots/slab)", Pool.SlotSize, Pool.ObjectCount, Pool.SlabCount,
+			Pool.EmptySlabCount, Pool.SlotsPerSlab);
+	}
+}
+
+void RunObjectPoolBenchmark(const TArray<size_t>& InObjectSizes, int32 InCount)
+{
+	if (InObjectSizes.empty() || InCount <= 0)
+	{
+		return;
+	}
+
+	struct FAllocator
+	{
+		const char* Name;
+		void* (*Allocate)(size_t);
+		void (*Free)(void*, size_t);
+	};
+
+	const FAllocator Allocators[] =
+	{
+		{ "Global heap", [](size_t InSize) { return ::operator new(InSize); }, [](void* InMemory, size_t) { ::operator delete(InMemory); } },
+		{ "Object pool", &FObjectPoolAllocator::Allocate, &FObjectPoolAllocator::Free },
+	};
+
+	const int32 TypeCount = static_cast<int32>(InObjectSizes.size());
+	const int32 TotalCount = InCount * TypeCount;
+
+	UE_LOG_INFO("Object Pool Benchmark: %d objects x %d types", InCount, TypeCount);
+	for (const FAllocator& Allocator : Allocators)
+	{
+		double BestSpawnMs = DBL_MAX;
+		double BestIterateMs = DBL_MAX;
+		uint64 Checksum = 0;
+
+		for (int32 Repeat = 0; Repeat < FBenchmark::DEFAULT_REPEAT_COUNT; ++Repeat)
+		{
+			TArray<uint8*> Objects(TotalCount);
+
+			// 생성 -> 절반 삭제 -> 다시 생성 -> 전체 삭제 (액터 하나가 여러 종류의 컴포넌트를 번갈아 생성하는 순서)
+			const double SpawnMs = FBenchmark::MeasureOnce([&]()
+			{
+				for (int32 Index = 0; Index < TotalCount; ++Index)
+				{
+					Objects[Index] = static_cast<uint8*>(Allocator.Allocate(InObjectSizes[Index % TypeCount]));
+					*Objects[Index] = static_cast<uint8>(Index);
+				}
+				for (int32 Index = 0; Index < TotalCount; Index += 2)
+				{
+					Allocator.Free(Objects[Index], InObjectSizes[Index % TypeCount]);
+				}
+				for (int32 Index = 0; Index < TotalCount; Index += 2)
+				{
+					Objects[Index] = static_cast<uint8*>(Allocator.Allocate(InObjectSizes[Index % TypeCount]));
+					*Objects[Index] = static_cast<uint8>(Index);
+				}
+			});
+
+			// 첫 번째 종류의 객체만 생성 순서로 읽는다 (같은 클래스 컴포넌트를 순회하는 접근 패턴)
+			uint64 Sum = 0;
+			const double IterateMs = FBenchmark::MeasureOnce([&]()
+			{
+				for (int32 Index = 0; Index < TotalCount; Index += TypeCount)
+				{
+					Sum += *Objects[Index];
+				}
+			});
+			Checksum = Sum;
+
+			const double FreeMs = FBenchmark::MeasureOnce([&]()
+			{
+				for (int32 Index = 0; Index < TotalCount; ++Index)
+				{
+					Allocator.Free(Objects[Index], InObjectSizes[Index % TypeCount]);
+				}
+			});
+
+			BestSpawnMs = std::min(BestSpawnMs, SpawnMs + FreeMs);
+			BestIterateMs = std::min(BestIterateMs, IterateMs);
+		}
+
+		// 할당 1.5회 + 해제 1.5회
+		UE_LOG_INFO("  %s: Spawn/Destroy %.3f ms (%.1f ns/op), Iterate first type %.3f ms (checksum %llu)", Allocator.Name,
+			BestSpawnMs, BestSpawnMs * 1.0e6 / (TotalCount * 3.0), BestIterateMs, Checksum);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @brief UObject 파생 객체 전용 크기별 슬랩 풀 할당자
+ * 객체 크기를 SIZE_CLASS_GRANULARITY 단위로 올려 같은 크기 클래스끼리 SLAB_SIZE 슬랩을 나눠 쓰므로,
+ * 같은 종류의 컴포넌트가 인접한 메모리에 모이고 할당/해제가 빈 칸 목록의 push/pop으로 끝난다
+ * MAX_POOLED_SIZE보다 큰 객체는 전역 operator new로 할당한다
+ * @note 크기 클래스마다 잠금을 따로 두어 Worker 스레드에서도 사용할 수 있다.
+ * 종료 중에 소멸되는 객체도 해제할 수 있도록 풀 자체는 해제하지 않는다
+ */
+class FObjectPoolAllocator
+{
+public:
+	static constexpr size_t SLAB_SIZE = 64 * 1024;
+	static constexpr size_t SIZE_CLASS_GRANULARITY = 16;
+	static constexpr size_t MAX_POOLED_SIZE = 2048;
+	// 모든 크기 클래스를 합쳐 해제하지 않고 남겨 둘 빈 슬랩의 최대 바이트
+	static constexpr size_t MAX_CACHED_EMPTY_SLAB_BYTES = 64 * 1024 * 1024;
+
+	// 풀에서 할당한 객체가 보장하는 정렬
+	static constexpr size_t POOL_ALIGNMENT = SIZE_CLASS_GRANULARITY;
+
+	static void* Allocate(size_t InSize);
+
+	/**
+	 * @param InSize Allocate에 넘긴 크기 (가상 소멸자를 가진 클래스의 sized delete가 넘겨주는 동적 타입의 크기)
+	 */
+	static void Free(void* InMemory, size_t InSize);
+
+	struct FStats
+	{
+		uint64 SlabBytes = 0;
+		// 크기 클래스로 올린 사용 중인 칸의 바이트
+		uint64 UsedBytes = 0;
+		uint32 ObjectCount = 0;
+		uint32 SlabCount = 0;
+		uint32 EmptySlabCount = 0;
+	};
+
+	static FStats GetStats();
+
+	/**
+	 * @brief 사용 중인 크기 클래스별 칸 크기, 객체 수, 슬랩 수를 로그로 출력
+	 */
+	static void DumpStats();
+};
+
+/**
+ * @brief 액터 생성/삭제처럼 크기가 다른 객체들을 번갈아 InCount개씩 할당하고 일부를 해제한 뒤 다시 채우는 비용과,
+ * 첫 번째 크기의 객체만 골라 순회하는 비용을 전역 힙(operator new)과 FObjectPoolAllocator로 비교하여 로그로 출력
+ */
+void RunObjectPoolBenchmark(const TArray<size_t>& InObjectSizes, int32 InCount);
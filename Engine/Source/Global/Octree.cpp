@@ -13,6 +13,11 @@ namespace
 
 		return FAABB(Min, Max);
 	}
+
+	// 자식 인덱스의 비트 구성: 1 = X 양의 방향, 2 = Z 양의 방향, 4 = Y 음의 방향 (Subdivide의 자식 배치와 동일)
+	constexpr int CHILD_POSITIVE_X = 1;
+	constexpr int CHILD_POSITIVE_Z = 2;
+	constexpr int CHILD_NEGATIVE_Y = 4;
 }
 
 FOctree::FOctree()
@@ -21,23 +26,25 @@ FOctree::FOctree()
 	Children.resize(8);
 }
 
-FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
-	: BoundingBox(InBoundingBox), Depth(InDepth)
+FOctree::FOctree(const FAABB& InBoundingBox, int InDepth, float InLooseness)
+	: BoundingBox(InBoundingBox), CellExtent((InBoundingBox.Max - InBoundingBox.Min) * 0.5f), Looseness(max(InLooseness, 1.0f)), Depth(InDepth)
 {
 	Children.resize(8);
 }
 
-FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
-	: Depth(InDepth)
+FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth, float InLooseness)
+	: Looseness(max(InLooseness, 1.0f)), Depth(InDepth)
 {
 	const float HalfSize = InSize * 0.5f;
 	BoundingBox.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
 	BoundingBox.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
+	CellExtent = FVector(HalfSize, HalfSize, HalfSize);
 	Children.resize(8);
 }
 
 FOctree::~FOctree()
 {
+	ResetPrimitiveOwners();
 	Primitives.clear();
 	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
 }
@@ -47,87 +54,230 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
+	return InsertWithBounds(InPrimitive, GetPrimitiveBoundingBox(InPrimitive));
+}
+
+bool FOctree::InsertWithBounds(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
+{
 	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	if (BoundingBox.IsIntersected(InPrimitiveBox) == false) { return false; }
 
 	if (IsLeaf())
 	{
 		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
 		if (Primitives.size() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
 		{
-			Primitives.push_back(InPrimitive); // 해당 객체를 추가한다
+			AddPrimitive(InPrimitive, InPrimitiveBox); // 해당 객체를 추가한다
 			return true;
 		}
 		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
 		{
 			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
+			Subdivide(InPrimitive, InPrimitiveBox);
 			return true;
 		}
 	}
 	else
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		// 영역 내에 해당 객체가 완전히 들어가는 자식 노드가 있다면 넘겨준다
+		if (const int ChildIndex = FindChildIndex(InPrimitiveBox); ChildIndex >= 0)
 		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingBox.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
-			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
-			}
+			return Children[ChildIndex]->InsertWithBounds(InPrimitive, InPrimitiveBox);
 		}
 
-		Primitives.push_back(InPrimitive);
+		AddPrimitive(InPrimitive, InPrimitiveBox);
 		return true;
 	}
 
 	return false;
 }
 
+void FOctree::AddPrimitive(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
+{
+	InPrimitive->OctreeNode = this;
+	InPrimitive->OctreeNodeIndex = static_cast<int32>(Primitives.size());
+	InPrimitive->OctreeBounds = InPrimitiveBox;
+	Primitives.push_back(InPrimitive);
+}
+
+int FOctree::FindChildIndex(const FAABB& InPrimitiveBox) const
+{
+	// 일반 옥트리: 자식 셀은 겹치지 않으므로 완전히 포함하는 자식을 순서대로 찾는다
+	if (Looseness <= 1.0f)
+	{
+		for (int Index = 0; Index < 8; ++Index)
+		{
+			if (Children[Index] && Children[Index]->BoundingBox.IsContains(InPrimitiveBox))
+			{
+				return Index;
+			}
+		}
+		return -1;
+	}
+
+	// Loose 옥트리: 프리미티브 중심이 속한 셀의 자식 하나만 후보가 되며, 확장된 경계에 들어가는지(크기)만 확인
+	const FVector Center = BoundingBox.GetCenter();
+	const FVector PrimitiveCenter = InPrimitiveBox.GetCenter();
+	int ChildIndex = 0;
+	if (PrimitiveCenter.X >= Center.X) { ChildIndex |= CHILD_POSITIVE_X; }
+	if (PrimitiveCenter.Z >= Center.Z) { ChildIndex |= CHILD_POSITIVE_Z; }
+	if (PrimitiveCenter.Y < Center.Y) { ChildIndex |= CHILD_NEGATIVE_Y; }
+
+	const FOctree* Child = Children[ChildIndex];
+	return Child && Child->BoundingBox.IsContains(InPrimitiveBox) ? ChildIndex : -1;
+}
+
 bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 {
 	if (InPrimitive == nullptr) { return false; }
 
+	// 1. 소유 노드 기록이 이 트리를 가리킨다면 O(1)로 제거
+	if (FindOwnerNode(InPrimitive))
+	{
+		DetachPrimitive(InPrimitive);
+		return true;
+	}
+
+	// 2. 기록이 없다면 배치될 때의 경계를 따라 탐색 (Update 없이 움직였을 수 있으므로 현재 경계는 쓰지 않는다)
+	return RemoveBySearch(InPrimitive, InPrimitive->OctreeBounds);
+}
+
+bool FOctree::RemoveBySearch(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
+{
 	// 0. 현재 노드와 프리미티브가 겹치지 않으면, 탐색 종료
-	if (!BoundingBox.IsIntersected(GetPrimitiveBoundingBox(InPrimitive))) { return false; }
+	if (!BoundingBox.IsIntersected(InPrimitiveBox)) { return false; }
 
-	// 1-A. 리프 노드인 경우, 직접 프리미티브 목록에서 제거 시도
-	if (IsLeaf())
+	// 1. 현재 노드의 프리미티브 목록 (자식에 완전히 들어가지 못한 프리미티브는 내부 노드에도 있다)
+	if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
 	{
-		// 리프 노드 내에 대상을 발견한다면, 마지막 요소 위치로 옮긴 뒤 삭제
-		if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
-		{
-			*It = std::move(Primitives.back());
-			Primitives.pop_back();
+		InPrimitive->OctreeNode = this;
+		InPrimitive->OctreeNodeIndex = static_cast<int32>(It - Primitives.begin());
+		DetachPrimitive(InPrimitive);
+		return true;
+	}
 
-			return true;
+	// 2. 자식 노드가 있는 경우, 순차적으로 자식 노드 내부를 탐색
+	if (!IsLeaf())
+	{
+		for (int Index = 0; Index < 8; ++Index)
+		{
+			if (Children[Index]->RemoveBySearch(InPrimitive, InPrimitiveBox)) { return true; }
 		}
+	}
 
-		return false; // 없으므로 탐색 종료
+	return false;
+}
+
+bool FOctree::Update(UPrimitiveComponent* InPrimitive, const FAABB& InNewBounds)
+{
+	if (InPrimitive == nullptr) { return false; }
+
+	FOctree* OwnerNode = FindOwnerNode(InPrimitive);
+	if (!OwnerNode)
+	{
+		// 이 트리에 기록이 없으면 배치될 때의 경계로 기존 항목을 찾아 제거한 뒤 삽입
+		// (새 경계로 찾으면 움직인 프리미티브의 기존 항목이 남아 같은 프리미티브가 두 번 들어간다)
+		RemoveBySearch(InPrimitive, InPrimitive->OctreeBounds);
+		return InsertWithBounds(InPrimitive, InNewBounds);
 	}
-	// 1-B. 자식 노드가 있는 경우, 순차적으로 자식 노드 내부를 탐색
-	else
+
+	// 1. 새 경계가 여전히 소유 노드에 맞고, 더 깊은 자식으로 내려갈 수도 없다면 그대로 둔다
+	// (루트는 완전히 포함되지 않더라도 겹치기만 하면 보관한다)
+	const bool bFitsOwner = OwnerNode->BoundingBox.IsContains(InNewBounds) ||
+		(OwnerNode->Parent == nullptr && OwnerNode->BoundingBox.IsIntersected(InNewBounds));
+	if (bFitsOwner && (OwnerNode->IsLeaf() || OwnerNode->FindChildIndex(InNewBounds) < 0))
 	{
-		bool bIsRemoved = false;
+		// 노드 분할 시 재배치와 기록 없는 제거가 이 경계를 사용하므로 노드에 남더라도 갱신
+		InPrimitive->OctreeBounds = InNewBounds;
+		return true;
+	}
 
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			if (Children[Index]->Remove(InPrimitive))
-			{
-				bIsRemoved = true;
-				break;
-			}
-		}
+	// 2. 소유 노드에서 빼낸 뒤, 새 경계를 완전히 포함하는 가장 가까운 조상(또는 루트)부터 다시 삽입
+	OwnerNode->DetachPrimitive(InPrimitive);
+
+	FOctree* TargetNode = OwnerNode;
+	while (TargetNode->Parent && !TargetNode->BoundingBox.IsContains(InNewBounds))
+	{
+		TargetNode = TargetNode->Parent;
+	}
 
-		// 4. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
-		if (bIsRemoved) { TryMerge(); }
+	return TargetNode->InsertWithBounds(InPrimitive, InNewBounds);
+}
+
+void FOctree::Compact()
+{
+	if (!bNeedsCompaction) { return; }
+	bNeedsCompaction = false;
+
+	if (IsLeaf()) { return; }
+
+	// 자식부터 병합해야 연쇄적으로 상위 노드까지 합쳐질 수 있다
+	for (int Index = 0; Index < 8; ++Index) { Children[Index]->Compact(); }
+	TryMerge();
+}
+
+FOctree* FOctree::FindOwnerNode(UPrimitiveComponent* InPrimitive) const
+{
+	FOctree* OwnerNode = InPrimitive->OctreeNode;
+	if (!OwnerNode) { return nullptr; }
+
+	// 이 트리에 없는 프리미티브(DeepCopy로 만든 사본 트리에서 호출한 경우 등)의 기록은 다른 트리의 노드를 가리키므로 루트를 확인
+	const FOctree* RootNode = OwnerNode;
+	while (RootNode->Parent) { RootNode = RootNode->Parent; }
+	if (RootNode != this) { return nullptr; }
 
-		return bIsRemoved;
+	const int32 Index = InPrimitive->OctreeNodeIndex;
+	if (Index < 0 || Index >= static_cast<int32>(OwnerNode->Primitives.size()) || OwnerNode->Primitives[Index] != InPrimitive)
+	{
+		return nullptr;
+	}
+
+	return OwnerNode;
+}
+
+void FOctree::DetachPrimitive(UPrimitiveComponent* InPrimitive)
+{
+	FOctree* OwnerNode = InPrimitive->OctreeNode;
+	const int32 Index = InPrimitive->OctreeNodeIndex;
+
+	// 마지막 요소를 빈 자리로 옮긴 뒤 삭제
+	UPrimitiveComponent* LastPrimitive = OwnerNode->Primitives.back();
+	OwnerNode->Primitives[Index] = LastPrimitive;
+	LastPrimitive->OctreeNodeIndex = Index;
+	OwnerNode->Primitives.pop_back();
+
+	InPrimitive->OctreeNode = nullptr;
+	InPrimitive->OctreeNodeIndex = -1;
+
+	OwnerNode->MarkForCompaction();
+}
+
+void FOctree::MarkForCompaction()
+{
+	// 이미 표시된 노드의 조상은 모두 표시되어 있다
+	for (FOctree* Node = this; Node && !Node->bNeedsCompaction; Node = Node->Parent)
+	{
+		Node->bNeedsCompaction = true;
+	}
+}
+
+void FOctree::ResetPrimitiveOwners()
+{
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (Primitive->OctreeNode == this)
+		{
+			Primitive->OctreeNode = nullptr;
+			Primitive->OctreeNodeIndex = -1;
+		}
 	}
 }
 
 void FOctree::Clear()
 {
+	ResetPrimitiveOwners();
 	Primitives.clear();
+	bNeedsCompaction = false;
 	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
 }
 
@@ -184,11 +334,36 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 	return Candidates;
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+bool FOctree::FindRayCandidates(const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate) const
+{
+	if (CheckIntersectionRayBox(WorldRay, BoundingBox) == false) { return false; }
+
+	OutCandidate.insert(OutCandidate.end(), Primitives.begin(), Primitives.end());
+	if (!IsLeaf())
+	{
+		for (const FOctree* Child : Children) { Child->FindRayCandidates(WorldRay, OutCandidate); }
+	}
+
+	return true;
+}
+
+void FOctree::FindOverlapCandidates(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutCandidate) const
 {
-	const FVector& Min = BoundingBox.Min;
-	const FVector& Max = BoundingBox.Max;
-	const FVector Center = (Min + Max) * 0.5f;
+	if (BoundingBox.IsIntersected(InBox) == false) { return; }
+
+	OutCandidate.insert(OutCandidate.end(), Primitives.begin(), Primitives.end());
+	if (!IsLeaf())
+	{
+		for (const FOctree* Child : Children) { Child->FindOverlapCandidates(InBox, OutCandidate); }
+	}
+}
+
+void FOctree::Subdivide(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox)
+{
+	// 셀 기준으로 8등분 (Loose 모드에서도 부모의 확장 경계가 아니라 셀을 나눈다)
+	const FVector Center = BoundingBox.GetCenter();
+	const FVector Min = Center - CellExtent;
+	const FVector Max = Center + CellExtent;
 
 	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
 	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
@@ -199,14 +374,28 @@ void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
 	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
 	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
 
+	for (FOctree* Child : Children) { Child->Parent = this; }
+
+	// Loose 모드라면 자식 경계를 셀 중심 기준으로 Looseness 배 확장
+	if (Looseness > 1.0f)
+	{
+		for (FOctree* Child : Children)
+		{
+			const FVector ChildCenter = Child->BoundingBox.GetCenter();
+			const FVector LooseExtent = Child->CellExtent * Looseness;
+			Child->BoundingBox = FAABB(ChildCenter - LooseExtent, ChildCenter + LooseExtent);
+			Child->Looseness = Looseness;
+		}
+	}
+
 	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.push_back(InPrimitive);
 	Primitives.clear();
 
 	for (UPrimitiveComponent* prim : primitivesToMove)
 	{
-		Insert(prim);
+		InsertWithBounds(prim, prim->OctreeBounds);
 	}
+	InsertWithBounds(InPrimitive, InPrimitiveBox);
 }
 
 void FOctree::TryMerge()
@@ -235,7 +424,7 @@ void FOctree::TryMerge()
 	{
 		for (int Index = 0; Index < 8; ++Index)
 		{
-			Primitives.insert(Primitives.end(), Children[Index]->Primitives.begin(), Children[Index]->Primitives.end());
+			for (UPrimitiveComponent* Primitive : Children[Index]->Primitives) { AddPrimitive(Primitive, Primitive->OctreeBounds); }
 		}
 
 		// 모든 자식 노드를 메모리에서 해제
@@ -249,10 +438,14 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 
 	// 1) 필드 복사
 	OutOctree->BoundingBox = BoundingBox;
+	OutOctree->CellExtent = CellExtent;
+	OutOctree->Looseness = Looseness;
 	OutOctree->Depth = Depth;
 
 	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
 	//    - 프리미티브는 대입으로 교체
+	//      (대상이 보관하던 프리미티브의 소유 노드 기록은 먼저 해제, 복사본은 원본의 기록을 바꾸지 않음)
+	OutOctree->ResetPrimitiveOwners();
 	OutOctree->Primitives = Primitives; // shallow copy of pointers
 
 	//    - 기존 자식 노드 메모리 해제
@@ -272,8 +465,124 @@ void FOctree::DeepCopy(FOctree* OutOctree) const
 			{
 				// 자식 노드 생성 후 재귀 복사
 				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingBox, Children[Index]->Depth);
+				OutOctree->Children[Index]->Parent = OutOctree;
 				Children[Index]->DeepCopy(OutOctree->Children[Index]);
 			}
 		}
 	}
 }
+
+void FOctree::GatherStats(FOctreeStats& OutStats) const
+{
+	const uint32 PrimitiveCount = static_cast<uint32>(Primitives.size());
+	FOctreeStats::FDepthStats& DepthStats = OutStats.Depths[min(max(Depth, 0), MAX_DEPTH)];
+
+	++DepthStats.NodeCount;
+	DepthStats.PrimitiveCount += PrimitiveCount;
+	DepthStats.MaxNodePrimitiveCount = max(DepthStats.MaxNodePrimitiveCount, PrimitiveCount);
+	++DepthStats.OccupancyBuckets[FOctreeStats::GetOccupancyBucket(PrimitiveCount)];
+
+	if (IsLeaf())
+	{
+		++DepthStats.LeafCount;
+		return;
+	}
+
+	DepthStats.InteriorPrimitiveCount += PrimitiveCount;
+	for (const FOctree* Child : Children)
+	{
+		if (Child) { Child->GatherStats(OutStats); }
+	}
+}
+
+int FOctreeStats::GetOccupancyBucket(uint32 InPrimitiveCount)
+{
+	if (InPrimitiveCount == 0) { return 0; }
+	if (InPrimitiveCount <= 8) { return 1; }
+	if (InPrimitiveCount <= 16) { return 2; }
+	if (InPrimitiveCount <= 32) { return 3; }
+	if (InPrimitiveCount <= 64) { return 4; }
+	if (InPrimitiveCount <= 256) { return 5; }
+	return 6;
+}
+
+const char* FOctreeStats::GetOccupancyBucketName(int InBucket)
+{
+	static const char* BucketNames[OCCUPANCY_BUCKET_COUNT] = { "0", "1-8", "9-16", "17-32", "33-64", "65-256", "257+" };
+	return InBucket >= 0 && InBucket < OCCUPANCY_BUCKET_COUNT ? BucketNames[InBucket] : "";
+}
+
+FOctreeOwnerSnapshot::FOctreeOwnerSnapshot(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	Records.reserve(InPrimitives.size());
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (Primitive) { Records.push_back({ Primitive, Primitive->OctreeNode, Primitive->OctreeNodeIndex, Primitive->OctreeBounds }); }
+	}
+}
+
+FOctreeOwnerSnapshot::~FOctreeOwnerSnapshot()
+{
+	for (const FOwnerRecord& Record : Records)
+	{
+		Record.Primitive->OctreeNode = Record.Node;
+		Record.Primitive->OctreeNodeIndex = Record.Index;
+		Record.Primitive->OctreeBounds = Record.Bounds;
+	}
+}
+
+bool RunOctreeOwnerCheck(const TArray<UPrimitiveComponent*>& InPrimitives, const FAABB& InBoundingBox)
+{
+	if (InPrimitives.empty())
+	{
+		UE_LOG_INFO("Octree Owner Check: no primitive");
+		return true;
+	}
+
+	const FOctreeOwnerSnapshot OwnerSnapshot(InPrimitives);
+	FOctree Octree(InBoundingBox, 0);
+	for (UPrimitiveComponent* Primitive : InPrimitives) { Octree.Insert(Primitive); }
+
+	TArray<UPrimitiveComponent*> InsertedPrimitives;
+	Octree.GetAllPrimitives(InsertedPrimitives);
+	if (InsertedPrimitives.empty())
+	{
+		UE_LOG_INFO("Octree Owner Check: no primitive inside the octree bounds");
+		return true;
+	}
+
+	// 가능하면 루트가 아닌 노드에 있는 프리미티브를 골라, 움직인 뒤의 경계가 기존 노드와 겹치지 않게 한다
+	UPrimitiveComponent* Target = InsertedPrimitives[0];
+	for (UPrimitiveComponent* Primitive : InsertedPrimitives)
+	{
+		if (Primitive->OctreeNode != &Octree)
+		{
+			Target = Primitive;
+			break;
+		}
+	}
+
+	// 1. 소유 노드 기록을 잃은 채로, 기존 노드와 겹치지 않을 만큼 트리 중심 쪽으로 움직임 (Update는 기록 없이 기존 항목을 찾아야 한다)
+	const FAABB& OwnerBounds = Target->OctreeNode->GetBoundingBox();
+	const FAABB OldBounds = Target->OctreeBounds;
+	const float Direction = OldBounds.GetCenter().X <= InBoundingBox.GetCenter().X ? 1.0f : -1.0f;
+	const FVector Offset(Direction * ((OwnerBounds.Max.X - OwnerBounds.Min.X) + (OldBounds.Max.X - OldBounds.Min.X)), 0.0f, 0.0f);
+	const FAABB MovedBounds(OldBounds.Min + Offset, OldBounds.Max + Offset);
+	Target->OctreeNode = nullptr;
+	Target->OctreeNodeIndex = -1;
+	Octree.Update(Target, MovedBounds);
+
+	// 2. 다시 기록을 잃은 채로 제거 (레벨에서 액터를 삭제하는 경우, 현재 경계는 움직이기 전 그대로다)
+	Target->OctreeNode = nullptr;
+	Target->OctreeNodeIndex = -1;
+	Octree.Remove(Target);
+
+	TArray<UPrimitiveComponent*> RemainingPrimitives;
+	Octree.GetAllPrimitives(RemainingPrimitives);
+	const size_t StaleCount = std::count(RemainingPrimitives.begin(), RemainingPrimitives.end(), Target);
+	const bool bIsPassed = StaleCount == 0 && RemainingPrimitives.size() + 1 == InsertedPrimitives.size();
+
+	UE_LOG_INFO("Octree Owner Check: %s (%zu stale entries, %zu -> %zu primitives)", bIsPassed ? "passed" : "FAILED", StaleCount,
+		InsertedPrimitives.size(), RemainingPrimitives.size());
+	return bIsPassed;
+}
@@ -7,18 +7,64 @@ class UPrimitiveComponent;
 constexpr int MAX_PRIMITIVES = 32; 
 constexpr int MAX_DEPTH = 5;      
 
+/**
+ * @brief 옥트리의 깊이별 노드/프리미티브 분포 (Looseness 튜닝용)
+ */
+struct FOctreeStats
+{
+	// 노드당 프리미티브 수 구간: 0, 1-8, 9-16, 17-32, 33-64, 65-256, 257 이상
+	static constexpr int OCCUPANCY_BUCKET_COUNT = 7;
+
+	struct FDepthStats
+	{
+		uint32 NodeCount = 0;
+		uint32 LeafCount = 0;
+		uint32 PrimitiveCount = 0;
+		// 자식이 있는 노드(자식에 완전히 들어가지 못한 프리미티브)에 보관된 프리미티브 수
+		uint32 InteriorPrimitiveCount = 0;
+		uint32 MaxNodePrimitiveCount = 0;
+		uint32 OccupancyBuckets[OCCUPANCY_BUCKET_COUNT] = {};
+	};
+
+	FDepthStats Depths[MAX_DEPTH + 1];
+
+	static int GetOccupancyBucket(uint32 InPrimitiveCount);
+	static const char* GetOccupancyBucketName(int InBucket);
+};
+
 class FOctree
 {
 public:
 	FOctree();
-	FOctree(const FVector& InPosition, float InSize, int InDepth);
-	FOctree(const FAABB& InBoundingBox, int InDepth);
+	/**
+	 * @param InLooseness 자식 노드 경계를 셀 크기의 몇 배로 확장할지 (1 = 일반 옥트리)
+	 * 1보다 크면 Loose Octree로 동작하여, 프리미티브는 중심이 속한 자식 셀로 내려가고
+	 * 확장된 자식 경계에 완전히 들어가는 한 분할 평면에 걸쳐 있어도 부모에 남지 않는다
+	 */
+	FOctree(const FVector& InPosition, float InSize, int InDepth, float InLooseness = 1.0f);
+	FOctree(const FAABB& InBoundingBox, int InDepth, float InLooseness = 1.0f);
 	~FOctree();
 
 	bool Insert(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 프리미티브를 제거. 프리미티브가 기억하는 소유 노드에서 O(1)로 빼내며, 노드 병합은 Compact까지 미룬다
+	 */
 	bool Remove(UPrimitiveComponent* InPrimitive);
 	void Clear();
 
+	/**
+	 * @brief 움직인 프리미티브의 위치를 갱신
+	 * 새 경계가 여전히 소유 노드에 맞으면 그대로 두고, 아니라면 새 경계를 포함하는 가장 가까운 조상부터 다시 삽입한다
+	 * @param InNewBounds 프리미티브의 새 월드 AABB
+	 * @return 트리 안에 남아 있으면 true, 루트 영역을 벗어나 트리에서 빠졌다면 false
+	 */
+	bool Update(UPrimitiveComponent* InPrimitive, const FAABB& InNewBounds);
+
+	/**
+	 * @brief Remove/Update로 미뤄둔 노드 병합을 수행 (프레임마다 한 번 호출)
+	 */
+	void Compact();
+
 	/**
 	 * OutOctree로 현재 트리의 내용을 깊은 복사합니다.
 	 * - 최상위 노드는 새로 생성하지 않습니다. (new 사용 없음)
@@ -39,23 +85,107 @@ public:
 	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
 	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
 
+	/**
+	 * @brief 레이와 교차하는 노드들의 프리미티브를 후보로 수집
+	 * @return 루트 노드가 레이와 교차하면 true
+	 */
+	bool FindRayCandidates(const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate) const;
+
+	/**
+	 * @brief InBox와 겹치는 노드들의 프리미티브를 후보로 수집
+	 */
+	void FindOverlapCandidates(const FAABB& InBox, TArray<UPrimitiveComponent*>& OutCandidate) const;
+
+	/**
+	 * @brief 서브트리의 깊이별 노드 수, 프리미티브 수, 노드당 프리미티브 수 분포를 OutStats에 누적
+	 */
+	void GatherStats(FOctreeStats& OutStats) const;
+
 	const FAABB& GetBoundingBox() const { return BoundingBox; }
-	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; }
+	void SetBoundingBox(const FAABB& InAABB) { BoundingBox = InAABB; CellExtent = (InAABB.Max - InAABB.Min) * 0.5f; }
+	float GetLooseness() const { return Looseness; }
 	bool IsLeafNode() const { return IsLeaf(); }
 	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
 	TArray<FOctree*>& GetChildren() { return Children; }
+	const TArray<FOctree*>& GetChildren() const { return Children; }
+
+	// 프러스텀 컬링에서 이 노드를 마지막으로 거절한 평면 (다음 프레임에 가장 먼저 검사)
+	uint8 GetLastRejectPlane() const { return LastRejectPlane; }
+	void SetLastRejectPlane(uint8 InPlane) { LastRejectPlane = InPlane; }
 
 private:
 	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
+	bool InsertWithBounds(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
+	void AddPrimitive(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
+	void Subdivide(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
 	void TryMerge();
 
+	/**
+	 * @brief 프리미티브의 소유 노드 기록이 이 트리의 노드를 가리키고 있으면 그 노드를, 아니면 nullptr을 반환
+	 */
+	FOctree* FindOwnerNode(UPrimitiveComponent* InPrimitive) const;
+	// 소유 노드 기록을 이용해 노드의 프리미티브 목록에서 O(1)로 제거
+	void DetachPrimitive(UPrimitiveComponent* InPrimitive);
+	/**
+	 * @brief 소유 노드 기록이 없을 때 사용하는 재귀 탐색 제거
+	 * @param InPrimitiveBox 프리미티브가 배치될 때의 경계 (OctreeBounds). 현재 경계로 찾으면 움직인 프리미티브의 기존 항목을 놓친다
+	 */
+	bool RemoveBySearch(UPrimitiveComponent* InPrimitive, const FAABB& InPrimitiveBox);
+	void MarkForCompaction();
+	void ResetPrimitiveOwners();
+
+	/**
+	 * @brief InPrimitiveBox를 맡을 자식 노드의 인덱스를 반환 (완전히 들어가는 자식이 없으면 -1)
+	 */
+	int FindChildIndex(const FAABB& InPrimitiveBox) const;
+
+	// 탐색/컬링에 사용하는 경계 (Loose 모드에서는 셀을 Looseness 배 확장한 경계)
 	FAABB BoundingBox;
+	// 분할 기준이 되는 셀의 절반 크기 (셀의 중심은 BoundingBox의 중심과 같다)
+	FVector CellExtent;
+	float Looseness = 1.0f;
 	int Depth;                       
 	TArray<UPrimitiveComponent*> Primitives;
 	TArray<FOctree*> Children;
+	FOctree* Parent = nullptr;
+	uint8 LastRejectPlane = 0;
+	// 이 노드 또는 자손에서 제거가 일어나 병합 검사가 필요한지 여부
+	bool bNeedsCompaction = false;
+};
+
+/**
+ * @brief 프리미티브들의 소유 노드 기록(OctreeNode, OctreeNodeIndex)을 저장해 두었다가 소멸 시 되돌린다
+ * 레벨에 등록된 프리미티브를 벤치마크용 임시 FOctree에 넣으면 레벨 옥트리의 기록이 덮어써지므로,
+ * 임시 트리보다 먼저 선언하여 임시 트리가 소멸된 뒤에 되돌리도록 한다
+ */
+class FOctreeOwnerSnapshot
+{
+public:
+	explicit FOctreeOwnerSnapshot(const TArray<UPrimitiveComponent*>& InPrimitives);
+	~FOctreeOwnerSnapshot();
+
+	FOctreeOwnerSnapshot(const FOctreeOwnerSnapshot&) = delete;
+	FOctreeOwnerSnapshot& operator=(const FOctreeOwnerSnapshot&) = delete;
+
+private:
+	struct FOwnerRecord
+	{
+		UPrimitiveComponent* Primitive;
+		FOctree* Node;
+		int32 Index;
+		FAABB Bounds;
+	};
+
+	TArray<FOwnerRecord> Records;
 };
 
+/**
+ * @brief 소유 노드 기록을 잃은 프리미티브가 움직인 뒤 제거되어도 트리에 항목이 남지 않는지 임시 FOctree로 검사하여 로그로 출력
+ * InPrimitives의 소유 노드 기록은 검사 후 되돌린다. 디버그 빌드에서는 레벨을 로드할 때마다 자동으로 실행된다
+ * @return 남은 항목이 있으면 false (검사할 프리미티브가 없으면 true)
+ */
+bool RunOctreeOwnerCheck(const TArray<UPrimitiveComponent*>& InPrimitives, const FAABB& InBoundingBox);
+
 using FNodeQueue = std::priority_queue<
 	std::pair<float, FOctree*>,
 	std::vector<std::pair<float, FOctree*>>,
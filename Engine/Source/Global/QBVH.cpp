@@ -0,0 +1,538 @@
+#include "pch.h"
+#include "Global/QBVH.h"
+#include "Physics/Public/RayBoxIntersection.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/Archive.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <immintrin.h>
+
+namespace
+{
+	// 삼각형 수가 이 값 이하인 서브트리는 패킷 하나의 리프로 만든다
+	constexpr uint32 PACKET_TRIANGLE_COUNT = 4;
+
+	// 순회 중 반복 사용되는 Ray 정보 (SSE 레지스터에 splat)
+	struct FQBVHRayData
+	{
+		__m128 Origin[3];
+		__m128 InverseDirection[3];
+		__m128 Direction[3];
+		bool bIsParallel[3];
+	};
+
+	// 스택 항목: 노드 또는 리프(~패킷 인덱스)와 진입 거리
+	struct FQBVHStackEntry
+	{
+		int32 Child;
+		float EntryT;
+	};
+
+	// 패킷 순회 스택 항목: 노드 또는 리프와, 그 노드를 방문해야 하는 Ray들의 비트 마스크
+	struct FQBVHPacketStackEntry
+	{
+		int32 Child;
+		uint32 RayMask;
+	};
+
+	/**
+	 * @brief Ray 정보를 레지스터에 splat (평행한 축은 CheckIntersectionRayBox와 같이 슬랩 대신 범위 검사)
+	 */
+	void MakeRayData(const FRay& Ray, FQBVHRayData& OutRayData)
+	{
+		const float Origin[3] = { Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z };
+		const float Direction[3] = { Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z };
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutRayData.bIsParallel[Axis] = fabs(Direction[Axis]) < MATH_EPSILON;
+			OutRayData.Origin[Axis] = _mm_set1_ps(Origin[Axis]);
+			OutRayData.Direction[Axis] = _mm_set1_ps(Direction[Axis]);
+			OutRayData.InverseDirection[Axis] = _mm_set1_ps(OutRayData.bIsParallel[Axis] ? 0.0f : 1.0f / Direction[Axis]);
+		}
+	}
+
+	/**
+	 * @brief 네 자식 AABB를 한 번에 슬랩 테스트
+	 * @return [InMinT, InMaxT] 안에서 교차한 자식의 비트 마스크 (진입 거리는 OutEntryT에 기록)
+	 */
+	int32 IntersectChildren(const FQBVHRayData& RayData, const FQBVHNode& Node, float InMinT, float InMaxT, float OutEntryT[4])
+	{
+		const __m128 BoxMin[3] = { _mm_load_ps(Node.MinX), _mm_load_ps(Node.MinY), _mm_load_ps(Node.MinZ) };
+		const __m128 BoxMax[3] = { _mm_load_ps(Node.MaxX), _mm_load_ps(Node.MaxY), _mm_load_ps(Node.MaxZ) };
+
+		__m128 TNear = _mm_set1_ps(InMinT);
+		__m128 TFar = _mm_set1_ps(InMaxT);
+		__m128 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (RayData.bIsParallel[Axis])
+			{
+				Inside = _mm_and_ps(Inside, _mm_and_ps(_mm_cmpge_ps(RayData.Origin[Axis], BoxMin[Axis]), _mm_cmple_ps(RayData.Origin[Axis], BoxMax[Axis])));
+				continue;
+			}
+
+			const __m128 T1 = _mm_mul_ps(_mm_sub_ps(BoxMin[Axis], RayData.Origin[Axis]), RayData.InverseDirection[Axis]);
+			const __m128 T2 = _mm_mul_ps(_mm_sub_ps(BoxMax[Axis], RayData.Origin[Axis]), RayData.InverseDirection[Axis]);
+			TNear = _mm_max_ps(TNear, _mm_min_ps(T1, T2));
+			TFar = _mm_min_ps(TFar, _mm_max_ps(T1, T2));
+		}
+
+		_mm_storeu_ps(OutEntryT, TNear);
+		return _mm_movemask_ps(_mm_and_ps(Inside, _mm_cmple_ps(TNear, TFar)));
+	}
+
+	/**
+	 * @brief 패킷의 삼각형 4개를 한 번에 검사 (IntersectRayTriangle과 같은 Cramer's rule)
+	 * [InMinT, InOutClosestT] 안의 교차가 있으면 InOutClosestT와 OutHit을 갱신한다
+	 */
+	void IntersectTrianglePacket(const FQBVHRayData& RayData, const FQBVHTrianglePacket& Packet, float InMinT, float& InOutClosestT, FBVHRayHit& OutHit)
+	{
+		const __m128 Zero = _mm_setzero_ps();
+		const __m128 One = _mm_set1_ps(1.0f);
+		const __m128 DeterminantEpsilon = _mm_set1_ps(0.0001f);
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+		const __m128 E1X = _mm_load_ps(Packet.E1X), E1Y = _mm_load_ps(Packet.E1Y), E1Z = _mm_load_ps(Packet.E1Z);
+		const __m128 E2X = _mm_load_ps(Packet.E2X), E2Y = _mm_load_ps(Packet.E2Y), E2Z = _mm_load_ps(Packet.E2Z);
+		const __m128 RX = _mm_sub_ps(RayData.Origin[0], _mm_load_ps(Packet.V0X));
+		const __m128 RY = _mm_sub_ps(RayData.Origin[1], _mm_load_ps(Packet.V0Y));
+		const __m128 RZ = _mm_sub_ps(RayData.Origin[2], _mm_load_ps(Packet.V0Z));
+		const __m128 DX = RayData.Direction[0], DY = RayData.Direction[1], DZ = RayData.Direction[2];
+
+		// CrossE2Ray = E2 x D
+		const __m128 CX = _mm_sub_ps(_mm_mul_ps(E2Y, DZ), _mm_mul_ps(E2Z, DY));
+		const __m128 CY = _mm_sub_ps(_mm_mul_ps(E2Z, DX), _mm_mul_ps(E2X, DZ));
+		const __m128 CZ = _mm_sub_ps(_mm_mul_ps(E2X, DY), _mm_mul_ps(E2Y, DX));
+		const __m128 Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E1X, CX), _mm_mul_ps(E1Y, CY)), _mm_mul_ps(E1Z, CZ));
+
+		// CrossE1Result = E1 x R
+		const __m128 QX = _mm_sub_ps(_mm_mul_ps(E1Y, RZ), _mm_mul_ps(E1Z, RY));
+		const __m128 QY = _mm_sub_ps(_mm_mul_ps(E1Z, RX), _mm_mul_ps(E1X, RZ));
+		const __m128 QZ = _mm_sub_ps(_mm_mul_ps(E1X, RY), _mm_mul_ps(E1Y, RX));
+
+		const __m128 V = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(RX, CX), _mm_mul_ps(RY, CY)), _mm_mul_ps(RZ, CZ)), Determinant);
+		const __m128 U = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, QX), _mm_mul_ps(DY, QY)), _mm_mul_ps(DZ, QZ)), Determinant);
+		const __m128 T = _mm_div_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(E2X, QX), _mm_mul_ps(E2Y, QY)), _mm_mul_ps(E2Z, QZ)), Determinant);
+
+		__m128 Valid = _mm_cmpgt_ps(_mm_and_ps(Determinant, AbsMask), DeterminantEpsilon);
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(V, Zero), _mm_cmple_ps(V, One)));
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(U, Zero), _mm_cmple_ps(_mm_add_ps(U, V), One)));
+		Valid = _mm_and_ps(Valid, _mm_and_ps(_mm_cmpge_ps(T, _mm_set1_ps(InMinT)), _mm_cmple_ps(T, _mm_set1_ps(InOutClosestT))));
+
+		const int32 HitMask = _mm_movemask_ps(Valid);
+		if (!HitMask) { return; }
+
+		alignas(16) float HitT[4];
+		_mm_store_ps(HitT, T);
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if ((HitMask & (1 << Lane)) && HitT[Lane] <= InOutClosestT)
+			{
+				InOutClosestT = HitT[Lane];
+				OutHit.T = HitT[Lane];
+				OutHit.TriangleIndex = Packet.TriangleIndices[Lane];
+			}
+		}
+	}
+
+	uint32 CountTriangles(const FQBVHTrianglePacket& Packet)
+	{
+		uint32 Count = 0;
+		for (int32 Lane = 0; Lane < 4; ++Lane) { Count += Packet.TriangleIndices[Lane] >= 0 ? 1 : 0; }
+		return Count;
+	}
+}
+
+
+void FQBVH::Clear()
+{
+	Mesh = nullptr;
+	Nodes.clear();
+	Packets.clear();
+}
+
+void FQBVH::Serialize(FArchive& Ar, FStaticMesh* InMesh)
+{
+	if (Ar.IsLoading())
+	{
+		Clear();
+		Mesh = InMesh;
+	}
+
+	Ar << Nodes;
+	Ar << Packets;
+}
+
+void FQBVH::Build(FStaticMesh* InMesh)
+{
+	Clear();
+	if (!InMesh || InMesh->BVH.GetRootIndex() < 0) { return; }
+	Mesh = InMesh;
+
+	const FBVH& BVH = InMesh->BVH;
+	const int32 BinaryNodeCount = BVH.GetNodeCount();
+
+	// 1. 이진 트리 노드마다 서브트리의 삼각형 수 계산 (자식은 항상 부모보다 뒤에 있으므로 역순으로 누적)
+	TArray<uint32> SubtreeTriangleCounts(BinaryNodeCount, 0);
+	for (int32 Index = BinaryNodeCount - 1; Index >= 0; --Index)
+	{
+		if (Index == FBVH::PADDING_NODE_INDEX) { continue; }
+
+		const FBVHCompactNode& Node = BVH.GetNode(Index);
+		SubtreeTriangleCounts[Index] = Node.IsLeaf()
+			? Node.TriangleCount
+			: SubtreeTriangleCounts[Node.Offset] + SubtreeTriangleCounts[Node.Offset + 1];
+	}
+
+	Nodes.reserve(BinaryNodeCount / 3 + 1);
+	Packets.reserve(SubtreeTriangleCounts[0] / 2 + 1);
+
+	// 2. 트리 전체가 패킷 하나에 들어가면 루트 노드 하나에 리프 하나
+	if (SubtreeTriangleCounts[0] <= PACKET_TRIANGLE_COUNT)
+	{
+		Nodes.emplace_back();
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			SetChild(0, Lane, FBVHCompactNode{ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX }, 0, 0 }, FQBVHNode::EMPTY_CHILD);
+		}
+		SetChild(0, 0, BVH.GetNode(0), ~CreatePacket(BVH, 0));
+		return;
+	}
+
+	CollapseNode(BVH, 0, SubtreeTriangleCounts);
+}
+
+int32 FQBVH::CollapseNode(const FBVH& InBVH, int32 BinaryIndex, const TArray<uint32>& InSubtreeTriangleCounts)
+{
+	// 1. 두 자식에서 시작해, 패킷으로 만들 수 없는 내부 노드 중 표면적이 가장 큰 것을 두 자식으로 펼치기를 반복
+	int32 Slots[4];
+	const FBVHCompactNode& BinaryNode = InBVH.GetNode(BinaryIndex);
+	Slots[0] = static_cast<int32>(BinaryNode.Offset);
+	Slots[1] = static_cast<int32>(BinaryNode.Offset) + 1;
+	int32 SlotCount = 2;
+
+	while (SlotCount < 4)
+	{
+		int32 BestSlot = -1;
+		float BestArea = -1.0f;
+		for (int32 Slot = 0; Slot < SlotCount; ++Slot)
+		{
+			const FBVHCompactNode& Candidate = InBVH.GetNode(Slots[Slot]);
+			if (Candidate.IsLeaf() || InSubtreeTriangleCounts[Slots[Slot]] <= PACKET_TRIANGLE_COUNT) { continue; }
+
+			const float Area = GetSurfaceArea(Candidate.Min, Candidate.Max);
+			if (Area > BestArea)
+			{
+				BestArea = Area;
+				BestSlot = Slot;
+			}
+		}
+		if (BestSlot < 0) { break; }
+
+		const int32 FirstChild = static_cast<int32>(InBVH.GetNode(Slots[BestSlot]).Offset);
+		Slots[BestSlot] = FirstChild;
+		Slots[SlotCount++] = FirstChild + 1;
+	}
+
+	// 2. 노드 인덱스를 먼저 확보한 뒤 자식 채우기 (재귀 중 Nodes가 재할당될 수 있으므로 인덱스로 접근)
+	const int32 NodeIndex = static_cast<int32>(Nodes.size());
+	Nodes.emplace_back();
+
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		if (Lane >= SlotCount)
+		{
+			SetChild(NodeIndex, Lane, FBVHCompactNode{ { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX }, 0, 0 }, FQBVHNode::EMPTY_CHILD);
+			continue;
+		}
+
+		const int32 SlotIndex = Slots[Lane];
+		const int32 Child = InSubtreeTriangleCounts[SlotIndex] <= PACKET_TRIANGLE_COUNT
+			? ~CreatePacket(InBVH, SlotIndex)
+			: CollapseNode(InBVH, SlotIndex, InSubtreeTriangleCounts);
+		SetChild(NodeIndex, Lane, InBVH.GetNode(SlotIndex), Child);
+	}
+
+	return NodeIndex;
+}
+
+int32 FQBVH::CreatePacket(const FBVH& InBVH, int32 BinaryIndex)
+{
+	FQBVHTrianglePacket Packet = {};
+	for (int32 Lane = 0; Lane < 4; ++Lane) { Packet.TriangleIndices[Lane] = -1; }
+
+	int32 Lane = 0;
+	TArray<int32> NodeStack;
+	NodeStack.push_back(BinaryIndex);
+	while (!NodeStack.empty())
+	{
+		const FBVHCompactNode& Node = InBVH.GetNode(NodeStack.back());
+		NodeStack.pop_back();
+
+		if (!Node.IsLeaf())
+		{
+			NodeStack.push_back(static_cast<int32>(Node.Offset) + 1);
+			NodeStack.push_back(static_cast<int32>(Node.Offset));
+			continue;
+		}
+
+		for (uint32 Triangle = 0; Triangle < Node.TriangleCount && Lane < 4; ++Triangle, ++Lane)
+		{
+			const uint32 BaseIndex = Node.Offset + Triangle * 3;
+			const FVector& V0 = Mesh->Vertices[Mesh->Indices[BaseIndex]].Position;
+			const FVector E1 = Mesh->Vertices[Mesh->Indices[BaseIndex + 1]].Position - V0;
+			const FVector E2 = Mesh->Vertices[Mesh->Indices[BaseIndex + 2]].Position - V0;
+
+			Packet.V0X[Lane] = V0.X; Packet.V0Y[Lane] = V0.Y; Packet.V0Z[Lane] = V0.Z;
+			Packet.E1X[Lane] = E1.X; Packet.E1Y[Lane] = E1.Y; Packet.E1Z[Lane] = E1.Z;
+			Packet.E2X[Lane] = E2.X; Packet.E2Y[Lane] = E2.Y; Packet.E2Z[Lane] = E2.Z;
+			Packet.TriangleIndices[Lane] = static_cast<int32>(BaseIndex / 3);
+		}
+	}
+
+	Packets.push_back(Packet);
+	return static_cast<int32>(Packets.size()) - 1;
+}
+
+void FQBVH::SetChild(int32 NodeIndex, int32 Lane, const FBVHCompactNode& InBounds, int32 InChild)
+{
+	FQBVHNode& Node = Nodes[NodeIndex];
+	Node.MinX[Lane] = InBounds.Min[0];
+	Node.MinY[Lane] = InBounds.Min[1];
+	Node.MinZ[Lane] = InBounds.Min[2];
+	Node.MaxX[Lane] = InBounds.Max[0];
+	Node.MaxY[Lane] = InBounds.Max[1];
+	Node.MaxZ[Lane] = InBounds.Max[2];
+	Node.Children[Lane] = InChild;
+}
+
+bool FQBVH::IntersectRayClosest(const FRay& Ray, float InMinT, float InMaxT, FBVHRayHit& OutHit, FBVHTraversalStats* OutStats) const
+{
+	OutHit = FBVHRayHit();
+	if (!Mesh || Nodes.empty() || InMinT > InMaxT)
+	{
+		return false;
+	}
+
+	FQBVHRayData RayData;
+	MakeRayData(Ray, RayData);
+
+	float ClosestT = InMaxT;
+	uint32 NodeVisitCount = 0;
+	uint32 TriangleTestCount = 0;
+
+	TArray<FQBVHStackEntry> NodeStack;
+	NodeStack.reserve(64);
+	NodeStack.push_back({ 0, InMinT });
+
+	while (!NodeStack.empty())
+	{
+		const FQBVHStackEntry Entry = NodeStack.back();
+		NodeStack.pop_back();
+
+		// 스택에 넣은 뒤 더 가까운 교차가 발견되었다면 건너뜀
+		if (Entry.EntryT > ClosestT) { continue; }
+
+		// 1. 리프: 패킷의 삼각형 4개를 한 번에 검사
+		if (Entry.Child < 0)
+		{
+			const FQBVHTrianglePacket& Packet = Packets[~Entry.Child];
+			TriangleTestCount += CountTriangles(Packet);
+			IntersectTrianglePacket(RayData, Packet, InMinT, ClosestT, OutHit);
+			continue;
+		}
+
+		// 2. 내부 노드: 네 자식 AABB를 한 번에 슬랩 테스트
+		const FQBVHNode& Node = Nodes[Entry.Child];
+		++NodeVisitCount;
+
+		float EntryT[4];
+		const int32 HitMask = IntersectChildren(RayData, Node, InMinT, ClosestT, EntryT);
+		if (!HitMask) { continue; }
+
+		// 3. 교차한 자식들을 진입 거리 내림차순으로 정렬해 가장 가까운 자식이 스택 맨 위에 오도록 push
+		FQBVHStackEntry Hits[4];
+		int32 HitCount = 0;
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (!(HitMask & (1 << Lane)) || Node.Children[Lane] == FQBVHNode::EMPTY_CHILD) { continue; }
+
+			FQBVHStackEntry Hit = { Node.Children[Lane], EntryT[Lane] };
+			int32 Insert = HitCount++;
+			while (Insert > 0 && Hits[Insert - 1].EntryT < Hit.EntryT)
+			{
+				Hits[Insert] = Hits[Insert - 1];
+				--Insert;
+			}
+			Hits[Insert] = Hit;
+		}
+
+		NodeStack.insert(NodeStack.end(), Hits, Hits + HitCount);
+	}
+
+	if (OutStats)
+	{
+		OutStats->NodeVisitCount += NodeVisitCount;
+		OutStats->TriangleTestCount += TriangleTestCount;
+	}
+
+	return OutHit.TriangleIndex >= 0;
+}
+
+uint32 FQBVH::IntersectRayPacketClosest(const FRay* Rays, const float* InMinT, const float* InMaxT, int32 RayCount, FBVHRayHit* OutHits, FBVHTraversalStats* OutStats) const
+{
+	RayCount = std::min(RayCount, MAX_RAY_PACKET_SIZE);
+
+	// 1. Ray마다 레지스터 데이터를 한 번만 준비하고, 유효 범위가 있는 Ray만 활성화
+	FQBVHRayData RayData[MAX_RAY_PACKET_SIZE];
+	float ClosestT[MAX_RAY_PACKET_SIZE];
+	uint32 ActiveMask = 0;
+	for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+	{
+		OutHits[RayIndex] = FBVHRayHit();
+		if (!Mesh || Nodes.empty() || InMinT[RayIndex] > InMaxT[RayIndex]) { continue; }
+
+		MakeRayData(Rays[RayIndex], RayData[RayIndex]);
+		ClosestT[RayIndex] = InMaxT[RayIndex];
+		ActiveMask |= 1u << RayIndex;
+	}
+	if (!ActiveMask) { return 0; }
+
+	uint32 NodeVisitCount = 0;
+	uint32 TriangleTestCount = 0;
+
+	TArray<FQBVHPacketStackEntry> NodeStack;
+	NodeStack.reserve(64);
+	NodeStack.push_back({ 0, ActiveMask });
+
+	while (!NodeStack.empty())
+	{
+		const FQBVHPacketStackEntry Entry = NodeStack.back();
+		NodeStack.pop_back();
+
+		// 2-A. 리프: 노드를 한 번 읽어 두고, 도달한 Ray마다 삼각형 4개를 검사
+		if (Entry.Child < 0)
+		{
+			const FQBVHTrianglePacket& Packet = Packets[~Entry.Child];
+			const uint32 PacketTriangleCount = CountTriangles(Packet);
+			for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+			{
+				if (!(Entry.RayMask & (1u << RayIndex))) { continue; }
+
+				TriangleTestCount += PacketTriangleCount;
+				IntersectTrianglePacket(RayData[RayIndex], Packet, InMinT[RayIndex], ClosestT[RayIndex], OutHits[RayIndex]);
+			}
+			continue;
+		}
+
+		// 2-B. 내부 노드: Ray마다 네 자식을 슬랩 테스트하여 자식별로 방문할 Ray 마스크를 모음
+		const FQBVHNode& Node = Nodes[Entry.Child];
+		++NodeVisitCount;
+
+		uint32 ChildRayMasks[4] = { 0, 0, 0, 0 };
+		float ChildEntryT[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+		for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+		{
+			if (!(Entry.RayMask & (1u << RayIndex))) { continue; }
+
+			float EntryT[4];
+			const int32 HitMask = IntersectChildren(RayData[RayIndex], Node, InMinT[RayIndex], ClosestT[RayIndex], EntryT);
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (!(HitMask & (1 << Lane))) { continue; }
+				ChildRayMasks[Lane] |= 1u << RayIndex;
+				ChildEntryT[Lane] = std::min(ChildEntryT[Lane], EntryT[Lane]);
+			}
+		}
+
+		// 3. 패킷 안 최소 진입 거리의 내림차순으로 push하여 가까운 자식부터 방문
+		FQBVHPacketStackEntry Hits[4];
+		float HitEntryT[4];
+		int32 HitCount = 0;
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			if (!ChildRayMasks[Lane] || Node.Children[Lane] == FQBVHNode::EMPTY_CHILD) { continue; }
+
+			int32 Insert = HitCount++;
+			while (Insert > 0 && HitEntryT[Insert - 1] < ChildEntryT[Lane])
+			{
+				Hits[Insert] = Hits[Insert - 1];
+				HitEntryT[Insert] = HitEntryT[Insert - 1];
+				--Insert;
+			}
+			Hits[Insert] = { Node.Children[Lane], ChildRayMasks[Lane] };
+			HitEntryT[Insert] = ChildEntryT[Lane];
+		}
+
+		NodeStack.insert(NodeStack.end(), Hits, Hits + HitCount);
+	}
+
+	if (OutStats)
+	{
+		OutStats->NodeVisitCount += NodeVisitCount;
+		OutStats->TriangleTestCount += TriangleTestCount;
+	}
+
+	uint32 HitRayMask = 0;
+	for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+	{
+		HitRayMask |= OutHits[RayIndex].TriangleIndex >= 0 ? 1u << RayIndex : 0u;
+	}
+	return HitRayMask;
+}
+
+void RunQBVHPickBenchmark(FStaticMesh* InMesh)
+{
+	constexpr int32 RAY_COUNT = 4096;
+
+	if (!InMesh || InMesh->BVH.GetRootIndex() < 0 || InMesh->QBVH.IsEmpty()) { return; }
+
+	TArray<FRay> Rays;
+	MakeBVHBenchmarkRays(InMesh->BVH.GetNodeBounds(InMesh->BVH.GetRootIndex()), RAY_COUNT, Rays);
+
+	auto Measure = [&Rays](const TFunction<bool(const FRay&, FBVHRayHit&, FBVHTraversalStats&)>& InQuery,
+		TArray<FBVHRayHit>& OutHits, FBVHTraversalStats& OutStats)
+	{
+		OutHits.resize(Rays.size());
+		return FBenchmark::MeasureOnce([&]()
+		{
+			for (size_t Index = 0; Index < Rays.size(); ++Index)
+			{
+				InQuery(Rays[Index], OutHits[Index], OutStats);
+			}
+		}) * 1000.0 / RAY_COUNT;
+	};
+
+	TArray<FBVHRayHit> BinaryHits, QuadHits;
+	FBVHTraversalStats BinaryStats, QuadStats;
+	const double BinaryMicroseconds = Measure([InMesh](const FRay& Ray, FBVHRayHit& OutHit, FBVHTraversalStats& OutStats)
+	{
+		return InMesh->BVH.IntersectRayClosest(Ray, 0.0f, FLT_MAX, OutHit, &OutStats);
+	}, BinaryHits, BinaryStats);
+	const double QuadMicroseconds = Measure([InMesh](const FRay& Ray, FBVHRayHit& OutHit, FBVHTraversalStats& OutStats)
+	{
+		return InMesh->QBVH.IntersectRayClosest(Ray, 0.0f, FLT_MAX, OutHit, &OutStats);
+	}, QuadHits, QuadStats);
+
+	// 같은 삼각형이거나 (공유 모서리 등으로) 거리가 같으면 일치로 간주
+	int32 MismatchCount = 0;
+	for (int32 Index = 0; Index < RAY_COUNT; ++Index)
+	{
+		if (BinaryHits[Index].TriangleIndex != QuadHits[Index].TriangleIndex &&
+			fabs(BinaryHits[Index].T - QuadHits[Index].T) > 1e-4f * max(1.0f, fabsf(BinaryHits[Index].T)))
+		{
+			++MismatchCount;
+		}
+	}
+
+	UE_LOG_INFO("QBVH Pick: %s (%zu triangles, %d rays)", InMesh->PathFileName.ToString().c_str(), InMesh->Indices.size() / 3, RAY_COUNT);
+	UE_LOG_INFO("  Binary BVH : %.2f us/pick, %.1f nodes/pick, %.1f triangle tests/pick",
+		BinaryMicroseconds, static_cast<double>(BinaryStats.NodeVisitCount) / RAY_COUNT, static_cast<double>(BinaryStats.TriangleTestCount) / RAY_COUNT);
+	UE_LOG_INFO("  QBVH (SSE) : %.2f us/pick, %.1f nodes/pick, %.1f triangle tests/pick (%d nodes, %d packets)",
+		QuadMicroseconds, static_cast<double>(QuadStats.NodeVisitCount) / RAY_COUNT, static_cast<double>(QuadStats.TriangleTestCount) / RAY_COUNT,
+		InMesh->QBVH.GetNodeCount(), InMesh->QBVH.GetPacketCount());
+	if (MismatchCount > 0)
+	{
+		UE_LOG_INFO("  closest hit mismatch: %d rays", MismatchCount);
+	}
+}
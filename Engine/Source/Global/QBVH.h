@@ -0,0 +1,107 @@
+#pragma once
+#include "Global/BVH.h"
+
+/**
+ * @brief 4-wide BVH 노드
+ * 네 자식의 AABB를 SoA로 보관하여 SSE 슬랩 테스트 한 번으로 네 자식을 동시에 검사한다
+ * Children[i] >= 0이면 내부 노드 인덱스, 음수이면 ~(삼각형 패킷 인덱스)인 리프, EMPTY_CHILD이면 빈 칸
+ */
+struct alignas(16) FQBVHNode
+{
+	static constexpr int32 EMPTY_CHILD = INT32_MIN;
+
+	float MinX[4];
+	float MinY[4];
+	float MinZ[4];
+	float MaxX[4];
+	float MaxY[4];
+	float MaxZ[4];
+	int32 Children[4];
+};
+
+/**
+ * @brief SoA로 묶인 삼각형 4개 (Ray-삼각형 교차를 SSE로 4개씩 검사)
+ * 꼭짓점 하나와 두 변을 미리 계산해 두며, 빈 칸은 변이 0이라 determinant 검사에서 항상 제외된다
+ */
+struct alignas(16) FQBVHTrianglePacket
+{
+	float V0X[4];
+	float V0Y[4];
+	float V0Z[4];
+	float E1X[4];
+	float E1Y[4];
+	float E1Z[4];
+	float E2X[4];
+	float E2Y[4];
+	float E2Z[4];
+	int32 TriangleIndices[4]; // 삼각형 번호 (빈 칸은 -1)
+};
+
+/**
+ * @brief 이진 FBVH를 접어서(collapse) 만든 4-ary BVH
+ * 피킹처럼 가장 가까운 교차 하나만 필요한 질의에 사용하며, 구축은 이진 BVH가 만들어진 뒤 한 번 수행한다
+ */
+class FQBVH
+{
+public:
+	// IntersectRayPacketClosest가 한 번에 처리하는 최대 Ray 수 (Ray 마스크 비트 수)
+	static constexpr int32 MAX_RAY_PACKET_SIZE = 32;
+
+	/**
+	 * @brief InMesh->BVH를 4-ary 트리로 접는다 (삼각형 4개 이하의 서브트리는 패킷 하나의 리프가 된다)
+	 */
+	void Build(FStaticMesh* InMesh);
+	void Clear();
+
+	/**
+	 * @brief 노드/패킷 배열을 저장/로드 (Cooked 메시 캐시용, 로드 시 InMesh를 원본 메시로 연결)
+	 */
+	void Serialize(FArchive& Ar, FStaticMesh* InMesh);
+
+	bool IsEmpty() const { return Nodes.empty(); }
+	int32 GetNodeCount() const { return static_cast<int32>(Nodes.size()); }
+	int32 GetPacketCount() const { return static_cast<int32>(Packets.size()); }
+
+	/**
+	 * @brief FBVH::IntersectRayClosest와 같은 판정으로 가장 가까운 삼각형 교차를 찾음
+	 * @param Ray: 교차 검사를 수행할 Ray (Local 좌표계)
+	 * @param InMinT, InMaxT: 유효한 교차로 인정할 Ray 파라미터 범위
+	 * @param OutHit: 가장 가까운 교차 (output)
+	 * @param OutStats: 방문한 노드/검사한 삼각형 수를 누적할 통계 (nullptr 가능)
+	 * @return: 범위 내 교차가 있으면 true
+	 */
+	bool IntersectRayClosest(const FRay& Ray, float InMinT, float InMaxT, FBVHRayHit& OutHit, FBVHTraversalStats* OutStats = nullptr) const;
+
+	/**
+	 * @brief Ray 패킷(최대 MAX_RAY_PACKET_SIZE개)을 트리 한 번의 순회로 검사하여 Ray마다 가장 가까운 교차를 찾음
+	 * 노드마다 아직 그 노드에 도달한 Ray들의 마스크를 들고 내려가므로, 한 노드와 패킷은 패킷당 한 번만 읽는다
+	 * @param Rays, InMinT, InMaxT: Ray와 Ray별 유효 파라미터 범위 (Local 좌표계, RayCount개)
+	 * @param OutHits: Ray별 가장 가까운 교차 (output, RayCount개)
+	 * @return 교차가 있는 Ray의 비트 마스크
+	 */
+	uint32 IntersectRayPacketClosest(const FRay* Rays, const float* InMinT, const float* InMaxT, int32 RayCount, FBVHRayHit* OutHits,
+		FBVHTraversalStats* OutStats = nullptr) const;
+
+private:
+	/**
+	 * @brief 이진 트리의 내부 노드 BinaryIndex 아래에서 표면적이 큰 내부 노드를 펼쳐 최대 4개의 자식을 모으고 4-ary 노드를 생성
+	 * @return 생성된 노드 인덱스
+	 */
+	int32 CollapseNode(const FBVH& InBVH, int32 BinaryIndex, const TArray<uint32>& InSubtreeTriangleCounts);
+
+	/**
+	 * @brief 이진 트리의 서브트리에 속한 삼각형(최대 4개)으로 패킷을 만들고 인덱스를 반환
+	 */
+	int32 CreatePacket(const FBVH& InBVH, int32 BinaryIndex);
+
+	void SetChild(int32 NodeIndex, int32 Lane, const FBVHCompactNode& InBounds, int32 InChild);
+
+	FStaticMesh* Mesh = nullptr;
+	TArray<FQBVHNode> Nodes;
+	TArray<FQBVHTrianglePacket> Packets;
+};
+
+/**
+* @brief 같은 Ray들로 이진 FBVH와 FQBVH의 IntersectRayClosest 시간과 방문 노드 수를 비교하여 로그로 출력
+*/
+void RunQBVHPickBenchmark(FStaticMesh* InMesh);
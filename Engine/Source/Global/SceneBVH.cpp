@@ -0,0 +1,525 @@
+#include "pch.h"
+#include "Global/SceneBVH.h"
+#include "Global/BVH.h"
+#include "Global/Octree.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Level/Public/Level.h"
+#include "Physics/Public/RayBoxIntersection.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	// 리프 하나가 가질 최대 프리미티브 수
+	constexpr int32 MAX_LEAF_PRIMITIVES = 4;
+	// Refit 후 트리 비용이 구축 직후의 이 배수를 넘으면 재구축
+	constexpr float REBUILD_COST_RATIO = 2.0f;
+
+	float GetAxis(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+
+	void SetNodeBounds(FSceneBVHNode& OutNode, const FVector& InMin, const FVector& InMax)
+	{
+		OutNode.Min[0] = InMin.X; OutNode.Min[1] = InMin.Y; OutNode.Min[2] = InMin.Z;
+		OutNode.Max[0] = InMax.X; OutNode.Max[1] = InMax.Y; OutNode.Max[2] = InMax.Z;
+	}
+}
+
+void FSceneBVH::Clear()
+{
+	Nodes.clear();
+	Primitives.clear();
+	PrimitiveMins.clear();
+	PrimitiveMaxs.clear();
+	Revisions.clear();
+	BuildCost = 0.0f;
+	bNeedsRebuild = true;
+}
+
+void FSceneBVH::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	Clear();
+	bNeedsRebuild = false;
+
+	// 1. 프리미티브마다 월드 AABB와 중심 계산
+	TArray<FBuildEntry> Entries;
+	Entries.reserve(InPrimitives.size());
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Primitive) { continue; }
+
+		FBuildEntry Entry;
+		Primitive->GetWorldAABB(Entry.Min, Entry.Max);
+		Entry.Centroid = (Entry.Min + Entry.Max) * 0.5f;
+		Entry.Primitive = Primitive;
+		Entries.push_back(Entry);
+	}
+	if (Entries.empty()) { return; }
+
+	// 2. Top-down 분할 (리프 순서대로 Entries가 재배치된다)
+	Nodes.reserve(Entries.size() * 2);
+	Nodes.emplace_back();
+	BuildRange(Entries, 0, static_cast<int32>(Entries.size()), 0);
+
+	// 3. 리프 순서대로 프리미티브 정보를 보관
+	const size_t PrimitiveCount = Entries.size();
+	Primitives.resize(PrimitiveCount);
+	PrimitiveMins.resize(PrimitiveCount);
+	PrimitiveMaxs.resize(PrimitiveCount);
+	Revisions.resize(PrimitiveCount);
+	for (size_t Index = 0; Index < PrimitiveCount; ++Index)
+	{
+		Primitives[Index] = Entries[Index].Primitive;
+		PrimitiveMins[Index] = Entries[Index].Min;
+		PrimitiveMaxs[Index] = Entries[Index].Max;
+		Revisions[Index] = Entries[Index].Primitive->GetBoundsRevision();
+	}
+
+	BuildCost = CalculateCost();
+}
+
+void FSceneBVH::BuildRange(TArray<FBuildEntry>& Entries, int32 Begin, int32 End, int32 NodeIndex)
+{
+	FVector Min(FLT_MAX, FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX), CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (int32 Index = Begin; Index < End; ++Index)
+	{
+		GrowBounds(Min, Max, Entries[Index].Min, Entries[Index].Max);
+		GrowBounds(CentroidMin, CentroidMax, Entries[Index].Centroid, Entries[Index].Centroid);
+	}
+	SetNodeBounds(Nodes[NodeIndex], Min, Max);
+
+	if (End - Begin <= MAX_LEAF_PRIMITIVES)
+	{
+		Nodes[NodeIndex].Offset = static_cast<uint32>(Begin);
+		Nodes[NodeIndex].PrimitiveCount = static_cast<uint32>(End - Begin);
+		return;
+	}
+
+	// 중심점 범위가 가장 긴 축의 중앙값으로 분할
+	const FVector CentroidExtent = CentroidMax - CentroidMin;
+	int32 Axis = 0;
+	if (CentroidExtent.Y > GetAxis(CentroidExtent, Axis)) { Axis = 1; }
+	if (CentroidExtent.Z > GetAxis(CentroidExtent, Axis)) { Axis = 2; }
+
+	const int32 Mid = Begin + (End - Begin) / 2;
+	std::nth_element(Entries.begin() + Begin, Entries.begin() + Mid, Entries.begin() + End,
+		[Axis](const FBuildEntry& A, const FBuildEntry& B) { return GetAxis(A.Centroid, Axis) < GetAxis(B.Centroid, Axis); });
+
+	// 자식 한 쌍을 연속으로 할당 (재귀 중 Nodes가 재할당될 수 있으므로 인덱스로 접근)
+	const int32 FirstChildIndex = static_cast<int32>(Nodes.size());
+	Nodes.resize(Nodes.size() + 2);
+	Nodes[NodeIndex].Offset = static_cast<uint32>(FirstChildIndex);
+	Nodes[NodeIndex].PrimitiveCount = 0;
+
+	BuildRange(Entries, Begin, Mid, FirstChildIndex);
+	BuildRange(Entries, Mid, End, FirstChildIndex + 1);
+}
+
+bool FSceneBVH::Refit()
+{
+	bool bIsChanged = false;
+	for (size_t Index = 0; Index < Primitives.size(); ++Index)
+	{
+		const uint64 Revision = Primitives[Index]->GetBoundsRevision();
+		if (Revision == Revisions[Index]) { continue; }
+
+		Primitives[Index]->GetWorldAABB(PrimitiveMins[Index], PrimitiveMaxs[Index]);
+		Revisions[Index] = Revision;
+		bIsChanged = true;
+	}
+
+	if (!bIsChanged) { return false; }
+
+	RefitNodes();
+
+	// 많이 움직여 트리 품질이 떨어졌다면 다음 질의 전에 재구축
+	if (CalculateCost() > BuildCost * REBUILD_COST_RATIO)
+	{
+		bNeedsRebuild = true;
+	}
+	return true;
+}
+
+void FSceneBVH::RefitNodes()
+{
+	// 자식은 항상 부모보다 뒤에 있으므로 역순으로 한 번 훑으면 된다
+	for (int32 Index = static_cast<int32>(Nodes.size()) - 1; Index >= 0; --Index)
+	{
+		FSceneBVHNode& Node = Nodes[Index];
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		if (Node.IsLeaf())
+		{
+			for (uint32 Primitive = Node.Offset; Primitive < Node.Offset + Node.PrimitiveCount; ++Primitive)
+			{
+				GrowBounds(Min, Max, PrimitiveMins[Primitive], PrimitiveMaxs[Primitive]);
+			}
+		}
+		else
+		{
+			for (uint32 Child = Node.Offset; Child < Node.Offset + 2; ++Child)
+			{
+				const FSceneBVHNode& ChildNode = Nodes[Child];
+				GrowBounds(Min, Max, FVector(ChildNode.Min[0], ChildNode.Min[1], ChildNode.Min[2]), FVector(ChildNode.Max[0], ChildNode.Max[1], ChildNode.Max[2]));
+			}
+		}
+		SetNodeBounds(Node, Min, Max);
+	}
+}
+
+float FSceneBVH::CalculateCost() const
+{
+	float Cost = 0.0f;
+	for (const FSceneBVHNode& Node : Nodes) { Cost += GetSurfaceArea(Node.Min, Node.Max); }
+	return Cost;
+}
+
+FAABB FSceneBVH::GetBoundingBox() const
+{
+	if (Nodes.empty()) { return FAABB(); }
+	return FAABB(FVector(Nodes[0].Min[0], Nodes[0].Min[1], Nodes[0].Min[2]), FVector(Nodes[0].Max[0], Nodes[0].Max[1], Nodes[0].Max[2]));
+}
+
+bool FSceneBVH::IntersectRayClosest(const FRay& WorldRay, const FInstanceHitTest& InHitTest, FSceneRayHit& OutHit, FSceneRayQueryStats* OutStats) const
+{
+	OutHit = FSceneRayHit();
+	if (Nodes.empty()) { return false; }
+
+	const FRayTraversalData RayData = MakeRayTraversalData(WorldRay);
+	uint32 NodeVisitCount = 0;
+	uint32 InstanceTestCount = 0;
+
+	// (노드, 진입 거리) 스택. 가까운 자식을 나중에 넣어 먼저 꺼낸다
+	TArray<std::pair<int32, float>> NodeStack;
+	NodeStack.reserve(64);
+
+	float RootEntryT;
+	if (GetRayBoxEntry(RayData, Nodes[0].Min, Nodes[0].Max, 0.0f, FLT_MAX, RootEntryT))
+	{
+		NodeStack.push_back({ 0, RootEntryT });
+	}
+
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, EntryT] = NodeStack.back();
+		NodeStack.pop_back();
+
+		// 스택에 넣은 뒤 더 가까운 교차가 발견되었다면 건너뜀
+		if (EntryT > OutHit.Distance) { continue; }
+
+		const FSceneBVHNode& Node = Nodes[NodeIndex];
+		++NodeVisitCount;
+
+		if (Node.IsLeaf())
+		{
+			// 리프의 인스턴스들도 각자의 AABB 진입 거리 순으로 검사
+			std::pair<float, uint32> Instances[MAX_LEAF_PRIMITIVES];
+			int32 InstanceCount = 0;
+			for (uint32 Primitive = Node.Offset; Primitive < Node.Offset + Node.PrimitiveCount; ++Primitive)
+			{
+				float InstanceEntryT;
+				if (GetRayBoxEntry(RayData, PrimitiveMins[Primitive], PrimitiveMaxs[Primitive], 0.0f, OutHit.Distance, InstanceEntryT))
+				{
+					Instances[InstanceCount++] = { InstanceEntryT, Primitive };
+				}
+			}
+			std::sort(Instances, Instances + InstanceCount);
+
+			for (int32 Index = 0; Index < InstanceCount; ++Index)
+			{
+				if (Instances[Index].first > OutHit.Distance) { break; }
+
+				++InstanceTestCount;
+				float Distance = FLT_MAX;
+				UPrimitiveComponent* Primitive = Primitives[Instances[Index].second];
+				if (InHitTest(Primitive, Distance) && Distance < OutHit.Distance)
+				{
+					OutHit.Distance = Distance;
+					OutHit.Primitive = Primitive;
+				}
+			}
+			continue;
+		}
+
+		const int32 Child1 = static_cast<int32>(Node.Offset);
+		const int32 Child2 = Child1 + 1;
+		float Child1EntryT, Child2EntryT;
+		const bool bHitChild1 = GetRayBoxEntry(RayData, Nodes[Child1].Min, Nodes[Child1].Max, 0.0f, OutHit.Distance, Child1EntryT);
+		const bool bHitChild2 = GetRayBoxEntry(RayData, Nodes[Child2].Min, Nodes[Child2].Max, 0.0f, OutHit.Distance, Child2EntryT);
+
+		if (bHitChild1 && bHitChild2)
+		{
+			if (Child1EntryT <= Child2EntryT)
+			{
+				NodeStack.push_back({ Child2, Child2EntryT });
+				NodeStack.push_back({ Child1, Child1EntryT });
+			}
+			else
+			{
+				NodeStack.push_back({ Child1, Child1EntryT });
+				NodeStack.push_back({ Child2, Child2EntryT });
+			}
+		}
+		else if (bHitChild1)
+		{
+			NodeStack.push_back({ Child1, Child1EntryT });
+		}
+		else if (bHitChild2)
+		{
+			NodeStack.push_back({ Child2, Child2EntryT });
+		}
+	}
+
+	if (OutStats)
+	{
+		OutStats->NodeVisitCount += NodeVisitCount;
+		OutStats->InstanceTestCount += InstanceTestCount;
+	}
+
+	return OutHit.Primitive != nullptr;
+}
+
+uint32 FSceneBVH::IntersectRayPacketClosest(const FRay* WorldRays, int32 RayCount, const FInstancePacketHitTest& InHitTest, FSceneRayHit* OutHits,
+	FSceneRayQueryStats* OutStats) const
+{
+	RayCount = std::min(RayCount, MAX_RAY_PACKET_SIZE);
+	for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex) { OutHits[RayIndex] = FSceneRayHit(); }
+	if (Nodes.empty() || RayCount <= 0) { return 0; }
+
+	// Ray별 순회 정보와 현재 최단 거리 (InHitTest가 직접 갱신)
+	FRayTraversalData RayData[MAX_RAY_PACKET_SIZE];
+	float ClosestDistances[MAX_RAY_PACKET_SIZE];
+	const uint32 AllRayMask = RayCount == 32 ? ~0u : (1u << RayCount) - 1;
+	for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+	{
+		RayData[RayIndex] = MakeRayTraversalData(WorldRays[RayIndex]);
+		ClosestDistances[RayIndex] = FLT_MAX;
+	}
+
+	uint32 NodeVisitCount = 0;
+	uint32 InstanceTestCount = 0;
+
+	// 주어진 AABB에 현재 최단 거리 안에서 도달하는 Ray 마스크와 그 중 최소 진입 거리
+	auto IntersectBox = [&](uint32 InRayMask, const float BoxMin[3], const float BoxMax[3], float& OutMinEntryT)
+	{
+		uint32 HitMask = 0;
+		OutMinEntryT = FLT_MAX;
+		for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+		{
+			float EntryT;
+			if ((InRayMask & (1u << RayIndex)) && GetRayBoxEntry(RayData[RayIndex], BoxMin, BoxMax, 0.0f, ClosestDistances[RayIndex], EntryT))
+			{
+				HitMask |= 1u << RayIndex;
+				OutMinEntryT = min(OutMinEntryT, EntryT);
+			}
+		}
+		return HitMask;
+	};
+
+	// (노드, 그 노드에 도달한 Ray 마스크) 스택. 패킷 최소 진입 거리가 가까운 자식을 나중에 넣어 먼저 꺼낸다
+	TArray<std::pair<int32, uint32>> NodeStack;
+	NodeStack.reserve(64);
+
+	float RootEntryT;
+	if (const uint32 RootMask = IntersectBox(AllRayMask, Nodes[0].Min, Nodes[0].Max, RootEntryT))
+	{
+		NodeStack.push_back({ 0, RootMask });
+	}
+
+	while (!NodeStack.empty())
+	{
+		const auto [NodeIndex, NodeRayMask] = NodeStack.back();
+		NodeStack.pop_back();
+
+		const FSceneBVHNode& Node = Nodes[NodeIndex];
+		++NodeVisitCount;
+
+		if (Node.IsLeaf())
+		{
+			for (uint32 Primitive = Node.Offset; Primitive < Node.Offset + Node.PrimitiveCount; ++Primitive)
+			{
+				const float PrimitiveMin[3] = { PrimitiveMins[Primitive].X, PrimitiveMins[Primitive].Y, PrimitiveMins[Primitive].Z };
+				const float PrimitiveMax[3] = { PrimitiveMaxs[Primitive].X, PrimitiveMaxs[Primitive].Y, PrimitiveMaxs[Primitive].Z };
+				float InstanceEntryT;
+				const uint32 InstanceRayMask = IntersectBox(NodeRayMask, PrimitiveMin, PrimitiveMax, InstanceEntryT);
+				if (!InstanceRayMask) { continue; }
+
+				for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex) { InstanceTestCount += (InstanceRayMask >> RayIndex) & 1u; }
+
+				const uint32 HitRayMask = InHitTest(Primitives[Primitive], WorldRays, InstanceRayMask, ClosestDistances) & InstanceRayMask;
+				for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+				{
+					if (!(HitRayMask & (1u << RayIndex))) { continue; }
+					OutHits[RayIndex].Primitive = Primitives[Primitive];
+					OutHits[RayIndex].Distance = ClosestDistances[RayIndex];
+				}
+			}
+			continue;
+		}
+
+		const int32 Child1 = static_cast<int32>(Node.Offset);
+		const int32 Child2 = Child1 + 1;
+		float Child1EntryT, Child2EntryT;
+		const uint32 Child1Mask = IntersectBox(NodeRayMask, Nodes[Child1].Min, Nodes[Child1].Max, Child1EntryT);
+		const uint32 Child2Mask = IntersectBox(NodeRayMask, Nodes[Child2].Min, Nodes[Child2].Max, Child2EntryT);
+
+		if (Child1Mask && Child2Mask)
+		{
+			if (Child1EntryT <= Child2EntryT)
+			{
+				NodeStack.push_back({ Child2, Child2Mask });
+				NodeStack.push_back({ Child1, Child1Mask });
+			}
+			else
+			{
+				NodeStack.push_back({ Child1, Child1Mask });
+				NodeStack.push_back({ Child2, Child2Mask });
+			}
+		}
+		else if (Child1Mask)
+		{
+			NodeStack.push_back({ Child1, Child1Mask });
+		}
+		else if (Child2Mask)
+		{
+			NodeStack.push_back({ Child2, Child2Mask });
+		}
+	}
+
+	if (OutStats)
+	{
+		OutStats->NodeVisitCount += NodeVisitCount;
+		OutStats->InstanceTestCount += InstanceTestCount;
+	}
+
+	uint32 HitRayMask = 0;
+	for (int32 RayIndex = 0; RayIndex < RayCount; ++RayIndex)
+	{
+		HitRayMask |= OutHits[RayIndex].Primitive ? 1u << RayIndex : 0u;
+	}
+	return HitRayMask;
+}
+
+void FSceneBVH::IntersectRaysClosest(const TArray<FRay>& WorldRays, const FInstancePacketHitTest& InHitTest, TArray<FSceneRayHit>& OutHits,
+	FSceneRayQueryStats* OutStats) const
+{
+	OutHits.resize(WorldRays.size());
+	for (size_t Begin = 0; Begin < WorldRays.size(); Begin += MAX_RAY_PACKET_SIZE)
+	{
+		const int32 RayCount = static_cast<int32>(std::min(WorldRays.size() - Begin, static_cast<size_t>(MAX_RAY_PACKET_SIZE)));
+		IntersectRayPacketClosest(WorldRays.data() + Begin, RayCount, InHitTest, OutHits.data() + Begin, OutStats);
+	}
+}
+
+void FSceneBVH::GatherRayInstances(const FRay& WorldRay, TArray<std::pair<float, UPrimitiveComponent*>>& OutInstances) const
+{
+	OutInstances.clear();
+	if (Nodes.empty()) { return; }
+
+	const FRayTraversalData RayData = MakeRayTraversalData(WorldRay);
+	TArray<int32> NodeStack;
+	NodeStack.reserve(64);
+	NodeStack.push_back(0);
+
+	while (!NodeStack.empty())
+	{
+		const FSceneBVHNode& Node = Nodes[NodeStack.back()];
+		NodeStack.pop_back();
+
+		float EntryT;
+		if (!GetRayBoxEntry(RayData, Node.Min, Node.Max, 0.0f, FLT_MAX, EntryT)) { continue; }
+
+		if (!Node.IsLeaf())
+		{
+			NodeStack.push_back(static_cast<int32>(Node.Offset) + 1);
+			NodeStack.push_back(static_cast<int32>(Node.Offset));
+			continue;
+		}
+
+		for (uint32 Primitive = Node.Offset; Primitive < Node.Offset + Node.PrimitiveCount; ++Primitive)
+		{
+			if (GetRayBoxEntry(RayData, PrimitiveMins[Primitive], PrimitiveMaxs[Primitive], 0.0f, FLT_MAX, EntryT))
+			{
+				OutInstances.push_back({ EntryT, Primitives[Primitive] });
+			}
+		}
+	}
+
+	std::sort(OutInstances.begin(), OutInstances.end(),
+		[](const std::pair<float, UPrimitiveComponent*>& A, const std::pair<float, UPrimitiveComponent*>& B) { return A.first < B.first; });
+}
+
+void RunSceneBVHBenchmark(ULevel* InLevel)
+{
+	constexpr int32 RAY_COUNT = 4096;
+
+	if (!InLevel || !InLevel->GetStaticOctree()) { return; }
+
+	TArray<UPrimitiveComponent*> Primitives;
+	InLevel->GetStaticOctree()->GetAllPrimitives(Primitives);
+	const TArray<UPrimitiveComponent*>& DynamicPrimitives = InLevel->GetDynamicPrimitives();
+	Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+	if (Primitives.empty()) { return; }
+
+	// 1. 구축 / 변경 없는 Refit 시간
+	FSceneBVH SceneBVH;
+	const double BuildMs = FBenchmark::MeasureOnce([&]() { SceneBVH.Build(Primitives); });
+	const double RefitMs = FBenchmark::MeasureOnce([&]() { SceneBVH.Refit(); });
+
+	TArray<FRay> Rays;
+	MakeBVHBenchmarkRays(SceneBVH.GetBoundingBox(), RAY_COUNT, Rays);
+
+	// 인스턴스 정밀 검사 대신 월드 AABB 진입 거리를 교차 거리로 사용
+	auto HitTestBounds = [](UPrimitiveComponent* Primitive, const FRay& WorldRay, float& OutDistance)
+	{
+		FVector Min, Max;
+		Primitive->GetWorldAABB(Min, Max);
+		return GetRayBoxEntry(MakeRayTraversalData(WorldRay), Min, Max, 0.0f, FLT_MAX, OutDistance);
+	};
+
+	// 2. 기존 방식: 옥트리 후보 + Dynamic 목록 전체를 순서 없이 모두 검사
+	uint64 CandidateTestCount = 0;
+	uint32 CandidateHitCount = 0;
+	const double CandidateMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays)
+		{
+			TArray<UPrimitiveComponent*> Candidates;
+			InLevel->GetStaticOctree()->FindRayCandidates(Ray, Candidates);
+			Candidates.insert(Candidates.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+
+			float ClosestDistance = FLT_MAX;
+			for (UPrimitiveComponent* Primitive : Candidates)
+			{
+				++CandidateTestCount;
+				float Distance;
+				if (HitTestBounds(Primitive, Ray, Distance)) { ClosestDistance = min(ClosestDistance, Distance); }
+			}
+			CandidateHitCount += ClosestDistance < FLT_MAX ? 1 : 0;
+		}
+	});
+
+	// 3. 씬 BVH: 진입 거리 순 방문 + 최단 거리 early-out
+	FSceneRayQueryStats Stats;
+	uint32 SceneHitCount = 0;
+	const double SceneMs = FBenchmark::MeasureOnce([&]()
+	{
+		for (const FRay& Ray : Rays)
+		{
+			FSceneRayHit Hit;
+			SceneHitCount += SceneBVH.IntersectRayClosest(Ray, [&Ray, &HitTestBounds](UPrimitiveComponent* Primitive, float& OutDistance)
+			{
+				return HitTestBounds(Primitive, Ray, OutDistance);
+			}, Hit, &Stats) ? 1 : 0;
+		}
+	});
+
+	UE_LOG_INFO("Scene BVH: %zu primitives (%zu dynamic), %d nodes, build %.2f ms, refit(no change) %.3f ms",
+		Primitives.size(), DynamicPrimitives.size(), SceneBVH.GetNodeCount(), BuildMs, RefitMs);
+	UE_LOG_INFO("  Octree + dynamic list : %.1f instance tests/ray, %.4f ms/ray, hits %u",
+		static_cast<double>(CandidateTestCount) / RAY_COUNT, CandidateMs / RAY_COUNT, CandidateHitCount);
+	UE_LOG_INFO("  Scene BVH (ordered)   : %.1f instance tests/ray, %.1f nodes/ray, %.4f ms/ray, hits %u",
+		static_cast<double>(Stats.InstanceTestCount) / RAY_COUNT, static_cast<double>(Stats.NodeVisitCount) / RAY_COUNT,
+		SceneMs / RAY_COUNT, SceneHitCount);
+}
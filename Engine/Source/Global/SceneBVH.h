@@ -0,0 +1,134 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+class UPrimitiveComponent;
+class ULevel;
+struct FRay;
+
+/**
+ * @brief 씬 BVH 노드 (FBVHCompactNode와 같은 32 bytes 레이아웃, 두 자식은 인접한 칸에 저장)
+ */
+struct alignas(32) FSceneBVHNode
+{
+	float Min[3];
+	float Max[3];
+	// 내부 노드: 첫 번째 자식 인덱스 (두 번째 자식은 Offset + 1) / 리프: 첫 프리미티브의 위치
+	uint32 Offset;
+	// 리프가 가진 프리미티브 수 (0이면 내부 노드)
+	uint32 PrimitiveCount;
+
+	bool IsLeaf() const { return PrimitiveCount != 0; }
+};
+static_assert(sizeof(FSceneBVHNode) == 32, "FSceneBVHNode must be 32 bytes");
+
+// FSceneBVH::IntersectRayClosest의 결과
+struct FSceneRayHit
+{
+	UPrimitiveComponent* Primitive = nullptr;
+	float Distance = FLT_MAX;	// 월드 Ray 원점으로부터의 거리
+};
+
+// 씬 Ray 질의 비용 측정용 통계
+struct FSceneRayQueryStats
+{
+	uint32 NodeVisitCount = 0;
+	uint32 InstanceTestCount = 0;
+};
+
+/**
+ * @brief 프리미티브의 월드 AABB 위에 구성하는 씬 단위 BVH (Top-level acceleration structure)
+ * 인스턴스(프리미티브)의 정밀 검사는 호출자가 넘긴 함수로 수행하며, 메시의 FBVH/FQBVH가 Bottom-level 역할을 한다
+ * 프리미티브 추가/삭제 시 MarkDirty로 재구축을 예약하고, Transform 변경은 BoundsRevision을 비교해 Refit으로 반영한다
+ */
+class FSceneBVH
+{
+public:
+	/**
+	 * @brief 인스턴스 정밀 검사 함수: 교차하면 월드 Ray 원점으로부터의 거리를 OutDistance에 쓰고 true 반환
+	 */
+	using FInstanceHitTest = TFunction<bool(UPrimitiveComponent*, float&)>;
+
+	// IntersectRayPacketClosest가 한 번에 처리하는 최대 Ray 수 (Ray 마스크 비트 수)
+	static constexpr int32 MAX_RAY_PACKET_SIZE = 32;
+
+	/**
+	 * @brief 인스턴스 패킷 검사 함수: RayMask에 속한 Ray들을 한 번에 검사한다
+	 * InOutDistances[i]에는 Ray i의 현재 최단 거리가 들어 있으며, 더 가까운 교차를 찾은 Ray만 값을 줄이고 그 비트를 반환한다
+	 */
+	using FInstancePacketHitTest = TFunction<uint32(UPrimitiveComponent*, const FRay* WorldRays, uint32 RayMask, float* InOutDistances)>;
+
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives);
+	void Clear();
+
+	/**
+	 * @brief BoundsRevision이 바뀐 프리미티브의 월드 AABB를 다시 읽고 조상 노드 AABB를 갱신
+	 * @note Refit이 누적되어 트리 비용(표면적 합)이 구축 직후의 REBUILD_COST_RATIO배를 넘으면 재구축을 예약한다
+	 * @return 갱신된 프리미티브가 있으면 true
+	 */
+	bool Refit();
+
+	void MarkDirty() { bNeedsRebuild = true; }
+	bool NeedsRebuild() const { return bNeedsRebuild; }
+
+	/**
+	 * @brief 월드 AABB와 교차하는 인스턴스를 진입 거리가 가까운 순서로 방문하며 InHitTest로 검사하고 가장 가까운 교차를 반환
+	 * 진입 거리가 현재 최단 교차보다 먼 인스턴스와 서브트리는 검사하지 않는다 (월드 Ray 방향은 정규화되어 있어야 함)
+	 */
+	bool IntersectRayClosest(const FRay& WorldRay, const FInstanceHitTest& InHitTest, FSceneRayHit& OutHit, FSceneRayQueryStats* OutStats = nullptr) const;
+
+	/**
+	 * @brief Ray 패킷(최대 MAX_RAY_PACKET_SIZE개)을 트리 한 번의 순회로 검사하여 Ray마다 가장 가까운 교차를 반환
+	 * 노드마다 도달한 Ray 마스크를 들고 내려가며, 인스턴스는 패킷당 한 번 InHitTest로 검사한다
+	 * @return 교차가 있는 Ray의 비트 마스크
+	 */
+	uint32 IntersectRayPacketClosest(const FRay* WorldRays, int32 RayCount, const FInstancePacketHitTest& InHitTest, FSceneRayHit* OutHits,
+		FSceneRayQueryStats* OutStats = nullptr) const;
+
+	/**
+	 * @brief WorldRays를 MAX_RAY_PACKET_SIZE개씩 나누어 IntersectRayPacketClosest로 검사 (OutHits는 WorldRays와 같은 순서)
+	 */
+	void IntersectRaysClosest(const TArray<FRay>& WorldRays, const FInstancePacketHitTest& InHitTest, TArray<FSceneRayHit>& OutHits,
+		FSceneRayQueryStats* OutStats = nullptr) const;
+
+	/**
+	 * @brief 월드 AABB와 교차하는 인스턴스를 (진입 거리, 프리미티브) 쌍으로 모아 진입 거리 오름차순으로 정렬
+	 */
+	void GatherRayInstances(const FRay& WorldRay, TArray<std::pair<float, UPrimitiveComponent*>>& OutInstances) const;
+
+	int32 GetNodeCount() const { return static_cast<int32>(Nodes.size()); }
+	int32 GetPrimitiveCount() const { return static_cast<int32>(Primitives.size()); }
+	FAABB GetBoundingBox() const;
+
+private:
+	struct FBuildEntry
+	{
+		FVector Min;
+		FVector Max;
+		FVector Centroid;
+		UPrimitiveComponent* Primitive;
+	};
+
+	/**
+	 * @brief Entries[Begin, End)로 NodeIndex를 루트로 하는 서브트리를 구축
+	 * 구간을 중심점 범위가 가장 긴 축의 중앙값으로 나누며, 자식 한 쌍은 배열 끝에 연속으로 추가된다
+	 */
+	void BuildRange(TArray<FBuildEntry>& Entries, int32 Begin, int32 End, int32 NodeIndex);
+	void RefitNodes();
+	float CalculateCost() const;
+
+	TArray<FSceneBVHNode> Nodes;
+	// 리프 순서로 정렬된 프리미티브와, 마지막으로 읽은 월드 AABB/BoundsRevision
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<FVector> PrimitiveMins;
+	TArray<FVector> PrimitiveMaxs;
+	TArray<uint64> Revisions;
+
+	float BuildCost = 0.0f;
+	bool bNeedsRebuild = true;
+};
+
+/**
+ * @brief 레벨 경계를 향하는 임의의 Ray들로 기존 후보 수집(옥트리 + Dynamic 목록 전체)과 FSceneBVH의 순서 있는 질의를
+ * 인스턴스 검사 수와 시간으로 비교하여 로그로 출력 (인스턴스 검사는 월드 AABB 진입 거리로 대신함)
+ */
+void RunSceneBVHBenchmark(ULevel* InLevel);
@@ -43,3 +43,28 @@ using uint32 = std::uint32_t;
 using int32 = std::int32_t;
 using uint64 = std::uint64_t;
 using int64 = std::int64_t;
+
+/**
+ * @brief 연속 메모리에 있는 T 배열을 소유하지 않고 읽기 전용으로 가리키는 뷰 (TArray, 메모리 매핑된 파일 등)
+ * @note 가리키는 메모리의 수명은 뷰를 만든 쪽이 보장해야 한다
+ */
+template<typename T>
+class TConstArrayView
+{
+public:
+	TConstArrayView() = default;
+	TConstArrayView(const T* InData, size_t InNum) : Data(InData), Num(InNum) {}
+	TConstArrayView(const TArray<T>& InArray) : Data(InArray.data()), Num(InArray.size()) {}
+
+	const T* data() const { return Data; }
+	size_t size() const { return Num; }
+	bool empty() const { return Num == 0; }
+
+	const T& operator[](size_t Index) const { return Data[Index]; }
+	const T* begin() const { return Data; }
+	const T* end() const { return Data + Num; }
+
+private:
+	const T* Data = nullptr;
+	size_t Num = 0;
+};
@@ -12,6 +12,7 @@
 #include "Utility/Public/JsonSerializer.h"
 #include "Utility/Public/ActorTypeMapper.h"
 #include "Global/Octree.h"
+#include "Global/SceneBVH.h"
 #include <json.hpp>
 
 IMPLEMENT_CLASS(ULevel, UObject)
@@ -19,12 +20,14 @@ IMPLEMENT_CLASS(ULevel, UObject)
 ULevel::ULevel()
 {
 	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	SceneBVH = new FSceneBVH();
 }
 
 ULevel::ULevel(const FName& InName)
 	: UObject(InName)
 {
 	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	SceneBVH = new FSceneBVH();
 }
 
 ULevel::~ULevel()
@@ -38,6 +41,8 @@ ULevel::~ULevel()
 
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
+	SafeDelete(SceneBVH);
+	for (UPrimitiveComponent* Primitive : DynamicPrimitives) { Primitive->DynamicPrimitiveIndex = -1; }
 	DynamicPrimitives.clear();
 }
 
@@ -74,6 +79,14 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				AActor* NewActor = SpawnActorToLevel(NewClass, IdString, &ActorDataJson); 
 			}
 		}
+
+#ifdef _DEBUG
+		// 로드한 프리미티브로 소유 노드 기록을 잃은 프리미티브의 이동/제거를 검사
+		TArray<UPrimitiveComponent*> Primitives;
+		StaticOctree->GetAllPrimitives(Primitives);
+		const bool bIsOwnerCheckPassed = RunOctreeOwnerCheck(Primitives, StaticOctree->GetBoundingBox());
+		assert(bIsOwnerCheckPassed && "Octree owner check failed");
+#endif
 	}
 
 	// 저장
@@ -145,13 +158,10 @@ void ULevel::RegisterPrimitiveComponent(UPrimitiveComponent* InComponent)
 	// StaticOctree에 먼저 삽입 시도
 	if (StaticOctree->Insert(InComponent) == false)
 	{
-		// 실패하면 DynamicPrimitives 목록에 추가
-		// 중복 추가를 방지하기 위해 이미 있는지 확인
-		if (std::find(DynamicPrimitives.begin(), DynamicPrimitives.end(), InComponent) == DynamicPrimitives.end())
-		{
-			DynamicPrimitives.push_back(InComponent);
-		}
+		// 실패하면 DynamicPrimitives 목록에 추가 (이미 있으면 무시)
+		AddDynamicPrimitive(InComponent);
 	}
+	SceneBVH->MarkDirty();
 
 	UE_LOG("Level: '%s' 컴포넌트를 씬에 등록했습니다.", InComponent->GetName().ToString().data());
 }
@@ -165,13 +175,10 @@ void ULevel::UnregisterPrimitiveComponent(UPrimitiveComponent* InComponent)
 	// StaticOctree에서 제거 시도
 	if (StaticOctree->Remove(InComponent) == false)
 	{
-		// 실패하면 DynamicPrimitives 목록에서 찾아서 제거
-		if (auto It = std::find(DynamicPrimitives.begin(), DynamicPrimitives.end(), InComponent); It != DynamicPrimitives.end())
-		{
-			*It = std::move(DynamicPrimitives.back());
-			DynamicPrimitives.pop_back();
-		}
+		// 실패하면 DynamicPrimitives 목록에서 제거
+		RemoveDynamicPrimitive(InComponent);
 	}
+	SceneBVH->MarkDirty();
 }
 
 void ULevel::AddLevelPrimitiveComponent(AActor* Actor)
@@ -185,9 +192,10 @@ void ULevel::AddLevelPrimitiveComponent(AActor* Actor)
 
 		if (StaticOctree->Insert(PrimitiveComponent) == false)
 		{
-			DynamicPrimitives.push_back(PrimitiveComponent);
+			AddDynamicPrimitive(PrimitiveComponent);
 		}
 	}
+	SceneBVH->MarkDirty();
 }
 
 // Level에서 Actor 제거하는 함수
@@ -205,15 +213,13 @@ bool ULevel::DestroyActor(AActor* InActor)
 		{
 			if (!StaticOctree->Remove(PrimitiveComponent))
 			{
-				if (auto It = std::find(DynamicPrimitives.begin(), DynamicPrimitives.end(), PrimitiveComponent); It != DynamicPrimitives.end())
-				{
-					*It = std::move(DynamicPrimitives.back());
-					DynamicPrimitives.pop_back();
-				}
+				RemoveDynamicPrimitive(PrimitiveComponent);
 			}
 		}
 	}
 
+	if (SceneBVH) { SceneBVH->MarkDirty(); }
+
 	// LevelActors 리스트에서 제거
 	if (auto It = std::find(LevelActors.begin(), LevelActors.end(), InActor); It != LevelActors.end())
 	{
@@ -239,22 +245,81 @@ void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* Primitive)
 {
 	if (!Primitive) { return; }
 
-	// 1. StaticOctree에서 제거 먼저 시도
-	if (StaticOctree->Remove(Primitive))
+	FVector WorldMin, WorldMax;
+	Primitive->GetWorldAABB(WorldMin, WorldMax);
+
+	// 1. 옥트리 안에서 위치 갱신 (새 경계가 소유 노드에 맞으면 이동 없음)
+	if (StaticOctree->Update(Primitive, FAABB(WorldMin, WorldMax)))
 	{
-		// 2. DynamicPrimitives로 등록
-		DynamicPrimitives.push_back(Primitive);
+		// 2. 옥트리 영역 밖에 있다가 다시 들어온 경우 Dynamic 목록에서 제거 (목록에 없었다면 인덱스 확인만으로 끝난다)
+		RemoveDynamicPrimitive(Primitive);
 	}
 	else
 	{
-		// 3. Static에 없으면 그냥 Dynamic에 넣어줌 (중복 방지 체크 필요)
-		if (std::find(DynamicPrimitives.begin(), DynamicPrimitives.end(), Primitive) == DynamicPrimitives.end())
+		// 3. 옥트리 영역을 벗어났다면 Dynamic에 넣어줌 (중복 방지)
+		AddDynamicPrimitive(Primitive);
+	}
+}
+
+void ULevel::AddDynamicPrimitive(UPrimitiveComponent* InComponent)
+{
+	if (InComponent->DynamicPrimitiveIndex >= 0) { return; }
+
+	InComponent->DynamicPrimitiveIndex = static_cast<int32>(DynamicPrimitives.size());
+	DynamicPrimitives.push_back(InComponent);
+}
+
+bool ULevel::RemoveDynamicPrimitive(UPrimitiveComponent* InComponent)
+{
+	const int32 Index = InComponent->DynamicPrimitiveIndex;
+	if (Index < 0 || Index >= static_cast<int32>(DynamicPrimitives.size()) || DynamicPrimitives[Index] != InComponent) { return false; }
+
+	// 마지막 요소를 빈 자리로 옮긴 뒤 삭제
+	UPrimitiveComponent* LastPrimitive = DynamicPrimitives.back();
+	DynamicPrimitives[Index] = LastPrimitive;
+	LastPrimitive->DynamicPrimitiveIndex = Index;
+	DynamicPrimitives.pop_back();
+
+	InComponent->DynamicPrimitiveIndex = -1;
+	return true;
+}
+
+void ULevel::CompactStaticOctree()
+{
+	if (StaticOctree) { StaticOctree->Compact(); }
+}
+
+void ULevel::RebuildStaticOctree(float InLooseness)
+{
+	if (!StaticOctree) { return; }
+
+	TArray<UPrimitiveComponent*> Primitives;
+	StaticOctree->GetAllPrimitives(Primitives);
+	const FAABB BoundingBox = StaticOctree->GetBoundingBox();
+	SafeDelete(StaticOctree);
+
+	StaticOctree = new FOctree(BoundingBox, 0, InLooseness);
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (StaticOctree->Insert(Primitive) == false)
 		{
-			DynamicPrimitives.push_back(Primitive);
+			AddDynamicPrimitive(Primitive);
 		}
 	}
 }
 
+FSceneBVH* ULevel::GetSceneBVH()
+{
+	if (SceneBVH->NeedsRebuild() || (SceneBVH->Refit() && SceneBVH->NeedsRebuild()))
+	{
+		TArray<UPrimitiveComponent*> Primitives;
+		StaticOctree->GetAllPrimitives(Primitives);
+		Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+		SceneBVH->Build(Primitives);
+	}
+	return SceneBVH;
+}
+
 UObject* ULevel::Duplicate()
 {
 	ULevel* Level = Cast<ULevel>(Super::Duplicate());
@@ -267,6 +332,12 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 	Super::DuplicateSubObjects(DuplicatedObject);
 	ULevel* DuplicatedLevel = Cast<ULevel>(DuplicatedObject);
 
+	// 옥트리 설정(Looseness)을 유지한 채로 액터를 등록
+	if (StaticOctree && StaticOctree->GetLooseness() != DuplicatedLevel->StaticOctree->GetLooseness())
+	{
+		DuplicatedLevel->RebuildStaticOctree(StaticOctree->GetLooseness());
+	}
+
 	for (AActor* Actor : LevelActors)
 	{
 		AActor* DuplicatedActor = Cast<AActor>(Actor->Duplicate());
@@ -92,6 +92,9 @@ void UWorld::Tick(float DeltaTimes)
 			}
 		}
 	}
+
+	// 이번 프레임의 이동/삭제로 미뤄둔 옥트리 병합 처리
+	Level->CompactStaticOctree();
 }
 
 TObjectPtr<ULevel> UWorld::GetLevel() const
@@ -107,6 +110,8 @@ TObjectPtr<ULevel> UWorld::GetLevel() const
 */
 bool UWorld::LoadLevel(path InLevelFilePath)
 {
+	ALLOCATION_TAG(Level)
+
 	JSON LevelJson;
 	ULevel* NewLevel = nullptr;
 
@@ -183,6 +188,8 @@ bool UWorld::SaveCurrentLevel(path InLevelFilePath) const
 
 AActor* UWorld::SpawnActor(UClass* InActorClass, const FName& InName, JSON* ActorJsonData)
 {
+	ALLOCATION_TAG(Level)
+
 	if (!Level)
 	{
 		UE_LOG_ERROR("World: Actor를 Spawn할 수 있는 Level이 없습니다.");
@@ -289,6 +296,8 @@ void UWorld::DuplicateSubObjects(UObject* DuplicatedObject)
 
 void UWorld::CreateNewLevel(const FName& InLevelName)
 {
+	ALLOCATION_TAG(Level)
+
 	TObjectPtr<ULevel> NewLevel = TObjectPtr(new ULevel(InLevelName));
 	NewLevel->SetOuter(this);
 	SwitchToLevel(NewLevel);
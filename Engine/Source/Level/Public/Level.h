@@ -12,6 +12,7 @@ class UWorld;
 class AActor;
 class UPrimitiveComponent;
 class FOctree;
+class FSceneBVH;
 
 /**
  * @brief Level Show Flag Enum
@@ -59,10 +60,27 @@ public:
 	uint64 GetShowFlags() const { return ShowFlags; }
 	void SetShowFlags(uint64 InShowFlags) { ShowFlags = InShowFlags; }
 
+	/**
+	 * @brief 움직인 프리미티브의 옥트리 위치를 갱신하고, 옥트리 영역을 벗어났다면 DynamicPrimitives로 옮긴다
+	 */
 	void UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent);
+	// 프레임 동안 미뤄둔 옥트리 노드 병합을 수행
+	void CompactStaticOctree();
+
+	/**
+	 * @brief 같은 영역과 주어진 Looseness로 StaticOctree를 새로 만들고 기존 프리미티브를 다시 삽입
+	 * 삽입되지 못한 프리미티브는 DynamicPrimitives로 옮긴다
+	 */
+	void RebuildStaticOctree(float InLooseness);
 
 	FOctree* GetStaticOctree() { return StaticOctree; }
-	TArray<UPrimitiveComponent*>& GetDynamicPrimitives() { return DynamicPrimitives; }
+	const TArray<UPrimitiveComponent*>& GetDynamicPrimitives() const { return DynamicPrimitives; }
+
+	/**
+	 * @brief 피킹용 씬 BVH를 최신 상태로 만들어 반환
+	 * 프리미티브 구성이 바뀌었으면 옥트리와 DynamicPrimitives 전체로 재구축하고, 아니면 움직인 프리미티브만 Refit한다
+	 */
+	FSceneBVH* GetSceneBVH();
 
 	friend class UWorld;
 public:
@@ -74,9 +92,14 @@ protected:
 private:
 	AActor* SpawnActorToLevel(UClass* InActorClass, const FName& InName = FName::None, JSON* ActorJsonData = nullptr);
 
+	// 프리미티브가 기억하는 DynamicPrimitiveIndex로 중복 검사와 제거를 O(1)로 처리
+	void AddDynamicPrimitive(UPrimitiveComponent* InComponent);
+	bool RemoveDynamicPrimitive(UPrimitiveComponent* InComponent);
+
 	TArray<TObjectPtr<AActor>> LevelActors;	// 레벨이 보유하고 있는 모든 Actor를 배열로 저장합니다.
 	FOctree* StaticOctree = nullptr;
 	TArray<UPrimitiveComponent*> DynamicPrimitives;
+	FSceneBVH* SceneBVH = nullptr;
 
 	// 지연 삭제를 위한 리스트
 	TArray<AActor*> ActorsToDelete;
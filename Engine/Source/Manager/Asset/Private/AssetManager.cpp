@@ -18,6 +18,8 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
+	ALLOCATION_TAG(Asset)
+
 	URenderer& Renderer = URenderer::GetInstance();
 
 	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
@@ -98,7 +100,7 @@ void UAssetManager::Initialize()
 		if (!Mesh || !Mesh->IsValid())
 			continue;
 
-		const auto& Vertices = Mesh->GetVertices();
+		const TConstArrayView<FNormalVertex> Vertices = Mesh->GetVertices();
 		if (Vertices.empty())
 			continue;
 
@@ -160,6 +162,8 @@ void UAssetManager::Release()
  */
 void UAssetManager::LoadAllObjStaticMesh()
 {
+	ALLOCATION_TAG(Asset)
+
 	URenderer& Renderer = URenderer::GetInstance();
 
 	TArray<FName> ObjList;
@@ -189,6 +193,9 @@ void UAssetManager::LoadAllObjStaticMesh()
 	Config.bUVToUEBasis = true;
 	Config.bPositionToUEBasis = true;
 
+	// 파일별 Import/Cook 로드는 Worker 스레드에서 병렬로 수행하고, UStaticMesh와 GPU 버퍼 생성은 아래에서 순서대로 처리
+	FObjManager::LoadObjStaticMeshAssets(ObjList, Config);
+
 	// 범위 기반 for문을 사용하여 배열의 모든 요소를 순회합니다.
 	for (const FName& ObjPath : ObjList)
 	{
@@ -222,19 +229,20 @@ ID3D11Buffer* UAssetManager::GetIndexBuffer(FName InObjPath)
 	}
 }
 
-ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices)
+ID3D11Buffer* UAssetManager::CreateVertexBuffer(TConstArrayView<FNormalVertex> InVertices)
 {
 	return URenderer::GetInstance().CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
 }
 
-ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
+ID3D11Buffer* UAssetManager::CreateIndexBuffer(TConstArrayView<uint32> InIndices)
 {
 	return URenderer::GetInstance().CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
 }
 
-TArray<FNormalVertex>* UAssetManager::GetVertexData(EPrimitiveType InType)
+TConstArrayView<FNormalVertex> UAssetManager::GetVertexData(EPrimitiveType InType)
 {
-	return VertexDatas[InType];
+	const TArray<FNormalVertex>* VertexData = VertexDatas[InType];
+	return VertexData ? TConstArrayView<FNormalVertex>(*VertexData) : TConstArrayView<FNormalVertex>();
 }
 
 ID3D11Buffer* UAssetManager::GetVertexbuffer(EPrimitiveType InType)
@@ -247,9 +255,10 @@ uint32 UAssetManager::GetNumVertices(EPrimitiveType InType)
 	return NumVertices[InType];
 }
 
-TArray<uint32>* UAssetManager::GetIndexData(EPrimitiveType InType)
+TConstArrayView<uint32> UAssetManager::GetIndexData(EPrimitiveType InType)
 {
-	return IndexDatas[InType];
+	const TArray<uint32>* IndexData = IndexDatas[InType];
+	return IndexData ? TConstArrayView<uint32>(*IndexData) : TConstArrayView<uint32>();
 }
 
 ID3D11Buffer* UAssetManager::GetIndexbuffer(EPrimitiveType InType)
@@ -322,6 +331,8 @@ void UAssetManager::AddStaticMeshToCache(const FName& InObjPath, UStaticMesh* In
  */
 ComPtr<ID3D11ShaderResourceView> UAssetManager::LoadTexture(const FName& InFilePath, const FName& InName)
 {
+	ALLOCATION_TAG(Asset)
+
 	// 이미 로드된 텍스처가 있는지 확인
 	auto Iter = TextureCache.find(InFilePath);
 	if (Iter != TextureCache.end())
@@ -341,6 +352,8 @@ ComPtr<ID3D11ShaderResourceView> UAssetManager::LoadTexture(const FName& InFileP
 
 UTexture* UAssetManager::CreateTexture(const FName& InFilePath, const FName& InName)
 {
+	ALLOCATION_TAG(Asset)
+
 	auto SRV = LoadTexture(InFilePath);
 	if (!SRV)	return nullptr;
 
@@ -602,7 +615,7 @@ ID3D11ShaderResourceView* UAssetManager::CreateTextureFromMemory(const void* InD
  * @param vertices 정점 데이터 배열
  * @return 계산된 FAABB 객체
  */
-FAABB UAssetManager::CalculateAABB(const TArray<FNormalVertex>& Vertices)
+FAABB UAssetManager::CalculateAABB(TConstArrayView<FNormalVertex> Vertices)
 {
 	FVector MinPoint(+FLT_MAX, +FLT_MAX, +FLT_MAX);
 	FVector MaxPoint(-FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -1,68 +1,172 @@
 #include "pch.h"
 
-#include "Core/Public/WindowsBinReader.h"
-#include "Core/Public/WindowsBinWriter.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 
-bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
+#include "Utility/Public/TaskScheduler.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <atomic>
+#include <charconv>
+
+namespace
 {
-	if (!OutObjInfo)
+	// 이보다 작은 구간으로는 나누지 않는다 (작은 파일은 한 스레드에서 파싱)
+	constexpr size_t MIN_PARSE_CHUNK_SIZE = 1 << 20;
+
+	// FromList를 ToList 뒤에 이어 붙인다 (ToList가 비어 있으면 이동)
+	template <typename T>
+	void AppendList(TArray<T>& ToList, TArray<T>& FromList)
 	{
-		return false;
+		if (ToList.empty())
+		{
+			ToList = std::move(FromList);
+		}
+		else
+		{
+			ToList.insert(ToList.end(), std::make_move_iterator(FromList.begin()), std::make_move_iterator(FromList.end()));
+		}
 	}
 
-	if (!std::filesystem::exists(FilePath))
+	// From의 면/그룹/머티리얼을 To 뒤에 이어 붙인다 (From의 그룹/머티리얼 시작 면 인덱스는 FaceOffset만큼 보정)
+	void AppendObjectInfo(FObjectInfo& To, FObjectInfo& From, size_t FaceOffset)
 	{
-		UE_LOG_ERROR("파일을 찾지 못했습니다: %s", FilePath.string().c_str());
-		return false;
+		AppendList(To.VertexIndexList, From.VertexIndexList);
+		AppendList(To.NormalIndexList, From.NormalIndexList);
+		AppendList(To.TexCoordIndexList, From.TexCoordIndexList);
+
+		for (size_t& FaceIndex : From.GroupIndexList) { FaceIndex += FaceOffset; }
+		AppendList(To.GroupNameList, From.GroupNameList);
+		AppendList(To.GroupIndexList, From.GroupIndexList);
+
+		for (size_t& FaceIndex : From.MaterialIndexList) { FaceIndex += FaceOffset; }
+		AppendList(To.MaterialNameList, From.MaterialNameList);
+		AppendList(To.MaterialIndexList, From.MaterialIndexList);
 	}
 
-	std::filesystem::path BinFilePath = FilePath;
-	BinFilePath.replace_extension(".objbin");
+	bool ReadFileText(const std::filesystem::path& FilePath, FString& OutText)
+	{
+		std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+		if (!File) { return false; }
+
+		const std::streamsize FileSize = File.tellg();
+		if (FileSize < 0) { return false; }
+
+		OutText.resize(static_cast<size_t>(FileSize));
+		File.seekg(0, std::ios::beg);
+		return static_cast<bool>(File.read(OutText.data(), FileSize));
+	}
 
-	if (Config.bIsBinaryEnabled && std::filesystem::exists(BinFilePath))
+	/**
+	 * @brief 한 줄 안에서 공백으로 구분된 토큰과 숫자를 차례로 읽는 커서 (istringstream 대체, 할당 없음)
+	 * 공백 판정과 실패 조건은 istringstream의 operator>>와 같게 맞춘다
+	 */
+	struct FObjLineCursor
 	{
-		auto ObjTime = std::filesystem::last_write_time(FilePath);
-		auto BinTime = std::filesystem::last_write_time(BinFilePath);
+		const char* Current;
+		const char* End;
 
-		if (BinTime >= ObjTime)
+		static bool IsSpace(char C)
 		{
-			UE_LOG("바이너리 파일이 존재합니다: %s", BinFilePath.string().c_str());
-			FWindowsBinReader WindowsBinReader(BinFilePath);
-			WindowsBinReader << *OutObjInfo;
+			return C == ' ' || C == '\t' || C == '\r' || C == '\v' || C == '\f' || C == '\n';
+		}
 
-			return true;
+		void SkipSpaces()
+		{
+			while (Current < End && IsSpace(*Current)) { ++Current; }
 		}
-		else
+
+		// 다음 토큰 (없으면 빈 문자열)
+		std::string_view NextToken()
 		{
-			UE_LOG("바이너리 파일이 원본보다 오래되었습니다. 무시합니다: %s", BinFilePath.string().c_str());
+			SkipSpaces();
+			const char* Begin = Current;
+			while (Current < End && !IsSpace(*Current)) { ++Current; }
+			return std::string_view(Begin, static_cast<size_t>(Current - Begin));
 		}
-	}
 
-	if (FilePath.extension() != ".obj")
-	{
-		UE_LOG_ERROR("잘못된 파일 확장자입니다: %s", FilePath.string().c_str());
-		return false;
-	}
+		bool NextFloat(float& OutValue)
+		{
+			SkipSpaces();
+			const char* Begin = Current;
+			// std::from_chars는 '+' 부호를 받지 않으므로 직접 건너뛴다
+			if (Begin < End && *Begin == '+') { ++Begin; }
 
-	std::ifstream File(FilePath);
-	if (!File)
+			const std::from_chars_result Result = std::from_chars(Begin, End, OutValue);
+			if (Result.ec != std::errc())
+			{
+				return false;
+			}
+			Current = Result.ptr;
+			return true;
+		}
+	};
+
+	/**
+	 * @brief 면 인덱스 문자열을 0-based 인덱스로 변환 (std::stoull과 같이 앞의 숫자만 사용)
+	 * @note 음수(상대) 인덱스는 지원하지 않는다
+	 */
+	bool ParseFaceIndex(std::string_view Text, size_t& OutIndex)
 	{
-		UE_LOG_ERROR("파일을 열지 못했습니다: %s", FilePath.string().c_str());
-		return false;
+		const char* Begin = Text.data();
+		const char* End = Text.data() + Text.size();
+		if (Begin < End && *Begin == '+') { ++Begin; }
+
+		unsigned long long Value = 0;
+		const std::from_chars_result Result = std::from_chars(Begin, End, Value);
+		if (Result.ec != std::errc())
+		{
+			return false;
+		}
+
+		OutIndex = static_cast<size_t>(Value) - 1;
+		return true;
 	}
+}
 
+/**
+ * @brief 파일의 한 구간을 독립적으로 파싱한 결과
+ * 구간이 시작될 때 열려 있는 오브젝트는 알 수 없으므로, 첫 'o' 이전의 면/그룹/머티리얼은 Head에 모아 두었다가 병합할 때 앞 구간의 오브젝트에 이어 붙인다
+ * 그룹/머티리얼의 시작 면 인덱스는 각 오브젝트가 이 구간 안에서 센 값이다
+ */
+struct FObjImporter::FObjChunk
+{
+	TArray<FVector> VertexList;
+	TArray<FVector> NormalList;
+	TArray<FVector2> TexCoordList;
+
+	FObjectInfo Head;
+	size_t HeadFaceCount = 0;
+	bool bIsHeadUsed = false;
+
+	// 구간 안에서 'o'로 시작한 오브젝트들과, 마지막 오브젝트가 이 구간에서 가진 면 수
+	TArray<FObjectInfo> Objects;
+	size_t LastFaceCount = 0;
+
+	TArray<std::filesystem::path> MaterialFilePaths;
+};
+
+bool FObjImporter::ParseChunk(const std::filesystem::path& FilePath, const char* ChunkBegin, const char* ChunkEnd, const Configuration& Config, FObjChunk& OutChunk)
+{
 	size_t FaceCount = 0;
 
-	TOptional<FObjectInfo> OptObjectInfo;
+	// 현재 면을 받는 오브젝트 (첫 'o' 이전에는 Head)
+	FObjectInfo* CurrentObject = nullptr;
 
-	FString Buffer;
-	while (std::getline(File, Buffer))
+	TArray<std::string_view> FaceBuffers;
+	const char* LineBegin = ChunkBegin;
+	const char* const TextEnd = ChunkEnd;
+	while (LineBegin < TextEnd)
 	{
-		std::istringstream Tokenizer(Buffer);
-		FString Prefix;
+		const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', static_cast<size_t>(TextEnd - LineBegin)));
+		if (!LineEnd)
+		{
+			LineEnd = TextEnd;
+		}
 
-		Tokenizer >> Prefix;
+		FObjLineCursor Tokenizer = { LineBegin, LineEnd };
+		LineBegin = LineEnd + 1;
+
+		const std::string_view Prefix = Tokenizer.NextToken();
 
 		// ========================== Vertex Information ============================ //
 
@@ -70,7 +174,7 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		if (Prefix == "v")
 		{
 			FVector Position;
-			if (!(Tokenizer >> Position.X >> Position.Y >> Position.Z))
+			if (!Tokenizer.NextFloat(Position.X) || !Tokenizer.NextFloat(Position.Y) || !Tokenizer.NextFloat(Position.Z))
 			{
 				UE_LOG_ERROR("정점 위치 형식이 잘못되었습니다");
 				return false;
@@ -78,11 +182,11 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 
 			if (Config.bPositionToUEBasis)
 			{
-				OutObjInfo->VertexList.emplace_back(PositionToUEBasis(Position));
+				OutChunk.VertexList.emplace_back(PositionToUEBasis(Position));
 			}
 			else
 			{
-				OutObjInfo->VertexList.emplace_back(Position);
+				OutChunk.VertexList.emplace_back(Position);
 			}
 
 		}
@@ -90,20 +194,20 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		else if (Prefix == "vn")
 		{
 			FVector Normal;
-			if (!(Tokenizer >> Normal.X >> Normal.Y >> Normal.Z))
+			if (!Tokenizer.NextFloat(Normal.X) || !Tokenizer.NextFloat(Normal.Y) || !Tokenizer.NextFloat(Normal.Z))
 			{
 				UE_LOG_ERROR("정점 법선 형식이 잘못되었습니다");
 				return false;
 			}
 
-			OutObjInfo->NormalList.emplace_back(Normal);
+			OutChunk.NormalList.emplace_back(Normal);
 		}
 		/** Texture Coordinate */
 		else if (Prefix == "vt")
 		{
 			/** @note: Ignore 3D Texture */
 			FVector2 TexCoord;
-			if (!(Tokenizer >> TexCoord.X >> TexCoord.Y))
+			if (!Tokenizer.NextFloat(TexCoord.X) || !Tokenizer.NextFloat(TexCoord.Y))
 			{
 				UE_LOG_ERROR("정점 텍스쳐 좌표 형식이 잘못되었습니다");
 				return false;
@@ -111,11 +215,11 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 
 			if (Config.bUVToUEBasis)
 			{
-				OutObjInfo->TexCoordList.emplace_back(UVToUEBasis(TexCoord));
+				OutChunk.TexCoordList.emplace_back(UVToUEBasis(TexCoord));
 			}
 			else
 			{
-				OutObjInfo->TexCoordList.emplace_back(TexCoord);
+				OutChunk.TexCoordList.emplace_back(TexCoord);
 			}
 		}
 
@@ -129,19 +233,19 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 				continue; // Ignore 'o' prefix
 			}
 
-			if (OptObjectInfo)
+			const std::string_view ObjectName = Tokenizer.NextToken();
+			if (ObjectName.empty())
 			{
-				OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+				UE_LOG_ERROR("오브젝트 이름 형식이 잘못되었습니다");
+				return false;
 			}
 
-			FString ObjectName;
-			if (!(Tokenizer >> ObjectName))
+			if (CurrentObject == &OutChunk.Head)
 			{
-				UE_LOG_ERROR("오브젝트 이름 형식이 잘못되었습니다");
-				return false;
+				OutChunk.HeadFaceCount = FaceCount;
 			}
-			OptObjectInfo.emplace();
-			OptObjectInfo->Name = std::move(ObjectName);
+			CurrentObject = &OutChunk.Objects.emplace_back();
+			CurrentObject->Name = FString(ObjectName);
 
 			FaceCount = 0;
 		}
@@ -149,21 +253,21 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		/** Group Information */
 		else if (Prefix == "g")
 		{
-			if (!OptObjectInfo)
+			if (!CurrentObject)
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				CurrentObject = &OutChunk.Head;
+				OutChunk.bIsHeadUsed = true;
 			}
 
-			FString GroupName;
-			if (!(Tokenizer >> GroupName))
+			const std::string_view GroupName = Tokenizer.NextToken();
+			if (GroupName.empty())
 			{
 				UE_LOG_ERROR("잘못된 그룹 이름 형식입니다");
 				return false;
 			}
 
-			OptObjectInfo->GroupNameList.emplace_back(std::move(GroupName));
-			OptObjectInfo->GroupIndexList.emplace_back(FaceCount);
+			CurrentObject->GroupNameList.emplace_back(GroupName);
+			CurrentObject->GroupIndexList.emplace_back(FaceCount);
 		}
 
 		// ============================ Face Information ============================ //
@@ -171,15 +275,14 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		/** Face Information */
 		else if (Prefix == "f")
 		{
-			if (!OptObjectInfo)
+			if (!CurrentObject)
 			{
-				OptObjectInfo.emplace();
-				OptObjectInfo->Name = Config.DefaultName;
+				CurrentObject = &OutChunk.Head;
+				OutChunk.bIsHeadUsed = true;
 			}
 
-			TArray<FString> FaceBuffers;
-			FString FaceBuffer;
-			while (Tokenizer >> FaceBuffer)
+			FaceBuffers.clear();
+			for (std::string_view FaceBuffer = Tokenizer.NextToken(); !FaceBuffer.empty(); FaceBuffer = Tokenizer.NextToken())
 			{
 				FaceBuffers.emplace_back(FaceBuffer);
 			}
@@ -195,19 +298,19 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 			{
 				if (Config.bFlipWindingOrder)
 				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[0], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
 					}
 
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[i + 1], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
 					}
 
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[i], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
@@ -215,19 +318,19 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 				}
 				else
 				{
-					if (!ParseFaceBuffer(FaceBuffers[0], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[0], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
 					}
 
-					if (!ParseFaceBuffer(FaceBuffers[i], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[i], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
 					}
 
-					if (!ParseFaceBuffer(FaceBuffers[i + 1], &(*OptObjectInfo)))
+					if (!ParseFaceBuffer(FaceBuffers[i + 1], CurrentObject))
 					{
 						UE_LOG_ERROR("면 파싱에 실패했습니다");
 						return false;
@@ -243,13 +346,113 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		{
 			/** @todo: Parse material data */
 			/** @todo: Support relative path from .obj file to find .mtl file */
-			FString MaterialFileName;
-			Tokenizer >> MaterialFileName;
+			const std::string_view MaterialFileName = Tokenizer.NextToken();
 
 			std::filesystem::path MaterialFilePath = FilePath.parent_path() / MaterialFileName;
 
-			MaterialFilePath = std::filesystem::weakly_canonical(MaterialFilePath);
+			// 머티리얼 목록의 순서를 지키기 위해 실제 로드는 병합할 때 파일 순서대로 수행
+			OutChunk.MaterialFilePaths.emplace_back(std::filesystem::weakly_canonical(MaterialFilePath));
+		}
+
+		else if (Prefix == "usemtl")
+		{
+			const std::string_view MaterialName = Tokenizer.NextToken();
+
+			if (!CurrentObject)
+			{
+				CurrentObject = &OutChunk.Head;
+				OutChunk.bIsHeadUsed = true;
+			}
+
+			CurrentObject->MaterialNameList.emplace_back(MaterialName);
+			CurrentObject->MaterialIndexList.emplace_back(FaceCount);
+		}
+	}
+
+	if (CurrentObject == &OutChunk.Head)
+	{
+		OutChunk.HeadFaceCount = FaceCount;
+	}
+	else if (CurrentObject)
+	{
+		OutChunk.LastFaceCount = FaceCount;
+	}
+
+	return true;
+}
+
+bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo, Configuration Config)
+{
+	if (!OutObjInfo)
+	{
+		return false;
+	}
+
+	if (!std::filesystem::exists(FilePath))
+	{
+		UE_LOG_ERROR("파일을 찾지 못했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
 
+	if (FilePath.extension() != ".obj")
+	{
+		UE_LOG_ERROR("잘못된 파일 확장자입니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	// 파일 전체를 한 번에 읽은 뒤 줄 단위로 훑는다 (줄/토큰마다 문자열을 만들지 않음)
+	FString Text;
+	if (!ReadFileText(FilePath, Text))
+	{
+		UE_LOG_ERROR("파일을 열지 못했습니다: %s", FilePath.string().c_str());
+		return false;
+	}
+
+	// 1. 줄 경계에서 구간을 나누어 병렬로 파싱 (작은 파일은 한 구간)
+	int32 ChunkCount = 1;
+	if (Text.size() >= 2 * MIN_PARSE_CHUNK_SIZE)
+	{
+		const int32 ThreadCount = Config.MaxParseThreadCount > 0 ? Config.MaxParseThreadCount : FTaskScheduler::GetInstance().GetThreadCount();
+		ChunkCount = static_cast<int32>(std::min(static_cast<size_t>(std::max(ThreadCount, 1)), Text.size() / MIN_PARSE_CHUNK_SIZE));
+	}
+
+	const char* const TextBegin = Text.data();
+	const char* const TextEnd = Text.data() + Text.size();
+	TArray<const char*> ChunkBoundaries(ChunkCount + 1, TextEnd);
+	ChunkBoundaries[0] = TextBegin;
+	for (int32 ChunkIndex = 1; ChunkIndex < ChunkCount; ++ChunkIndex)
+	{
+		const char* Target = std::max(TextBegin + Text.size() * ChunkIndex / ChunkCount, ChunkBoundaries[ChunkIndex - 1]);
+		const char* LineEnd = static_cast<const char*>(memchr(Target, '\n', static_cast<size_t>(TextEnd - Target)));
+		ChunkBoundaries[ChunkIndex] = LineEnd ? LineEnd + 1 : TextEnd;
+	}
+
+	TArray<FObjChunk> Chunks(ChunkCount);
+	std::atomic<bool> bIsFailed = false;
+	FTaskScheduler::GetInstance().ParallelFor(ChunkCount, [&](int32 ChunkIndex)
+	{
+		if (!ParseChunk(FilePath, ChunkBoundaries[ChunkIndex], ChunkBoundaries[ChunkIndex + 1], Config, Chunks[ChunkIndex]))
+		{
+			bIsFailed = true;
+		}
+	});
+
+	if (bIsFailed)
+	{
+		return false;
+	}
+
+	// 2. 파일 순서대로 병합 (정점 목록은 이어 붙이고, 구간 첫 'o' 이전의 면은 앞 구간에서 열린 오브젝트에 이어 붙인다)
+	size_t FaceCount = 0;
+	TOptional<FObjectInfo> OptObjectInfo;
+	for (FObjChunk& Chunk : Chunks)
+	{
+		AppendList(OutObjInfo->VertexList, Chunk.VertexList);
+		AppendList(OutObjInfo->NormalList, Chunk.NormalList);
+		AppendList(OutObjInfo->TexCoordList, Chunk.TexCoordList);
+
+		for (const std::filesystem::path& MaterialFilePath : Chunk.MaterialFilePaths)
+		{
 			if (!LoadMaterial(MaterialFilePath, OutObjInfo))
 			{
 				UE_LOG_ERROR("머티리얼을 불러오는데 실패했습니다: %s", MaterialFilePath.string().c_str());
@@ -257,19 +460,28 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 			}
 		}
 
-		else if (Prefix == "usemtl")
+		if (Chunk.bIsHeadUsed)
 		{
-			FString MaterialName;
-			Tokenizer >> MaterialName;
-
 			if (!OptObjectInfo)
 			{
 				OptObjectInfo.emplace();
 				OptObjectInfo->Name = Config.DefaultName;
 			}
+			AppendObjectInfo(*OptObjectInfo, Chunk.Head, FaceCount);
+			FaceCount += Chunk.HeadFaceCount;
+		}
 
-			OptObjectInfo->MaterialNameList.emplace_back(std::move(MaterialName));
-			OptObjectInfo->MaterialIndexList.emplace_back(FaceCount);
+		for (FObjectInfo& ObjectInfo : Chunk.Objects)
+		{
+			if (OptObjectInfo)
+			{
+				OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
+			}
+			OptObjectInfo = std::move(ObjectInfo);
+		}
+		if (!Chunk.Objects.empty())
+		{
+			FaceCount = Chunk.LastFaceCount;
 		}
 	}
 
@@ -278,12 +490,6 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 		OutObjInfo->ObjectInfoList.emplace_back(std::move(*OptObjectInfo));
 	}
 
-	if (Config.bIsBinaryEnabled)
-	{
-		FWindowsBinWriter WindowsBinWriter(BinFilePath);
-		WindowsBinWriter << *OutObjInfo;
-	}
-
 	return true;
 }
 
@@ -552,7 +758,7 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 	return true;
 }
 
-bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutObjectInfo)
+bool FObjImporter::ParseFaceBuffer(std::string_view FaceBuffer, FObjectInfo* OutObjectInfo)
 {
 	/** Ignore data when ObjInfo is nullptr */
 	if (!OutObjectInfo)
@@ -560,15 +766,26 @@ bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutOb
 		return false;
 	}
 
-	TArray<FString> IndexBuffers;
-	std::istringstream Tokenizer(FaceBuffer);
-	FString IndexBuffer;
-	while (std::getline(Tokenizer, IndexBuffer, '/'))
+	// '/'로 나눈 조각 (std::getline(..., '/')과 같이 끝의 '/' 뒤 빈 조각은 버린다)
+	std::string_view IndexBuffers[3];
+	size_t IndexBufferCount = 0;
+	for (size_t Position = 0; Position < FaceBuffer.size();)
 	{
-		IndexBuffers.emplace_back(IndexBuffer);
+		size_t Slash = FaceBuffer.find('/', Position);
+		if (Slash == std::string_view::npos)
+		{
+			Slash = FaceBuffer.size();
+		}
+
+		if (IndexBufferCount < 3)
+		{
+			IndexBuffers[IndexBufferCount] = FaceBuffer.substr(Position, Slash - Position);
+		}
+		++IndexBufferCount;
+		Position = Slash + 1;
 	}
 
-	if (IndexBuffers.empty())
+	if (IndexBufferCount == 0)
 	{
 		UE_LOG_ERROR("면 형식이 잘못되었습니다");
 		return false;
@@ -580,80 +797,118 @@ bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutOb
 		return false;
 	}
 
-	try
-	{
-		OutObjectInfo->VertexIndexList.push_back(std::stoull(IndexBuffers[0]) - 1);
-	}
-	catch ([[maybe_unused]] const std::invalid_argument& Exception)
+	size_t VertexIndex;
+	if (!ParseFaceIndex(IndexBuffers[0], VertexIndex))
 	{
 		UE_LOG_ERROR("정점 위치 인덱스 형식이 잘못되었습니다");
 		return false;
 	}
+	OutObjectInfo->VertexIndexList.push_back(VertexIndex);
 
-	switch (IndexBuffers.size())
+	switch (IndexBufferCount)
 	{
 	case 1:
 		/** @brief: Only position data (e.g., 'f 1 2 3') */
 		break;
 	case 2:
+	{
 		/** @brief: Position and texture coordinate data (e.g., 'f 1/1 2/1') */
-		if (IndexBuffers[1].empty())
+		size_t TexCoordIndex;
+		if (IndexBuffers[1].empty() || !ParseFaceIndex(IndexBuffers[1], TexCoordIndex))
 		{
 			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
 			return false;
 		}
 
-		try
-		{
-			OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
-		}
-		catch ([[maybe_unused]] const std::invalid_argument& Exception)
-		{
-			UE_LOG_ERROR("정점 텍스쳐 좌표 인덱스 형식이 잘못되었습니다");
-			return false;
-		}
+		OutObjectInfo->TexCoordIndexList.push_back(TexCoordIndex);
 		break;
+	}
 	case 3:
 		/** @brief: Position, texture coordinate and vertex normal data (e.g., 'f 1/1/1 2/2/1' or 'f 1//1 2//1') */
 		if (IndexBuffers[1].empty()) /** Position and vertex normal */
 		{
-			if (IndexBuffers[2].empty())
+			size_t NormalIndex;
+			if (IndexBuffers[2].empty() || !ParseFaceIndex(IndexBuffers[2], NormalIndex))
 			{
 				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
 				return false;
 			}
 
-			try
-			{
-				OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
-			{
-				UE_LOG_ERROR("정점 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
+			OutObjectInfo->NormalIndexList.push_back(NormalIndex);
 		}
 		else /** Position, texture coordinate, and vertex normal */
 		{
-			if (IndexBuffers[1].empty() || IndexBuffers[2].empty())
+			size_t TexCoordIndex;
+			size_t NormalIndex;
+			if (IndexBuffers[2].empty() || !ParseFaceIndex(IndexBuffers[1], TexCoordIndex) || !ParseFaceIndex(IndexBuffers[2], NormalIndex))
 			{
 				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
 				return false;
 			}
 
-			try
-			{
-				OutObjectInfo->TexCoordIndexList.push_back(std::stoull(IndexBuffers[1]) - 1);
-				OutObjectInfo->NormalIndexList.push_back(std::stoull(IndexBuffers[2]) - 1);
-			}
-			catch ([[maybe_unused]] const std::invalid_argument& Exception)
-			{
-				UE_LOG_ERROR("정점 텍스쳐 좌표 또는 법선 인덱스 형식이 잘못되었습니다");
-				return false;
-			}
+			OutObjectInfo->TexCoordIndexList.push_back(TexCoordIndex);
+			OutObjectInfo->NormalIndexList.push_back(NormalIndex);
 		}
 		break;
 	}
 
 	return true;
 }
+
+void RunObjImportBenchmark(const std::filesystem::path& FilePath)
+{
+	constexpr int32 REPEAT_COUNT = 3;
+
+	std::error_code ErrorCode;
+	const uintmax_t FileSize = std::filesystem::file_size(FilePath, ErrorCode);
+	if (ErrorCode || FileSize == 0)
+	{
+		UE_LOG_ERROR("OBJ Import Benchmark: 파일을 찾지 못했습니다: %s", FilePath.string().c_str());
+		return;
+	}
+
+	// 1. 파일을 버퍼로 읽기만 하는 시간 (파서가 도달할 수 있는 상한)
+	const double ReadMs = FBenchmark::MeasureAverage([&]()
+	{
+		FString Text;
+		ReadFileText(FilePath, Text);
+	}, REPEAT_COUNT);
+
+	// 2. 읽기 + 파싱 전체 (한 스레드 / 구간을 나누어 병렬)
+	FObjInfo ObjInfo;
+	bool bIsSucceeded = true;
+	auto MeasureImport = [&](int32 InMaxParseThreadCount)
+	{
+		FObjImporter::Configuration Config;
+		Config.MaxParseThreadCount = InMaxParseThreadCount;
+
+		double TotalMs = 0.0;
+		for (int32 Repeat = 0; Repeat < REPEAT_COUNT; ++Repeat)
+		{
+			// 이전 결과 해제는 측정에서 제외
+			ObjInfo = FObjInfo();
+			TotalMs += FBenchmark::MeasureOnce([&]() { bIsSucceeded &= FObjImporter::LoadObj(FilePath, &ObjInfo, Config); });
+		}
+		return TotalMs / REPEAT_COUNT;
+	};
+
+	const double SingleThreadImportMs = MeasureImport(1);
+	const double ImportMs = MeasureImport(0);
+
+	size_t IndexCount = 0;
+	for (const FObjectInfo& ObjectInfo : ObjInfo.ObjectInfoList)
+	{
+		IndexCount += ObjectInfo.VertexIndexList.size();
+	}
+
+	const double FileMB = static_cast<double>(FileSize) / (1024.0 * 1024.0);
+	auto ToMBPerSecond = [FileMB](double InMs) { return InMs > 0.0 ? FileMB / (InMs / 1000.0) : 0.0; };
+
+	UE_LOG_INFO("OBJ Import: %s (%.2f MB, %zu positions, %zu triangles)%s", FilePath.string().c_str(), FileMB,
+		ObjInfo.VertexList.size(), IndexCount / 3, bIsSucceeded ? "" : " [FAILED]");
+	UE_LOG_INFO("  read only           : %.3f ms, %.1f MB/s", ReadMs, ToMBPerSecond(ReadMs));
+	UE_LOG_INFO("  LoadObj (1 thread)  : %.3f ms, %.1f MB/s (%.2fx read time)", SingleThreadImportMs, ToMBPerSecond(SingleThreadImportMs),
+		ReadMs > 0.0 ? SingleThreadImportMs / ReadMs : 0.0);
+	UE_LOG_INFO("  LoadObj (%d threads) : %.3f ms, %.1f MB/s (%.2fx read time)", FTaskScheduler::GetInstance().GetThreadCount(), ImportMs,
+		ToMBPerSecond(ImportMs), ReadMs > 0.0 ? ImportMs / ReadMs : 0.0);
+}
@@ -6,6 +6,13 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
+#include "Core/Public/MappedFile.h"
+#include "Core/Public/MemoryReader.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
+#include "Global/Memory.h"
+#include "Utility/Public/TaskScheduler.h"
+#include "Utility/Public/Benchmark.h"
 #include <filesystem>
 
 // static 멤버 변수의 실체를 정의(메모리 할당)합니다.
@@ -30,20 +37,198 @@ struct VertexKeyHash
 	}
 };
 
+namespace
+{
+	// Cooked 메시 파일 맨 앞에 기록하는 헤더
+	struct FCookedMeshHeader
+	{
+		static constexpr uint32 MAGIC = 0x4853454D; // "MESH"
+
+		uint32 Magic;
+		uint32 Version;
+		FCookedSourceStamp SourceStamp;
+	};
+
+	bool ReadWholeFile(const std::filesystem::path& FilePath, TArray<uint8>& OutBytes)
+	{
+		std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+		if (!File) { return false; }
+
+		const std::streamsize FileSize = File.tellg();
+		if (FileSize < 0) { return false; }
+
+		OutBytes.resize(static_cast<size_t>(FileSize));
+		File.seekg(0, std::ios::beg);
+		return static_cast<bool>(File.read(reinterpret_cast<char*>(OutBytes.data()), FileSize));
+	}
+}
+
+bool FObjManager::GetSourceStamp(const std::filesystem::path& ObjFilePath, const FObjImporter::Configuration& Config, FCookedSourceStamp& OutStamp)
+{
+	std::error_code ErrorCode;
+	const uintmax_t FileSize = std::filesystem::file_size(ObjFilePath, ErrorCode);
+	if (ErrorCode) { return false; }
+
+	const std::filesystem::file_time_type LastWriteTime = std::filesystem::last_write_time(ObjFilePath, ErrorCode);
+	if (ErrorCode) { return false; }
+
+	OutStamp.FileSize = static_cast<uint64>(FileSize);
+	OutStamp.LastWriteTime = static_cast<int64>(LastWriteTime.time_since_epoch().count());
+
+	// 결과 메시를 바꾸는 Import 설정도 포함
+	OutStamp.ConfigBits =
+		(Config.bIsObjectEnabled ? 1ULL : 0ULL) |
+		(Config.bFlipWindingOrder ? 2ULL : 0ULL) |
+		(Config.bPositionToUEBasis ? 4ULL : 0ULL) |
+		(Config.bUVToUEBasis ? 8ULL : 0ULL) |
+		(static_cast<uint64>(Config.BVHBuildMethod) << 4);
+
+	return true;
+}
+
+bool FObjManager::LoadCookedStaticMesh(const std::filesystem::path& CookedFilePath, const FCookedSourceStamp& SourceStamp, FStaticMesh* OutStaticMesh)
+{
+	if (!OutStaticMesh || !std::filesystem::exists(CookedFilePath)) { return false; }
+
+	// 1. 파일 매핑 (페이지는 접근할 때 읽히며, 버텍스/인덱스는 복사하지 않고 매핑된 파일을 그대로 가리킨다)
+	auto MappedFile = std::make_unique<FMappedFile>();
+	if (!MappedFile->Open(CookedFilePath))
+	{
+		UE_LOG_ERROR("Cooked 메시 파일을 매핑하지 못했습니다: %s", CookedFilePath.string().c_str());
+		return false;
+	}
+
+	// 2. 헤더 검사 (형식 버전이나 원본 스탬프가 다르면 다시 Cook)
+	FMemoryReader MemoryReader(MappedFile->GetData(), MappedFile->GetSize(), true);
+	FCookedMeshHeader Header = {};
+	MemoryReader << Header;
+	if (MemoryReader.IsError() || Header.Magic != FCookedMeshHeader::MAGIC || Header.Version != COOKED_MESH_VERSION)
+	{
+		UE_LOG("Cooked 메시 형식이 다릅니다. 다시 생성합니다: %s", CookedFilePath.string().c_str());
+		return false;
+	}
+	if (Header.SourceStamp != SourceStamp)
+	{
+		UE_LOG("Cooked 메시가 원본과 다릅니다. 다시 생성합니다: %s", CookedFilePath.string().c_str());
+		return false;
+	}
+
+	// 3. 메시 본문 (가속 구조 포함)
+	MemoryReader << *OutStaticMesh;
+	if (MemoryReader.IsError() || !MemoryReader.IsAtEnd())
+	{
+		UE_LOG_ERROR("Cooked 메시 파일이 손상되었습니다: %s", CookedFilePath.string().c_str());
+		return false;
+	}
+
+	// 버텍스/인덱스 뷰가 가리키는 매핑은 메시와 수명을 같이 한다
+	OutStaticMesh->MappedFile = std::move(MappedFile);
+	return true;
+}
+
+void FObjManager::SaveCookedStaticMesh(const std::filesystem::path& CookedFilePath, const FCookedSourceStamp& SourceStamp, FStaticMesh* InStaticMesh)
+{
+	if (!InStaticMesh) { return; }
+
+	FWindowsBinWriter WindowsBinWriter(CookedFilePath);
+	FCookedMeshHeader Header = { FCookedMeshHeader::MAGIC, COOKED_MESH_VERSION, SourceStamp };
+	WindowsBinWriter << Header;
+	WindowsBinWriter << *InStaticMesh;
+}
+
 /** @todo: std::filesystem으로 변경 */
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
+	ALLOCATION_TAG(Asset)
+
 	auto Iter = ObjFStaticMeshMap.find(PathFileName);
 	if (Iter != ObjFStaticMeshMap.end())
 	{
 		return Iter->second.get();
 	}
 
+	std::unique_ptr<FStaticMesh> StaticMesh = BuildStaticMeshAsset(PathFileName, Config);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	FStaticMesh* Result = StaticMesh.get();
+	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
+	return Result;
+}
+
+void FObjManager::LoadObjStaticMeshAssets(const TArray<FName>& PathFileNames, const FObjImporter::Configuration& Config)
+{
+	ALLOCATION_TAG(Asset)
+
+	// 아직 로드되지 않은 파일을 큰 것부터 분배하여, 마지막에 큰 파일 하나만 남아 한 스레드가 오래 붙잡는 상황을 줄인다
+	TArray<TPair<uintmax_t, FName>> PendingFiles;
+	PendingFiles.reserve(PathFileNames.size());
+	for (const FName& PathFileName : PathFileNames)
+	{
+		if (ObjFStaticMeshMap.count(PathFileName))
+		{
+			continue;
+		}
+
+		std::error_code ErrorCode;
+		const uintmax_t FileSize = std::filesystem::file_size(PathFileName.ToString(), ErrorCode);
+		PendingFiles.emplace_back(ErrorCode ? 0 : FileSize, PathFileName);
+	}
+
+	std::sort(PendingFiles.begin(), PendingFiles.end(), [](const TPair<uintmax_t, FName>& A, const TPair<uintmax_t, FName>& B)
+	{
+		return A.first > B.first;
+	});
+
+	// 파일마다 독립적으로 구축 (맵 등록은 모든 작업이 끝난 뒤 호출 스레드에서 수행)
+	TArray<std::unique_ptr<FStaticMesh>> StaticMeshes(PendingFiles.size());
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	FTaskScheduler::GetInstance().ParallelFor(static_cast<int32>(PendingFiles.size()), [&](int32 Index)
+	{
+		StaticMeshes[Index] = BuildStaticMeshAsset(PendingFiles[Index].second, Config);
+	});
+	const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+	int32 LoadedCount = 0;
+	for (size_t Index = 0; Index < PendingFiles.size(); ++Index)
+	{
+		if (StaticMeshes[Index])
+		{
+			ObjFStaticMeshMap.emplace(PendingFiles[Index].second, std::move(StaticMeshes[Index]));
+			++LoadedCount;
+		}
+	}
+
+	UE_LOG_INFO("Static Mesh %d/%zu개 로드: %.1f ms (%d threads)", LoadedCount, PendingFiles.size(), ElapsedMs,
+		FTaskScheduler::GetInstance().GetThreadCount());
+}
+
+std::unique_ptr<FStaticMesh> FObjManager::BuildStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
+{
+	/** #0. 원본이 바뀌지 않은 Cooked 메시(.objbin)가 있으면 그대로 사용 */
+	std::filesystem::path CookedFilePath = PathFileName.ToString();
+	CookedFilePath.replace_extension(".objbin");
+
+	FCookedSourceStamp SourceStamp;
+	const bool bHasSourceStamp = Config.bIsBinaryEnabled && GetSourceStamp(PathFileName.ToString(), Config, SourceStamp);
+	if (bHasSourceStamp)
+	{
+		auto CookedStaticMesh = std::make_unique<FStaticMesh>();
+		CookedStaticMesh->PathFileName = PathFileName;
+		if (LoadCookedStaticMesh(CookedFilePath, SourceStamp, CookedStaticMesh.get()))
+		{
+			UE_LOG("Cooked 메시를 로드했습니다: %s", CookedFilePath.string().c_str());
+			return CookedStaticMesh;
+		}
+	}
+
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
 	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
 	{
-		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathFileName.ToString());
+		UE_LOG_ERROR("파일 정보를 읽어오는데 실패했습니다: %s", PathFileName.ToString().c_str());
 		return nullptr;
 	}
 
@@ -96,16 +281,17 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 				Vertex.TexCoord = ObjInfo.TexCoordList[TexCoordIndex];
 			}
 
-			size_t Index = StaticMesh->Vertices.size();
-			StaticMesh->Vertices.push_back(Vertex);
-			StaticMesh->Indices.push_back(Index);
+			size_t Index = StaticMesh->VertexStorage.size();
+			StaticMesh->VertexStorage.push_back(Vertex);
+			StaticMesh->IndexStorage.push_back(Index);
 			VertexMap[Key] = Index;
 		}
 		else
 		{
-			StaticMesh->Indices.push_back(It->second);
+			StaticMesh->IndexStorage.push_back(It->second);
 		}
 	}
+	StaticMesh->UpdateGeometryViews();
 
 	/** #3. 오브젝트가 사용하는 머티리얼의 목록을 저장 */
 	TSet<FName> UniqueMaterialNames;
@@ -172,10 +358,16 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
-	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
+	StaticMesh->BVH.Build(StaticMesh.get(), Config.BVHBuildMethod); // 빠른 피킹용 BVH 구축
+	StaticMesh->QBVH.Build(StaticMesh.get());
 
-	return ObjFStaticMeshMap[PathFileName].get();
+	/** #5. 다음 로드부터는 파싱과 구축 없이 읽을 수 있도록 Cooked 메시 저장 */
+	if (bHasSourceStamp)
+	{
+		SaveCookedStaticMesh(CookedFilePath, SourceStamp, StaticMesh.get());
+	}
+
+	return StaticMesh;
 }
 
 /**
@@ -292,3 +484,132 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FName& PathFileName, const FOb
 
 	return nullptr;
 }
+
+void FObjManager::GetLoadedStaticMeshAssets(TArray<FStaticMesh*>& OutStaticMeshes)
+{
+	OutStaticMeshes.reserve(OutStaticMeshes.size() + ObjFStaticMeshMap.size());
+	for (const auto& [PathFileName, StaticMesh] : ObjFStaticMeshMap)
+	{
+		OutStaticMeshes.push_back(StaticMesh.get());
+	}
+}
+
+void RunCookedMeshLoadBenchmark(FStaticMesh* InMesh)
+{
+	constexpr int32 REPEAT_COUNT = 3;
+
+	if (!InMesh || InMesh->Vertices.empty()) { return; }
+
+	const std::filesystem::path TempDirectory = std::filesystem::temp_directory_path();
+	const std::filesystem::path ElementFilePath = TempDirectory / "CookedMeshBenchmark_Element.objbin";
+	const std::filesystem::path BulkFilePath = TempDirectory / "CookedMeshBenchmark_Bulk.objbin";
+
+	// 1. 두 형식으로 저장 (FNormalVertex는 일괄 직렬화 시 0으로 지운 패딩까지 기록되므로 파일 레이아웃이 다름)
+	auto Save = [InMesh](const std::filesystem::path& FilePath, bool bAllowBulkSerialize, size_t BufferSize)
+	{
+		return FBenchmark::MeasureOnce([&]()
+		{
+			FWindowsBinWriter Writer(FilePath, BufferSize, bAllowBulkSerialize);
+			Writer << *InMesh;
+		});
+	};
+
+	const double ElementSaveMs = Save(ElementFilePath, false, 0);
+	const double BulkSaveMs = Save(BulkFilePath, true, FWindowsBinWriter::DEFAULT_BUFFER_SIZE);
+
+	// 2. 로드 방식별로 REPEAT_COUNT번 읽어 평균 시간과, 로드된 메시가 붙잡고 있는 힙 크기를 측정 (복원된 메시로 결과 검증)
+	bool bIsMismatch = false;
+	auto Measure = [&](const TFunction<void(FStaticMesh&)>& InLoad, double& OutHeapMB)
+	{
+		double TotalMs = 0.0;
+		for (int32 Repeat = 0; Repeat < REPEAT_COUNT; ++Repeat)
+		{
+			FStaticMesh LoadedMesh;
+			const int64 StartBytes = FAllocationTracker::GetTotalStats().CurrentBytes;
+			TotalMs += FBenchmark::MeasureOnce([&]() { InLoad(LoadedMesh); });
+			OutHeapMB = static_cast<double>(FAllocationTracker::GetTotalStats().CurrentBytes - StartBytes) / (1024.0 * 1024.0);
+
+			if (LoadedMesh.Vertices.size() != InMesh->Vertices.size() ||
+				!std::equal(LoadedMesh.Indices.begin(), LoadedMesh.Indices.end(), InMesh->Indices.begin(), InMesh->Indices.end()) ||
+				LoadedMesh.BVH.GetNodeCount() != InMesh->BVH.GetNodeCount() || LoadedMesh.QBVH.GetNodeCount() != InMesh->QBVH.GetNodeCount())
+			{
+				bIsMismatch = true;
+			}
+		}
+		return TotalMs / REPEAT_COUNT;
+	};
+
+	double ElementUnbufferedHeapMB, ElementBufferedHeapMB, BulkBufferedHeapMB, BulkMemoryHeapMB, MappedHeapMB;
+	const double ElementUnbufferedMs = Measure([&](FStaticMesh& OutMesh)
+	{
+		FWindowsBinReader Reader(ElementFilePath, 0, false);
+		Reader << OutMesh;
+	}, ElementUnbufferedHeapMB);
+	const double ElementBufferedMs = Measure([&](FStaticMesh& OutMesh)
+	{
+		FWindowsBinReader Reader(ElementFilePath, FWindowsBinReader::DEFAULT_BUFFER_SIZE, false);
+		Reader << OutMesh;
+	}, ElementBufferedHeapMB);
+	const double BulkBufferedMs = Measure([&](FStaticMesh& OutMesh)
+	{
+		FWindowsBinReader Reader(BulkFilePath);
+		Reader << OutMesh;
+	}, BulkBufferedHeapMB);
+	const double BulkMemoryMs = Measure([&](FStaticMesh& OutMesh)
+	{
+		TArray<uint8> Bytes;
+		ReadWholeFile(BulkFilePath, Bytes);
+		FMemoryReader Reader(Bytes);
+		Reader << OutMesh;
+	}, BulkMemoryHeapMB);
+	const double MappedMs = Measure([&](FStaticMesh& OutMesh)
+	{
+		OutMesh.MappedFile = std::make_unique<FMappedFile>();
+		if (OutMesh.MappedFile->Open(BulkFilePath))
+		{
+			FMemoryReader Reader(OutMesh.MappedFile->GetData(), OutMesh.MappedFile->GetSize(), true);
+			Reader << OutMesh;
+		}
+	}, MappedHeapMB);
+
+	// 매핑 로드는 버텍스 페이지를 처음 접근할 때 비용을 내므로, 로드 직후 버텍스 전체를 한 번 훑는 시간도 측정
+	double MappedFirstPassMs = 0.0;
+	{
+		FStaticMesh MappedMesh;
+		MappedMesh.MappedFile = std::make_unique<FMappedFile>();
+		if (MappedMesh.MappedFile->Open(BulkFilePath))
+		{
+			FMemoryReader Reader(MappedMesh.MappedFile->GetData(), MappedMesh.MappedFile->GetSize(), true);
+			Reader << MappedMesh;
+
+			float PositionSum = 0.0f;
+			MappedFirstPassMs = FBenchmark::MeasureOnce([&]()
+			{
+				for (const FNormalVertex& Vertex : MappedMesh.Vertices)
+				{
+					PositionSum += Vertex.Position.X;
+				}
+			});
+			if (PositionSum != PositionSum) { bIsMismatch = true; }
+		}
+	}
+
+	std::error_code ErrorCode;
+	const double ElementMB = static_cast<double>(std::filesystem::file_size(ElementFilePath, ErrorCode)) / (1024.0 * 1024.0);
+	const double BulkMB = static_cast<double>(std::filesystem::file_size(BulkFilePath, ErrorCode)) / (1024.0 * 1024.0);
+	std::filesystem::remove(ElementFilePath, ErrorCode);
+	std::filesystem::remove(BulkFilePath, ErrorCode);
+
+	UE_LOG_INFO("Cooked Mesh Load: %s (%zu vertices, %zu triangles)", InMesh->PathFileName.ToString().c_str(), InMesh->Vertices.size(), InMesh->Indices.size() / 3);
+	UE_LOG_INFO("  save element/unbuffered : %.2f MB, %.3f ms", ElementMB, ElementSaveMs);
+	UE_LOG_INFO("  save bulk/buffered      : %.2f MB, %.3f ms", BulkMB, BulkSaveMs);
+	UE_LOG_INFO("  load element/unbuffered : %.3f ms (%.1f MB/s), heap %.2f MB", ElementUnbufferedMs, ElementMB / max(ElementUnbufferedMs, 1e-6) * 1000.0, ElementUnbufferedHeapMB);
+	UE_LOG_INFO("  load element/buffered   : %.3f ms (%.1f MB/s), heap %.2f MB", ElementBufferedMs, ElementMB / max(ElementBufferedMs, 1e-6) * 1000.0, ElementBufferedHeapMB);
+	UE_LOG_INFO("  load bulk/buffered      : %.3f ms (%.1f MB/s), heap %.2f MB", BulkBufferedMs, BulkMB / max(BulkBufferedMs, 1e-6) * 1000.0, BulkBufferedHeapMB);
+	UE_LOG_INFO("  load bulk/whole file    : %.3f ms (%.1f MB/s), heap %.2f MB", BulkMemoryMs, BulkMB / max(BulkMemoryMs, 1e-6) * 1000.0, BulkMemoryHeapMB);
+	UE_LOG_INFO("  load bulk/mapped        : %.3f ms (%.1f MB/s), heap %.2f MB, first vertex pass %.3f ms", MappedMs, BulkMB / max(MappedMs, 1e-6) * 1000.0, MappedHeapMB, MappedFirstPassMs);
+	if (bIsMismatch)
+	{
+		UE_LOG_ERROR("  loaded mesh does not match the source mesh");
+	}
+}
@@ -20,12 +20,12 @@ public:
 	void Release();
 
 	// Vertex 관련 함수들
-	TArray<FNormalVertex>* GetVertexData(EPrimitiveType InType);
+	TConstArrayView<FNormalVertex> GetVertexData(EPrimitiveType InType);
 	ID3D11Buffer* GetVertexbuffer(EPrimitiveType InType);
 	uint32 GetNumVertices(EPrimitiveType InType);
 
 	// Index 관련 함수들
-	TArray<uint32>* GetIndexData(EPrimitiveType InType);
+	TConstArrayView<uint32> GetIndexData(EPrimitiveType InType);
 	ID3D11Buffer* GetIndexbuffer(EPrimitiveType InType);
 	uint32 GetNumIndices(EPrimitiveType InType);
 
@@ -43,9 +43,9 @@ public:
 
 	// StaticMesh 관련 함수
 	void LoadAllObjStaticMesh();
-	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
+	ID3D11Buffer* CreateVertexBuffer(TConstArrayView<FNormalVertex> InVertices);
 	ID3D11Buffer* GetVertexBuffer(FName InObjPath);
-	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
+	ID3D11Buffer* CreateIndexBuffer(TConstArrayView<uint32> InIndices);
 	ID3D11Buffer* GetIndexBuffer(FName InObjPath);
 
 	// StaticMesh Cache Accessors
@@ -90,7 +90,7 @@ private:
 	void ReleaseAllTextures();
 
 	// Helper Functions
-	FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
+	FAABB CalculateAABB(TConstArrayView<FNormalVertex> Vertices);
 
 	// AABB Resource
 	TMap<EPrimitiveType, FAABB> AABBs;		// 각 타입별 AABB 저장
@@ -3,17 +3,72 @@
 #include <Global/Types.h>
 #include <Component/Mesh/Public/StaticMesh.h>
 #include <Manager/Asset/Public/ObjImporter.h>
+#include <filesystem>
 #include <memory>
 
+/**
+ * @brief Cooked 메시를 만든 원본 .obj의 크기/수정 시각과 결과 메시에 영향을 주는 Import 설정
+ * 원본 내용을 읽지 않고 파일 시스템 메타데이터만으로 Cooked 메시의 유효성을 검사한다
+ */
+struct FCookedSourceStamp
+{
+	uint64 FileSize = 0;
+	int64 LastWriteTime = 0;
+	uint64 ConfigBits = 0;
+
+	bool operator==(const FCookedSourceStamp& Other) const
+	{
+		return FileSize == Other.FileSize && LastWriteTime == Other.LastWriteTime && ConfigBits == Other.ConfigBits;
+	}
+	bool operator!=(const FCookedSourceStamp& Other) const { return !(*this == Other); }
+};
+
 class FObjManager
 {
 public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/**
+	 * @brief 여러 .obj 파일의 FStaticMesh를 FTaskScheduler로 병렬 로드하여 캐시에 등록 (이미 로드된 파일은 건너뜀)
+	 * 이후 LoadObjStaticMeshAsset/LoadObjStaticMesh는 캐시된 Asset을 사용한다
+	 */
+	static void LoadObjStaticMeshAssets(const TArray<FName>& PathFileNames, const FObjImporter::Configuration& Config = {});
 	static UStaticMesh* LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
 	static void CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* StaticMeshAsset, const FName& ObjFilePath);
+	// 지금까지 로드된 모든 Static Mesh Asset
+	static void GetLoadedStaticMeshAssets(TArray<FStaticMesh*>& OutStaticMeshes);
 
 	static constexpr size_t INVALID_INDEX = SIZE_MAX;
 
+	// Cooked 메시(.objbin) 형식 버전. FStaticMesh, FBVH, FQBVH의 저장 레이아웃이 바뀌면 올린다
+	static constexpr uint32 COOKED_MESH_VERSION = 5;
+
 private:
+	/**
+	 * @brief Cooked 메시를 읽거나 .obj를 Import하여 FStaticMesh를 구축 (캐시에 접근하지 않으므로 여러 스레드에서 동시에 호출 가능)
+	 * @return 실패 시 nullptr
+	 */
+	static std::unique_ptr<FStaticMesh> BuildStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config);
+
+	/**
+	 * @brief 원본 .obj 파일의 크기/수정 시각과 Import 설정으로 Cooked 메시의 유효성 검사용 스탬프를 구성 (파일 내용은 읽지 않음)
+	 * @return 원본 파일 정보를 얻지 못하면 false
+	 */
+	static bool GetSourceStamp(const std::filesystem::path& ObjFilePath, const FObjImporter::Configuration& Config, FCookedSourceStamp& OutStamp);
+
+	/**
+	 * @brief Cooked 메시 파일을 매핑하여 FStaticMesh를 복원 (버텍스 병합, 섹션, BVH 구축 없음)
+	 * 버텍스/인덱스는 매핑된 파일을 직접 가리키며, 매핑은 OutStaticMesh가 소유한다
+	 * @return 버전/원본 스탬프가 일치하고 손상되지 않았으면 true
+	 */
+	static bool LoadCookedStaticMesh(const std::filesystem::path& CookedFilePath, const FCookedSourceStamp& SourceStamp, FStaticMesh* OutStaticMesh);
+	static void SaveCookedStaticMesh(const std::filesystem::path& CookedFilePath, const FCookedSourceStamp& SourceStamp, FStaticMesh* InStaticMesh);
+
 	static TMap<FName, std::unique_ptr<FStaticMesh>> ObjFStaticMeshMap;
 };
+
+/**
+ * @brief 메시를 임시 Cooked 파일로 저장한 뒤, 원소 단위 직렬화 + 비버퍼 읽기(기존 방식), 원소 단위 + 버퍼 읽기,
+ * 일괄 직렬화 + 버퍼 읽기, 일괄 직렬화 + 파일 전체를 메모리로 읽은 뒤 파싱, 파일 매핑(현재 Cook 로드 경로)의
+ * 로드 시간과 로드된 메시가 차지하는 힙 크기를 비교하여 로그로 출력
+ */
+void RunCookedMeshLoadBenchmark(FStaticMesh* InMesh);
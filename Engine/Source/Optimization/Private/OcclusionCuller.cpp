@@ -4,18 +4,170 @@
 
 #include "Level/Public/Level.h"
 #include "Global/Octree.h"
+#include "Utility/Public/TaskScheduler.h"
+
+#include <immintrin.h>
+
+namespace
+{
+    // AABB 8개 정점으로 12개 삼각형을 구성하는 인덱스 (오클루더당 동일)
+    constexpr int32 BoxTriangleIndices[36] =
+    {
+        0, 1, 2,  0, 2, 3, // Front face (Z = Min)
+        5, 4, 7,  5, 7, 6, // Back face (Z = Max)
+        4, 0, 3,  4, 3, 7, // Left face (X = Min)
+        1, 5, 6,  1, 6, 2, // Right face (X = Max)
+        4, 5, 1,  4, 1, 0, // Bottom face (Y = Min)
+        3, 2, 6,  3, 6, 7  // Top face (Y = Max)
+    };
+
+    // 재투영 쿼드의 네 정점 Clip W 비율이 이보다 크면 깊이 불연속(실루엣)으로 보고 건너뜀
+    constexpr float REPROJECTION_MAX_DEPTH_RATIO = 1.1f;
+    // 한 평면 위에서는 스크린 공간 깊이가 선형이므로 2차 차분이 0, 벗어나면 서로 다른 면에 걸친 샘플
+    constexpr float REPROJECTION_PLANE_TOLERANCE = 1e-5f;
+
+    /**
+     * @brief 일반 4x4 역행렬 (부분 피벗 Gauss-Jordan), 특이 행렬이면 false
+     */
+    bool InvertMatrix(const FMatrix& InMatrix, FMatrix& OutInverse)
+    {
+        float Augmented[4][8];
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col)
+            {
+                Augmented[Row][Col] = InMatrix.Data[Row][Col];
+                Augmented[Row][Col + 4] = Row == Col ? 1.0f : 0.0f;
+            }
+        }
+
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            int32 Pivot = Col;
+            for (int32 Row = Col + 1; Row < 4; ++Row)
+            {
+                if (std::abs(Augmented[Row][Col]) > std::abs(Augmented[Pivot][Col])) { Pivot = Row; }
+            }
+            if (std::abs(Augmented[Pivot][Col]) < 1e-12f) { return false; }
+            if (Pivot != Col)
+            {
+                for (int32 K = 0; K < 8; ++K) { std::swap(Augmented[Pivot][K], Augmented[Col][K]); }
+            }
+
+            const float InvPivot = 1.0f / Augmented[Col][Col];
+            for (int32 K = 0; K < 8; ++K) { Augmented[Col][K] *= InvPivot; }
+
+            for (int32 Row = 0; Row < 4; ++Row)
+            {
+                if (Row == Col) { continue; }
+                const float Factor = Augmented[Row][Col];
+                for (int32 K = 0; K < 8; ++K) { Augmented[Row][K] -= Factor * Augmented[Col][K]; }
+            }
+        }
+
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col) { OutInverse.Data[Row][Col] = Augmented[Row][Col + 4]; }
+        }
+        return true;
+    }
+
+    bool IsSameAABB(const FVector& MinA, const FVector& MaxA, const FVector& MinB, const FVector& MaxB)
+    {
+        return MinA.X == MinB.X && MinA.Y == MinB.Y && MinA.Z == MinB.Z
+            && MaxA.X == MaxB.X && MaxA.Y == MaxB.Y && MaxA.Z == MaxB.Z;
+    }
+}
 
 COcclusionCuller::COcclusionCuller()
 { 
     CPU_ZBuffer.resize(Z_BUFFER_SIZE);
+    TileBins.resize(TileCountX * TileCountY);
+    TileStats.resize(TileCountX * TileCountY);
+
+    int32 HiZSize = 0;
+    for (int32 Level = 0; Level < HI_Z_LEVEL_COUNT; ++Level)
+    {
+        HiZLevelOffsets[Level] = HiZSize;
+        HiZSize += (Z_BUFFER_WIDTH >> Level) * (Z_BUFFER_HEIGHT >> Level);
+    }
+    HiZPyramid.resize(HiZSize);
 }
 
-void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix)
+void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
+    EOcclusionBufferType InBufferType, int32 InMaskedWidth, int32 InMaskedHeight)
 {
-    fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
+    SetBufferFormat(InBufferType, InMaskedWidth, InMaskedHeight);
+
+    // 시간적 재사용 모드에서는 PerformCulling에서 정적 버퍼 재사용 여부에 따라 채움
+    if (!bIsTemporalEnabled)
+    {
+        ClearDepthBuffer();
+    }
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
+void COcclusionCuller::SetTemporalEnabled(bool bInEnabled)
+{
+    bIsTemporalEnabled = bInEnabled;
+    bHasTemporalHistory = false;
+    StaticOccluders.clear();
+    DynamicOccluders.clear();
+    OccluderMovedFrames.clear();
+    PreviousVisibleComponents.clear();
+}
+
+void COcclusionCuller::ClearDepthBuffer()
+{
+    if (BufferType == EOcclusionBufferType::Masked)
+    {
+        for (FMaskedOcclusionTile& Tile : MaskedTiles)
+        {
+            memset(Tile.Mask, 0, sizeof(Tile.Mask));
+            Tile.ZMax0 = 1.0f;
+            Tile.ZMax1 = 0.0f;
+        }
+    }
+    else
+    {
+        fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
+    }
+}
+
+void COcclusionCuller::SetBufferFormat(EOcclusionBufferType InBufferType, int32 InMaskedWidth, int32 InMaskedHeight)
+{
+    int32 NewWidth = Z_BUFFER_WIDTH;
+    int32 NewHeight = Z_BUFFER_HEIGHT;
+    if (InBufferType == EOcclusionBufferType::Masked)
+    {
+        NewWidth = max((InMaskedWidth + TILE_WIDTH - 1) / TILE_WIDTH, 1) * TILE_WIDTH;
+        NewHeight = max((InMaskedHeight + TILE_HEIGHT - 1) / TILE_HEIGHT, 1) * TILE_HEIGHT;
+    }
+
+    if (InBufferType == BufferType && NewWidth == BufferWidth && NewHeight == BufferHeight) { return; }
+
+    BufferType = InBufferType;
+    bHasTemporalHistory = false;
+    BufferWidth = NewWidth;
+    BufferHeight = NewHeight;
+    TileCountX = BufferWidth / TILE_WIDTH;
+    TileCountY = BufferHeight / TILE_HEIGHT;
+    TileBins.resize(TileCountX * TileCountY);
+    TileStats.resize(TileCountX * TileCountY);
+
+    if (BufferType == EOcclusionBufferType::Masked)
+    {
+        MaskedTileCountX = BufferWidth / MASKED_TILE_WIDTH;
+        MaskedTiles.resize(MaskedTileCountX * (BufferHeight / MASKED_TILE_HEIGHT));
+    }
+    else
+    {
+        MaskedTileCountX = 0;
+        MaskedTiles.clear();
+        MaskedTiles.shrink_to_fit();
+    }
+}
+
 TArray<TObjectPtr<UPrimitiveComponent>> COcclusionCuller::PerformCulling(const TArray<TObjectPtr<UPrimitiveComponent>>& AllPrimitives, const FVector& CameraPos)
 {    
     Frame++;
@@ -30,11 +182,16 @@ TArray<TObjectPtr<UPrimitiveComponent>> COcclusionCuller::PerformCulling(const T
         Data.Prim = PrimitiveComp;
         PrimitiveComp->GetWorldAABB(Data.Min, Data.Max);
         Data.Center = (Data.Min + Data.Max) * 0.5f;
-        CachedAABBs.push_back(Data);
 
-        // 인덱스를 컴포넌트에 직접 캐시
-        PrimitiveComp->CachedAABBIndex = i;
+        // 인덱스를 컴포넌트에 직접 캐시 (nullptr를 건너뛰므로 CachedAABBs 기준 인덱스)
+        PrimitiveComp->CachedAABBIndex = static_cast<int32>(CachedAABBs.size());
         PrimitiveComp->CachedFrame = Frame;
+        CachedAABBs.push_back(Data);
+    }
+
+    if (bIsTemporalEnabled)
+    {
+        return PerformTemporalCulling(CameraPos);
     }
 
 
@@ -46,7 +203,13 @@ TArray<TObjectPtr<UPrimitiveComponent>> COcclusionCuller::PerformCulling(const T
     // 2. CPU Z-Buffer 구성
     RasterizeOccluders(SelectedOccluders, CameraPos);
 
-    // 3. 가시성 테스트
+    // 3. Hi-Z 피라미드 구성 (Masked 버퍼는 타일 자체가 보수적 깊이를 가지므로 불필요)
+    if (BufferType == EOcclusionBufferType::Float)
+    {
+        BuildHiZPyramid();
+    }
+
+    // 4. 가시성 테스트
     VisibleMeshComponents.clear();
     for (auto& AABBData : CachedAABBs)
     {
@@ -59,6 +222,291 @@ TArray<TObjectPtr<UPrimitiveComponent>> COcclusionCuller::PerformCulling(const T
     return VisibleMeshComponents;
 }
 
+TArray<TObjectPtr<UPrimitiveComponent>> COcclusionCuller::PerformTemporalCulling(const FVector& CameraPos)
+{
+    const bool bIsReporting = bIsTileStatsRequested;
+    bool bShouldRebuild = !bHasTemporalHistory;
+
+    // 1. 정적 오클루더 변화 검사 및 이번 프레임에 래스터라이징할 Dynamic 오클루더 수집
+    TArray<UPrimitiveComponent*> FrameDynamicOccluders;
+    size_t MatchedStaticCount = 0;
+    for (const FWorldAABBData& Data : CachedAABBs)
+    {
+        auto StaticIt = StaticOccluders.find(Data.Prim);
+        if (StaticIt != StaticOccluders.end())
+        {
+            ++MatchedStaticCount;
+            if (!IsSameAABB(StaticIt->second.Min, StaticIt->second.Max, Data.Min, Data.Max))
+            {
+                OccluderMovedFrames[Data.Prim] = Frame;
+                bShouldRebuild = true;
+            }
+        }
+        else if (DynamicOccluders.count(Data.Prim))
+        {
+            FrameDynamicOccluders.push_back(Data.Prim);
+        }
+    }
+
+    // 프러스텀 밖으로 나갔거나 삭제된 정적 오클루더가 있으면 정적 버퍼를 신뢰할 수 없음
+    if (MatchedStaticCount != StaticOccluders.size())
+    {
+        bShouldRebuild = true;
+    }
+
+    const bool bIsCameraStill = memcmp(&CurrentViewProj, &StaticViewProj, sizeof(FMatrix)) == 0;
+    if (!bIsCameraStill && (BufferType == EOcclusionBufferType::Masked || Frame - StaticBuildFrame >= TEMPORAL_REBUILD_INTERVAL))
+    {
+        bShouldRebuild = true;
+    }
+
+    // 2. 깊이 버퍼 구성
+    const char* TemporalMode = nullptr;
+    if (bShouldRebuild)
+    {
+        TemporalMode = "Rebuild";
+        ClearDepthBuffer();
+
+        ULevel* CurrentLevel = GWorld->GetLevel();
+        TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, CachedAABBs.size() / 10);
+        TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
+
+        // 오래전에 움직인 기록 정리
+        for (auto It = OccluderMovedFrames.begin(); It != OccluderMovedFrames.end();)
+        {
+            It = Frame - It->second >= TEMPORAL_DYNAMIC_OCCLUDER_FRAMES ? OccluderMovedFrames.erase(It) : std::next(It);
+        }
+
+        // 최근에 움직인 오클루더는 정적 버퍼에서 제외
+        TArray<UPrimitiveComponent*> StaticSelection;
+        StaticOccluders.clear();
+        DynamicOccluders.clear();
+        FrameDynamicOccluders.clear();
+        for (UPrimitiveComponent* Occluder : SelectedOccluders)
+        {
+            if (OccluderMovedFrames.count(Occluder))
+            {
+                DynamicOccluders.insert(Occluder);
+                FrameDynamicOccluders.push_back(Occluder);
+            }
+            else
+            {
+                const FWorldAABBData& Data = CachedAABBs[Occluder->CachedAABBIndex];
+                StaticOccluders[Occluder] = { Data.Min, Data.Max };
+                StaticSelection.push_back(Occluder);
+            }
+        }
+
+        RasterizeOccluders(StaticSelection, CameraPos);
+
+        if (BufferType == EOcclusionBufferType::Masked)
+        {
+            StaticMaskedTiles = MaskedTiles;
+        }
+        else
+        {
+            StaticZBuffer = CPU_ZBuffer;
+        }
+        StaticViewProj = CurrentViewProj;
+        StaticBuildFrame = Frame;
+        bHasTemporalHistory = true;
+    }
+    else if (bIsCameraStill)
+    {
+        TemporalMode = "Reuse";
+        if (BufferType == EOcclusionBufferType::Masked)
+        {
+            MaskedTiles = StaticMaskedTiles;
+        }
+        else
+        {
+            CPU_ZBuffer = StaticZBuffer;
+        }
+    }
+    else
+    {
+        TemporalMode = "Reproject";
+        ReprojectStaticDepth();
+    }
+
+    if (!FrameDynamicOccluders.empty())
+    {
+        RasterizeOccluders(FrameDynamicOccluders, CameraPos);
+    }
+
+    if (BufferType == EOcclusionBufferType::Float)
+    {
+        BuildHiZPyramid();
+    }
+
+    // 3. 가시성 테스트 (지난 프레임에 보였던 오브젝트는 재검사 차례가 아니면 그대로 보이는 것으로 처리)
+    VisibleMeshComponents.clear();
+    NextVisibleComponents.clear();
+    int32 TestedCount = 0;
+    for (int32 Index = 0; Index < static_cast<int32>(CachedAABBs.size()); ++Index)
+    {
+        const FWorldAABBData& AABBData = CachedAABBs[Index];
+        const bool bIsRetestTurn = (Index + Frame) % TEMPORAL_VISIBLE_RETEST_INTERVAL == 0;
+        bool bIsVisible = !bShouldRebuild && !bIsRetestTurn && PreviousVisibleComponents.count(AABBData.Prim);
+
+        if (!bIsVisible)
+        {
+            ++TestedCount;
+            bIsVisible = IsMeshVisible(AABBData);
+        }
+
+        if (bIsVisible)
+        {
+            VisibleMeshComponents.push_back(TObjectPtr<UPrimitiveComponent>(AABBData.Prim));
+            NextVisibleComponents.insert(AABBData.Prim);
+        }
+    }
+    PreviousVisibleComponents.swap(NextVisibleComponents);
+
+    if (bIsReporting)
+    {
+        UE_LOG_INFO("Occlusion Temporal: %s | Static Occluders %zu, Dynamic Occluders %zu | Tested %d / %zu",
+            TemporalMode, StaticOccluders.size(), FrameDynamicOccluders.size(), TestedCount, CachedAABBs.size());
+    }
+
+    return VisibleMeshComponents;
+}
+
+void COcclusionCuller::ReprojectStaticDepth()
+{
+    fill(CPU_ZBuffer.begin(), CPU_ZBuffer.end(), 1.0f);
+
+    // 정적 버퍼의 NDC -> World -> 현재 Clip 공간
+    FMatrix InverseStaticViewProj;
+    if (!InvertMatrix(StaticViewProj, InverseStaticViewProj)) { return; }
+    const FMatrix Reprojection = InverseStaticViewProj * CurrentViewProj;
+
+    // 1. 모든 픽셀 중심을 현재 화면으로 변환
+    // 빈 픽셀, Near Plane 뒤로 간 픽셀, 가로/세로 이웃과 한 평면에 있지 않은 (실루엣) 픽셀은 W = 0으로 무효 처리
+    ReprojectedX.resize(Z_BUFFER_SIZE);
+    ReprojectedY.resize(Z_BUFFER_SIZE);
+    ReprojectedZ.resize(Z_BUFFER_SIZE);
+    ReprojectedW.resize(Z_BUFFER_SIZE);
+
+    const float HalfWidth = Z_BUFFER_WIDTH * 0.5f;
+    const float HalfHeight = Z_BUFFER_HEIGHT * 0.5f;
+    const float (*M)[4] = Reprojection.Data;
+    const float (*InvM)[4] = InverseStaticViewProj.Data;
+
+    for (int32 Y = 0; Y < Z_BUFFER_HEIGHT; ++Y)
+    {
+        const float NdcY = 1.0f - (Y + 0.5f) / HalfHeight;
+        for (int32 X = 0; X < Z_BUFFER_WIDTH; ++X)
+        {
+            const int32 Index = Y * Z_BUFFER_WIDTH + X;
+            const float NdcZ = StaticZBuffer[Index];
+            ReprojectedW[Index] = 0.0f;
+            if (NdcZ >= 1.0f) { continue; }
+            if (X == 0 || Y == 0 || X == Z_BUFFER_WIDTH - 1 || Y == Z_BUFFER_HEIGHT - 1) { continue; }
+
+            const float Left = StaticZBuffer[Index - 1], Right = StaticZBuffer[Index + 1];
+            const float Up = StaticZBuffer[Index - Z_BUFFER_WIDTH], Down = StaticZBuffer[Index + Z_BUFFER_WIDTH];
+            if (Left >= 1.0f || Right >= 1.0f || Up >= 1.0f || Down >= 1.0f) { continue; }
+            if (std::abs(Left + Right - 2.0f * NdcZ) > REPROJECTION_PLANE_TOLERANCE ||
+                std::abs(Up + Down - 2.0f * NdcZ) > REPROJECTION_PLANE_TOLERANCE)
+            {
+                continue;
+            }
+
+            const float NdcX = (X + 0.5f) / HalfWidth - 1.0f;
+            const float ClipW = NdcX * M[0][3] + NdcY * M[1][3] + NdcZ * M[2][3] + M[3][3];
+            if (ClipW <= 1e-6f) { continue; }
+
+            // (NDC, 1)을 역변환한 World 좌표는 1 / W_static 배로 스케일되어 있으므로, 불연속 판정에 쓸 실제 W로 되돌림
+            const float WorldW = NdcX * InvM[0][3] + NdcY * InvM[1][3] + NdcZ * InvM[2][3] + InvM[3][3];
+            if (WorldW <= 1e-12f) { continue; }
+
+            const float InvW = 1.0f / ClipW;
+            const float ClipX = NdcX * M[0][0] + NdcY * M[1][0] + NdcZ * M[2][0] + M[3][0];
+            const float ClipY = NdcX * M[0][1] + NdcY * M[1][1] + NdcZ * M[2][1] + M[3][1];
+            const float ClipZ = NdcX * M[0][2] + NdcY * M[1][2] + NdcZ * M[2][2] + M[3][2];
+            ReprojectedX[Index] = (ClipX * InvW + 1.0f) * HalfWidth;
+            ReprojectedY[Index] = (1.0f - ClipY * InvW) * HalfHeight;
+            ReprojectedZ[Index] = ClipZ * InvW;
+            ReprojectedW[Index] = ClipW / WorldW;
+        }
+    }
+
+    // 2. 인접한 4개 픽셀 중심으로 이루어진 쿼드를 두 삼각형으로 래스터라이징
+    for (int32 Y = 0; Y < Z_BUFFER_HEIGHT - 1; ++Y)
+    {
+        for (int32 X = 0; X < Z_BUFFER_WIDTH - 1; ++X)
+        {
+            // 0 1
+            // 2 3
+            const int32 Corner[4] = { Y * Z_BUFFER_WIDTH + X, Y * Z_BUFFER_WIDTH + X + 1, (Y + 1) * Z_BUFFER_WIDTH + X, (Y + 1) * Z_BUFFER_WIDTH + X + 1 };
+
+            float MinW = FLT_MAX, MaxW = 0.0f;
+            float MinX = FLT_MAX, MaxX = -FLT_MAX, MinY = FLT_MAX, MaxY = -FLT_MAX, QuadZ = 0.0f;
+            for (int32 Index : Corner)
+            {
+                MinW = min(MinW, ReprojectedW[Index]);
+                MaxW = max(MaxW, ReprojectedW[Index]);
+                MinX = min(MinX, ReprojectedX[Index]);
+                MaxX = max(MaxX, ReprojectedX[Index]);
+                MinY = min(MinY, ReprojectedY[Index]);
+                MaxY = max(MaxY, ReprojectedY[Index]);
+                QuadZ = max(QuadZ, ReprojectedZ[Index]);
+            }
+            if (MinW <= 0.0f || MaxW > MinW * REPROJECTION_MAX_DEPTH_RATIO) { continue; }
+
+            // 대각 방향 (Z0 + Z3 == Z1 + Z2)
+            const float PlaneError = StaticZBuffer[Corner[0]] + StaticZBuffer[Corner[3]] - StaticZBuffer[Corner[1]] - StaticZBuffer[Corner[2]];
+            if (std::abs(PlaneError) > REPROJECTION_PLANE_TOLERANCE) { continue; }
+
+            // 픽셀 중심이 쿼드 바운딩 박스 안에 있는 범위
+            const int32 PixelMinX = max(static_cast<int32>(std::ceil(MinX - 0.5f)), 0);
+            const int32 PixelMaxX = min(static_cast<int32>(std::floor(MaxX - 0.5f)), Z_BUFFER_WIDTH - 1);
+            const int32 PixelMinY = max(static_cast<int32>(std::ceil(MinY - 0.5f)), 0);
+            const int32 PixelMaxY = min(static_cast<int32>(std::floor(MaxY - 0.5f)), Z_BUFFER_HEIGHT - 1);
+            if (PixelMinX > PixelMaxX || PixelMinY > PixelMaxY) { continue; }
+
+            const float PX[4] = { ReprojectedX[Corner[0]], ReprojectedX[Corner[1]], ReprojectedX[Corner[2]], ReprojectedX[Corner[3]] };
+            const float PY[4] = { ReprojectedY[Corner[0]], ReprojectedY[Corner[1]], ReprojectedY[Corner[2]], ReprojectedY[Corner[3]] };
+            constexpr int32 QuadTriangles[2][3] = { { 0, 1, 3 }, { 0, 3, 2 } };
+
+            for (int32 PixelY = PixelMinY; PixelY <= PixelMaxY; ++PixelY)
+            {
+                for (int32 PixelX = PixelMinX; PixelX <= PixelMaxX; ++PixelX)
+                {
+                    const float SampleX = PixelX + 0.5f;
+                    const float SampleY = PixelY + 0.5f;
+
+                    bool bIsInside = false;
+                    for (const auto& Triangle : QuadTriangles)
+                    {
+                        // 재투영 후 방향이 뒤집힐 수 있으므로 부호와 무관하게 판정
+                        float Edge[3];
+                        for (int32 Vertex = 0; Vertex < 3; ++Vertex)
+                        {
+                            const int32 A = Triangle[Vertex];
+                            const int32 B = Triangle[(Vertex + 1) % 3];
+                            Edge[Vertex] = (PX[B] - PX[A]) * (SampleY - PY[A]) - (PY[B] - PY[A]) * (SampleX - PX[A]);
+                        }
+                        if ((Edge[0] >= 0.0f && Edge[1] >= 0.0f && Edge[2] >= 0.0f) ||
+                            (Edge[0] <= 0.0f && Edge[1] <= 0.0f && Edge[2] <= 0.0f))
+                        {
+                            bIsInside = true;
+                            break;
+                        }
+                    }
+
+                    if (bIsInside)
+                    {
+                        float& Depth = CPU_ZBuffer[PixelY * Z_BUFFER_WIDTH + PixelX];
+                        Depth = min(Depth, QuadZ);
+                    }
+                }
+            }
+        }
+    }
+}
+
 TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
 {
     FilteredOccluders.clear();
@@ -80,147 +528,545 @@ TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPri
 
 void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos)
 {
+    bIsCollectingTileStats = bIsTileStatsRequested;
+    bIsTileStatsRequested = false;
+
+    // 1. 모든 오클루더 정점을 한 번에 투영
+    ProjectOccluderVertices(SelectedOccluders);
+
+    // 2. 삼각형 Setup 및 타일 Binning
+    SetupAndBinTriangles();
+
+    // 3. 타일 단위 병렬 래스터라이징
+    const bool bIsMasked = BufferType == EOcclusionBufferType::Masked;
+    FTaskScheduler::GetInstance().ParallelFor(TileCountX * TileCountY, [this, bIsMasked](int32 TileIndex)
+    {
+        if (bIsMasked)
+        {
+            RasterizeMaskedTile(TileIndex);
+        }
+        else
+        {
+            RasterizeTile(TileIndex);
+        }
+    });
+
+    if (bIsCollectingTileStats)
+    {
+        LogTileStats();
+        bIsCollectingTileStats = false;
+    }
+}
+
+void COcclusionCuller::ProjectOccluderVertices(const TArray<UPrimitiveComponent*>& SelectedOccluders)
+{
+    OccluderVertexX.clear();
+    OccluderVertexY.clear();
+    OccluderVertexZ.clear();
+
     for (UPrimitiveComponent* OccluderComp : SelectedOccluders)
     {
-        if (OccluderComp->CachedFrame != Frame) { continue; }
-        // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
+        if (!OccluderComp || OccluderComp->CachedFrame != Frame) { continue; }
+
+        const FWorldAABBData& Data = CachedAABBs[OccluderComp->CachedAABBIndex];
+        const FVector& WorldCenter = Data.Center;
+        FVector Extent = (Data.Min - Data.Max) * 0.5f;
+
+        constexpr float OccluderScale = 0.5f;
+
+        FVector WorldMin = WorldCenter - Extent * OccluderScale;
+        FVector WorldMax = WorldCenter + Extent * OccluderScale;
+
+        // AABB의 8개 정점 (000, 100, 110, 010, 001, 101, 111, 011)
+        const float CornerX[8] = { WorldMin.X, WorldMax.X, WorldMax.X, WorldMin.X, WorldMin.X, WorldMax.X, WorldMax.X, WorldMin.X };
+        const float CornerY[8] = { WorldMin.Y, WorldMin.Y, WorldMax.Y, WorldMax.Y, WorldMin.Y, WorldMin.Y, WorldMax.Y, WorldMax.Y };
+        const float CornerZ[8] = { WorldMin.Z, WorldMin.Z, WorldMin.Z, WorldMin.Z, WorldMax.Z, WorldMax.Z, WorldMax.Z, WorldMax.Z };
+
+        OccluderVertexX.insert(OccluderVertexX.end(), CornerX, CornerX + 8);
+        OccluderVertexY.insert(OccluderVertexY.end(), CornerY, CornerY + 8);
+        OccluderVertexZ.insert(OccluderVertexZ.end(), CornerZ, CornerZ + 8);
+    }
+
+    // 오클루더당 정점이 8개이므로 SoA 배열은 항상 4의 배수
+    const size_t VertexCount = OccluderVertexX.size();
+    ProjectedX.resize(VertexCount);
+    ProjectedY.resize(VertexCount);
+    ProjectedZ.resize(VertexCount);
+    ProjectedValid.resize(VertexCount);
+
+    for (size_t Base = 0; Base < VertexCount; Base += 4)
+    {
+        BatchProjectionInput Input;
+        Input.WorldX = _mm_loadu_ps(&OccluderVertexX[Base]);
+        Input.WorldY = _mm_loadu_ps(&OccluderVertexY[Base]);
+        Input.WorldZ = _mm_loadu_ps(&OccluderVertexZ[Base]);
+
+        BatchProjectionResult ProjectionResult = BatchProject4(Input);
 
-        // 2. CPU 래스터라이징
-        for (uint32 Idx = 0; Idx < BoxTriangles.size(); Idx += 3)
+        _mm_storeu_ps(&ProjectedX[Base], ProjectionResult.ScreenX);
+        _mm_storeu_ps(&ProjectedY[Base], ProjectionResult.ScreenY);
+        _mm_storeu_ps(&ProjectedZ[Base], ProjectionResult.ScreenZ);
+
+        const int32 ValidBits = _mm_movemask_ps(ProjectionResult.ValidMask);
+        for (int32 Lane = 0; Lane < 4; ++Lane)
         {
-            // 삼각형의 세 정점 (월드 좌표)
-            const FVector& P1_World = BoxTriangles[Idx];
-            const FVector& P2_World = BoxTriangles[Idx + 1];
-            const FVector& P3_World = BoxTriangles[Idx + 2];
-
-            // 정점을 화면 좌표로 투영
-            FVector P1_Screen = Project(P1_World);
-            FVector P2_Screen = Project(P2_World);
-            FVector P3_Screen = Project(P3_World);
-
-            // Backface Culling
-            FVector2 V1(P2_Screen.X - P1_Screen.X, P2_Screen.Y - P1_Screen.Y);
-            FVector2 V2(P3_Screen.X - P1_Screen.X, P3_Screen.Y - P1_Screen.Y);
-
-            // 2D 외적 (Z 성분만)
-            float CrossZ = V1.X * V2.Y - V1.Y * V2.X;
-            if (CrossZ < 0.0f) { continue; }
-
-            // Z-Buffer에 깊이 쓰기
-            RasterizeTriangle(P1_Screen, P2_Screen, P3_Screen, CPU_ZBuffer);
+            ProjectedValid[Base + Lane] = static_cast<uint8>((ValidBits >> Lane) & 1);
+        }
+    }
+}
+
+void COcclusionCuller::SetupAndBinTriangles()
+{
+    ScreenTriangles.clear();
+    for (TArray<int32>& Bin : TileBins) { Bin.clear(); }
+
+    const size_t OccluderCount = ProjectedX.size() / 8;
+    for (size_t Occluder = 0; Occluder < OccluderCount; ++Occluder)
+    {
+        const size_t VertexBase = Occluder * 8;
+
+        for (int32 Idx = 0; Idx < 36; Idx += 3)
+        {
+            const size_t I1 = VertexBase + BoxTriangleIndices[Idx];
+            const size_t I2 = VertexBase + BoxTriangleIndices[Idx + 1];
+            const size_t I3 = VertexBase + BoxTriangleIndices[Idx + 2];
+
+            // Near Plane 뒤의 정점이 있는 삼각형은 투영이 올바르지 않으므로 오클루더에서 제외 (보수적)
+            if (!ProjectedValid[I1] || !ProjectedValid[I2] || !ProjectedValid[I3]) { continue; }
+
+            const float X1 = ProjectedX[I1], Y1 = ProjectedY[I1], Z1 = ProjectedZ[I1];
+            const float X2 = ProjectedX[I2], Y2 = ProjectedY[I2], Z2 = ProjectedZ[I2];
+            const float X3 = ProjectedX[I3], Y3 = ProjectedY[I3], Z3 = ProjectedZ[I3];
+
+            // Backface Culling (2D 외적의 Z 성분) 및 Degenerate Triangle 제외
+            const float CrossZ = (X2 - X1) * (Y3 - Y1) - (Y2 - Y1) * (X3 - X1);
+            if (CrossZ < 0.002f) { continue; }
+
+            FOccluderTriangle Triangle;
+            Triangle.MinX = max(0, static_cast<int32>(min({ X1, X2, X3 })));
+            Triangle.MaxX = min(BufferWidth - 1, static_cast<int32>(max({ X1, X2, X3 })));
+            Triangle.MinY = max(0, static_cast<int32>(min({ Y1, Y2, Y3 })));
+            Triangle.MaxY = min(BufferHeight - 1, static_cast<int32>(max({ Y1, Y2, Y3 })));
+            if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY) { continue; }
+
+            // Edge Function: Lambda_i는 정점 i의 맞은편 Edge에 대한 Barycentric 좌표
+            const float InvArea = 1.0f / CrossZ;
+            const float EdgeStartX[3] = { X2, X3, X1 };
+            const float EdgeStartY[3] = { Y2, Y3, Y1 };
+            const float EdgeEndX[3] = { X3, X1, X2 };
+            const float EdgeEndY[3] = { Y3, Y1, Y2 };
+            for (int32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const float DeltaX = EdgeEndX[Edge] - EdgeStartX[Edge];
+                const float DeltaY = EdgeEndY[Edge] - EdgeStartY[Edge];
+                Triangle.EdgeA[Edge] = -DeltaY * InvArea;
+                Triangle.EdgeB[Edge] = DeltaX * InvArea;
+                Triangle.EdgeC[Edge] = (DeltaY * EdgeStartX[Edge] - DeltaX * EdgeStartY[Edge]) * InvArea;
+            }
+
+            // 깊이 평면: Z = Lambda1 * Z1 + Lambda2 * Z2 + Lambda3 * Z3
+            Triangle.DepthA = Triangle.EdgeA[0] * Z1 + Triangle.EdgeA[1] * Z2 + Triangle.EdgeA[2] * Z3;
+            Triangle.DepthB = Triangle.EdgeB[0] * Z1 + Triangle.EdgeB[1] * Z2 + Triangle.EdgeB[2] * Z3;
+            Triangle.DepthC = Triangle.EdgeC[0] * Z1 + Triangle.EdgeC[1] * Z2 + Triangle.EdgeC[2] * Z3;
+            Triangle.MinZ = min({ Z1, Z2, Z3 });
+            Triangle.MaxZ = max({ Z1, Z2, Z3 });
+
+            const int32 TriangleIndex = static_cast<int32>(ScreenTriangles.size());
+            ScreenTriangles.push_back(Triangle);
+
+            // 바운딩 박스가 걸치는 타일에 Binning
+            const int32 TileMinX = Triangle.MinX / TILE_WIDTH;
+            const int32 TileMaxX = Triangle.MaxX / TILE_WIDTH;
+            const int32 TileMinY = Triangle.MinY / TILE_HEIGHT;
+            const int32 TileMaxY = Triangle.MaxY / TILE_HEIGHT;
+            for (int32 TileY = TileMinY; TileY <= TileMaxY; ++TileY)
+            {
+                for (int32 TileX = TileMinX; TileX <= TileMaxX; ++TileX)
+                {
+                    TileBins[TileY * TileCountX + TileX].push_back(TriangleIndex);
+                }
+            }
+        }
+    }
+}
+
+void COcclusionCuller::RasterizeTile(int32 TileIndex)
+{
+    const uint64 StartCycles = bIsCollectingTileStats ? FPlatformTime::Cycles64() : 0;
+
+    const int32 TileMinX = (TileIndex % TileCountX) * TILE_WIDTH;
+    const int32 TileMinY = (TileIndex / TileCountX) * TILE_HEIGHT;
+    const int32 TileMaxX = TileMinX + TILE_WIDTH - 1;
+    const int32 TileMaxY = TileMinY + TILE_HEIGHT - 1;
+
+    const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 Epsilon = _mm_set1_ps(-0.0001f); // 경계 케이스 처리
+    float* ZBuffer = CPU_ZBuffer.data();
+
+    const TArray<int32>& Bin = TileBins[TileIndex];
+    for (int32 TriangleIndex : Bin)
+    {
+        const FOccluderTriangle& Triangle = ScreenTriangles[TriangleIndex];
+
+        // 타일 영역으로 클리핑, X 시작점은 SIMD 폭(4)에 맞춰 정렬 (타일 원점이 4의 배수이므로 타일 밖으로 나가지 않음)
+        const int32 MinX = max(Triangle.MinX, TileMinX) & ~3;
+        const int32 MaxX = min(Triangle.MaxX, TileMaxX);
+        const int32 MinY = max(Triangle.MinY, TileMinY);
+        const int32 MaxY = min(Triangle.MaxY, TileMaxY);
+
+        const __m128 A0 = _mm_set1_ps(Triangle.EdgeA[0]), B0 = _mm_set1_ps(Triangle.EdgeB[0]), C0 = _mm_set1_ps(Triangle.EdgeC[0]);
+        const __m128 A1 = _mm_set1_ps(Triangle.EdgeA[1]), B1 = _mm_set1_ps(Triangle.EdgeB[1]), C1 = _mm_set1_ps(Triangle.EdgeC[1]);
+        const __m128 A2 = _mm_set1_ps(Triangle.EdgeA[2]), B2 = _mm_set1_ps(Triangle.EdgeB[2]), C2 = _mm_set1_ps(Triangle.EdgeC[2]);
+        const __m128 ZA = _mm_set1_ps(Triangle.DepthA), ZB = _mm_set1_ps(Triangle.DepthB), ZC = _mm_set1_ps(Triangle.DepthC);
+
+        for (int32 Y = MinY; Y <= MaxY; ++Y)
+        {
+            // 행 시작점의 Edge 값 (픽셀 중심 기준), 이후 X 방향으로 4픽셀씩 증분
+            const __m128 PixelY = _mm_set1_ps(Y + 0.5f);
+            const __m128 PixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(MinX)), LaneOffset);
+
+            __m128 Lambda0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(A0, PixelX), _mm_mul_ps(B0, PixelY)), C0);
+            __m128 Lambda1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(A1, PixelX), _mm_mul_ps(B1, PixelY)), C1);
+            __m128 Lambda2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(A2, PixelX), _mm_mul_ps(B2, PixelY)), C2);
+            __m128 Depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ZA, PixelX), _mm_mul_ps(ZB, PixelY)), ZC);
+
+            const __m128 Step = _mm_set1_ps(4.0f);
+            const __m128 Lambda0Step = _mm_mul_ps(A0, Step);
+            const __m128 Lambda1Step = _mm_mul_ps(A1, Step);
+            const __m128 Lambda2Step = _mm_mul_ps(A2, Step);
+            const __m128 DepthStep = _mm_mul_ps(ZA, Step);
+
+            float* Row = ZBuffer + Y * Z_BUFFER_WIDTH;
+            for (int32 X = MinX; X <= MaxX; X += 4)
+            {
+                const __m128 Inside = _mm_and_ps(
+                    _mm_and_ps(_mm_cmpge_ps(Lambda0, Epsilon), _mm_cmpge_ps(Lambda1, Epsilon)),
+                    _mm_cmpge_ps(Lambda2, Epsilon));
+
+                if (_mm_movemask_ps(Inside) != 0)
+                {
+                    // 깊이 테스트 및 업데이트
+                    const __m128 OldDepth = _mm_loadu_ps(Row + X);
+                    const __m128 WriteMask = _mm_and_ps(Inside, _mm_cmplt_ps(Depth, OldDepth));
+                    _mm_storeu_ps(Row + X, _mm_or_ps(_mm_and_ps(WriteMask, Depth), _mm_andnot_ps(WriteMask, OldDepth)));
+                }
+
+                Lambda0 = _mm_add_ps(Lambda0, Lambda0Step);
+                Lambda1 = _mm_add_ps(Lambda1, Lambda1Step);
+                Lambda2 = _mm_add_ps(Lambda2, Lambda2Step);
+                Depth = _mm_add_ps(Depth, DepthStep);
+            }
+        }
+    }
+
+    if (bIsCollectingTileStats)
+    {
+        TileStats[TileIndex].TriangleCount = static_cast<uint32>(Bin.size());
+        TileStats[TileIndex].Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+}
+
+void COcclusionCuller::RasterizeMaskedTile(int32 TileIndex)
+{
+    const uint64 StartCycles = bIsCollectingTileStats ? FPlatformTime::Cycles64() : 0;
+
+    const int32 TileMinX = (TileIndex % TileCountX) * TILE_WIDTH;
+    const int32 TileMinY = (TileIndex / TileCountX) * TILE_HEIGHT;
+    const int32 MaskedTileX = TileMinX / MASKED_TILE_WIDTH;
+
+    const __m256 RowOffset = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    const __m256i AllOnes = _mm256_set1_epi32(-1);
+    const __m256i Zero = _mm256_setzero_si256();
+    const __m256 Epsilon = _mm256_set1_ps(-0.0001f); // 경계 케이스 처리 (Float 래스터라이저와 동일)
+
+    const TArray<int32>& Bin = TileBins[TileIndex];
+    for (int32 TriangleIndex : Bin)
+    {
+        const FOccluderTriangle& Triangle = ScreenTriangles[TriangleIndex];
+
+        for (int32 SubTileY = TileMinY; SubTileY < TileMinY + TILE_HEIGHT; SubTileY += MASKED_TILE_HEIGHT)
+        {
+            const int32 MinY = max(Triangle.MinY, SubTileY);
+            const int32 MaxY = min(Triangle.MaxY, SubTileY + MASKED_TILE_HEIGHT - 1);
+            if (MinY > MaxY) { continue; }
+
+            FMaskedOcclusionTile& Tile = MaskedTiles[(SubTileY / MASKED_TILE_HEIGHT) * MaskedTileCountX + MaskedTileX];
+
+            // 타일과 삼각형 바운딩 박스가 겹치는 영역에서 깊이 평면의 범위 (모서리에서 극값, 정점 깊이 범위로 클램프)
+            const float MinX = max(Triangle.MinX, TileMinX) + 0.5f;
+            const float MaxX = min(Triangle.MaxX, TileMinX + MASKED_TILE_WIDTH - 1) + 0.5f;
+            const float DepthAtMinX = Triangle.DepthA * MinX;
+            const float DepthAtMaxX = Triangle.DepthA * MaxX;
+            const float DepthAtMinY = Triangle.DepthB * (MinY + 0.5f) + Triangle.DepthC;
+            const float DepthAtMaxY = Triangle.DepthB * (MaxY + 0.5f) + Triangle.DepthC;
+            const float TriZMin = max(min(DepthAtMinX, DepthAtMaxX) + min(DepthAtMinY, DepthAtMaxY), Triangle.MinZ);
+            const float TriZMax = min(max(DepthAtMinX, DepthAtMaxX) + max(DepthAtMinY, DepthAtMaxY), Triangle.MaxZ);
+
+            // Reference Layer보다 완전히 뒤에 있으면 갱신할 정보가 없음
+            if (TriZMin >= Tile.ZMax0) { continue; }
+
+            // 행(Lane)별로 [FirstX, LastX] 구간을 구함: 픽셀 X는 A * (X + 0.5) + B * Y + C >= Epsilon 일 때 내부
+            const __m256 PixelY = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(SubTileY)), RowOffset);
+            const __m256 LocalOffset = _mm256_set1_ps(TileMinX + 0.5f);
+            __m256i FirstX = Zero;
+            __m256i LastX = _mm256_set1_epi32(MASKED_TILE_WIDTH - 1);
+
+            for (int32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const float A = Triangle.EdgeA[Edge];
+                const __m256 Rhs = _mm256_sub_ps(Epsilon,
+                    _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Triangle.EdgeB[Edge]), PixelY), _mm256_set1_ps(Triangle.EdgeC[Edge])));
+
+                if (A == 0.0f)
+                {
+                    // 수평 Edge: 행 전체가 안 또는 밖
+                    const __m256i Outside = _mm256_castps_si256(_mm256_cmp_ps(Rhs, _mm256_setzero_ps(), _CMP_GT_OQ));
+                    FirstX = _mm256_blendv_epi8(FirstX, _mm256_set1_epi32(MASKED_TILE_WIDTH), Outside);
+                    continue;
+                }
+
+                __m256 Bound = _mm256_sub_ps(_mm256_mul_ps(Rhs, _mm256_set1_ps(1.0f / A)), LocalOffset);
+                Bound = _mm256_min_ps(_mm256_max_ps(Bound, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(static_cast<float>(MASKED_TILE_WIDTH)));
+                if (A > 0.0f)
+                {
+                    FirstX = _mm256_max_epi32(FirstX, _mm256_cvttps_epi32(_mm256_ceil_ps(Bound)));
+                }
+                else
+                {
+                    LastX = _mm256_min_epi32(LastX, _mm256_cvttps_epi32(_mm256_floor_ps(Bound)));
+                }
+            }
+
+            // [FirstX, LastX] -> 비트 마스크 (시프트 양이 32 이상이면 0이 되므로 빈 구간은 자연스럽게 0)
+            const __m256i Coverage = _mm256_and_si256(
+                _mm256_sllv_epi32(AllOnes, FirstX),
+                _mm256_srlv_epi32(AllOnes, _mm256_sub_epi32(_mm256_set1_epi32(MASKED_TILE_WIDTH - 1), LastX)));
+            if (_mm256_testz_si256(Coverage, Coverage)) { continue; }
+
+            // Working Layer 병합 (삼각형이 Working Layer보다 Reference 쪽에 더 가까우면 Working Layer를 버리고 새로 시작)
+            __m256i TileMask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Tile.Mask));
+            if (Tile.ZMax1 - TriZMax > Tile.ZMax0 - Tile.ZMax1)
+            {
+                Tile.ZMax1 = 0.0f;
+                TileMask = Zero;
+            }
+            Tile.ZMax1 = max(Tile.ZMax1, TriZMax);
+            TileMask = _mm256_or_si256(TileMask, Coverage);
+
+            // Working Layer가 타일 전체를 덮으면 Reference Layer로 승격
+            if (_mm256_testc_si256(TileMask, AllOnes))
+            {
+                Tile.ZMax0 = min(Tile.ZMax0, Tile.ZMax1);
+                Tile.ZMax1 = 0.0f;
+                TileMask = Zero;
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(Tile.Mask), TileMask);
         }
     }
+
+    if (bIsCollectingTileStats)
+    {
+        TileStats[TileIndex].TriangleCount = static_cast<uint32>(Bin.size());
+        TileStats[TileIndex].Milliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
 }
 
-FVector COcclusionCuller::Project(const FVector& WorldPos) const
+void COcclusionCuller::LogTileStats() const
 {
-    FVector4 WorldPos4(WorldPos.X, WorldPos.Y, WorldPos.Z, 1.0f);
-    FVector4 ClipPos = WorldPos4 * CurrentViewProj;
+    uint32 MinCount = UINT32_MAX, MaxCount = 0, TotalCount = 0;
+    double MaxMs = 0.0, TotalMs = 0.0;
+
+    UE_LOG_SYSTEM("Occlusion Tile Stats (%s %dx%d, %dx%d tiles, %d threads, %zu triangles)",
+        BufferType == EOcclusionBufferType::Masked ? "Masked" : "Float", BufferWidth, BufferHeight,
+        TileCountX, TileCountY, FTaskScheduler::GetInstance().GetThreadCount(), ScreenTriangles.size());
 
-    if (ClipPos.W != 0.0f)
+    for (int32 TileY = 0; TileY < TileCountY; ++TileY)
     {
-        ClipPos.X /= ClipPos.W;
-        ClipPos.Y /= ClipPos.W;
-        ClipPos.Z /= ClipPos.W;
+        char Line[1024];
+        int32 Offset = 0;
+        for (int32 TileX = 0; TileX < TileCountX; ++TileX)
+        {
+            const FOcclusionTileStats& Stats = TileStats[TileY * TileCountX + TileX];
+            if (Offset < static_cast<int32>(sizeof(Line)) - 16)
+            {
+                Offset += snprintf(Line + Offset, sizeof(Line) - Offset, "%5u/%.3f ", Stats.TriangleCount, Stats.Milliseconds);
+            }
+
+            MinCount = min(MinCount, Stats.TriangleCount);
+            MaxCount = max(MaxCount, Stats.TriangleCount);
+            TotalCount += Stats.TriangleCount;
+            MaxMs = max(MaxMs, Stats.Milliseconds);
+            TotalMs += Stats.Milliseconds;
+        }
+        UE_LOG("  %s", Line);
     }
 
-    // NDC to Screen
-    float ScreenX = (ClipPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
-    float ScreenY = (1.0f - ClipPos.Y) * 0.5f * Z_BUFFER_HEIGHT;
-    float ScreenZ = ClipPos.Z;
+    const int32 TileCount = TileCountX * TileCountY;
+    const double AverageCount = static_cast<double>(TotalCount) / TileCount;
+    const double AverageMs = TotalMs / TileCount;
+    UE_LOG_INFO("Triangles/Tile Min %u, Max %u, Avg %.1f | Time/Tile Max %.3f ms, Avg %.3f ms, Sum %.3f ms | Imbalance(Max/Avg) %.2f",
+        MinCount, MaxCount, AverageCount, MaxMs, AverageMs, TotalMs, AverageMs > 0.0 ? MaxMs / AverageMs : 0.0);
+}
+
+void COcclusionCuller::BuildHiZPyramid()
+{
+    // Level 0은 CPU Z-Buffer 그대로 복사하고, 상위 레벨은 2x2 texel의 최대 깊이로 축소
+    memcpy(HiZPyramid.data(), CPU_ZBuffer.data(), sizeof(float) * Z_BUFFER_SIZE);
 
-    return FVector(ScreenX, ScreenY, ScreenZ);
+    for (int32 Level = 1; Level < HI_Z_LEVEL_COUNT; ++Level)
+    {
+        const int32 SrcWidth = Z_BUFFER_WIDTH >> (Level - 1);
+        const int32 DstWidth = Z_BUFFER_WIDTH >> Level;
+        const int32 DstHeight = Z_BUFFER_HEIGHT >> Level;
+        const float* Src = HiZPyramid.data() + HiZLevelOffsets[Level - 1];
+        float* Dst = HiZPyramid.data() + HiZLevelOffsets[Level];
+
+        for (int32 Y = 0; Y < DstHeight; ++Y)
+        {
+            const float* SrcRow0 = Src + (Y * 2) * SrcWidth;
+            const float* SrcRow1 = SrcRow0 + SrcWidth;
+            float* DstRow = Dst + Y * DstWidth;
+
+            int32 X = 0;
+            // 원본 8 texel -> 결과 4 texel 단위로 SIMD 처리
+            for (; X + 4 <= DstWidth; X += 4)
+            {
+                __m128 Low = _mm_max_ps(_mm_loadu_ps(SrcRow0 + X * 2), _mm_loadu_ps(SrcRow1 + X * 2));
+                __m128 High = _mm_max_ps(_mm_loadu_ps(SrcRow0 + X * 2 + 4), _mm_loadu_ps(SrcRow1 + X * 2 + 4));
+                __m128 Even = _mm_shuffle_ps(Low, High, _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 Odd = _mm_shuffle_ps(Low, High, _MM_SHUFFLE(3, 1, 3, 1));
+                _mm_storeu_ps(DstRow + X, _mm_max_ps(Even, Odd));
+            }
+            for (; X < DstWidth; ++X)
+            {
+                DstRow[X] = max(max(SrcRow0[X * 2], SrcRow0[X * 2 + 1]), max(SrcRow1[X * 2], SrcRow1[X * 2 + 1]));
+            }
+        }
+    }
 }
 
 bool COcclusionCuller::IsMeshVisible(const FWorldAABBData& AABBData)
 {
     const FVector& WorldMin = AABBData.Min;
     const FVector& WorldMax = AABBData.Max;
-    const FVector& WorldCenter = AABBData.Center;
-
-    constexpr int32 NumSamples = 19;
-    FVector OriginalSamplesArray[NumSamples];
-    int32 Index = 0; // 배열 인덱스 카운터
-
-    // 1개 중심점
-    OriginalSamplesArray[Index++] = WorldCenter;
 
-    // 6개 면 중심
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldCenter.Y, WorldMax.Z);
+    // 1. AABB 8개 코너를 4개씩 두 번에 투영
+    BatchProjectionInput Input;
+    Input.WorldX = _mm_setr_ps(WorldMin.X, WorldMax.X, WorldMax.X, WorldMin.X);
+    Input.WorldY = _mm_setr_ps(WorldMin.Y, WorldMin.Y, WorldMax.Y, WorldMax.Y);
+    Input.WorldZ = _mm_set1_ps(WorldMin.Z);
+    BatchProjectionResult Near = BatchProject4(Input);
 
-    // 12개 엣지 중심
-    // X 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldCenter.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldCenter.Y, WorldMax.Z);
+    Input.WorldZ = _mm_set1_ps(WorldMax.Z);
+    BatchProjectionResult Far = BatchProject4(Input);
 
-    // Y 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMin.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMin.Y, WorldMax.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldCenter.X, WorldMax.Y, WorldMax.Z);
+    // Near Plane 뒤에 있는 코너가 있으면 사각형을 신뢰할 수 없으므로 보이는 것으로 처리 (보수적)
+    if (_mm_movemask_ps(_mm_and_ps(Near.ValidMask, Far.ValidMask)) != 0xF)
+    {
+        return true;
+    }
 
-    // Z 엣지 (4개)
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMin.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMin.X, WorldMax.Y, WorldCenter.Z);
-    OriginalSamplesArray[Index++] = FVector(WorldMax.X, WorldMax.Y, WorldCenter.Z);
+    // 2. 스크린 사각형과 가장 가까운 깊이 계산
+    __m128 MinX4 = _mm_min_ps(Near.ScreenX, Far.ScreenX);
+    __m128 MaxX4 = _mm_max_ps(Near.ScreenX, Far.ScreenX);
+    __m128 MinY4 = _mm_min_ps(Near.ScreenY, Far.ScreenY);
+    __m128 MaxY4 = _mm_max_ps(Near.ScreenY, Far.ScreenY);
+    __m128 MinZ4 = _mm_min_ps(Near.ScreenZ, Far.ScreenZ);
+
+    alignas(16) float Reduced[5][4];
+    _mm_store_ps(Reduced[0], MinX4);
+    _mm_store_ps(Reduced[1], MaxX4);
+    _mm_store_ps(Reduced[2], MinY4);
+    _mm_store_ps(Reduced[3], MaxY4);
+    _mm_store_ps(Reduced[4], MinZ4);
+
+    const float RectMinX = min(min(Reduced[0][0], Reduced[0][1]), min(Reduced[0][2], Reduced[0][3]));
+    const float RectMaxX = max(max(Reduced[1][0], Reduced[1][1]), max(Reduced[1][2], Reduced[1][3]));
+    const float RectMinY = min(min(Reduced[2][0], Reduced[2][1]), min(Reduced[2][2], Reduced[2][3]));
+    const float RectMaxY = max(max(Reduced[3][0], Reduced[3][1]), max(Reduced[3][2], Reduced[3][3]));
+    const float NearestZ = min(min(Reduced[4][0], Reduced[4][1]), min(Reduced[4][2], Reduced[4][3]));
+
+    // 화면 밖에 있는 경우는 프러스텀 컬링 결과를 따름 (보수적)
+    if (RectMaxX < 0.0f || RectMaxY < 0.0f || RectMinX >= BufferWidth || RectMinY >= BufferHeight)
+    {
+        return true;
+    }
 
-    // SIMD 배치 처리를 위해 20개로 패딩
-    const int32 BatchCount = (NumSamples + 3) / 4;
+    const int32 PixelMinX = max(static_cast<int32>(RectMinX), 0);
+    const int32 PixelMinY = max(static_cast<int32>(RectMinY), 0);
+    const int32 PixelMaxX = min(static_cast<int32>(RectMaxX), BufferWidth - 1);
+    const int32 PixelMaxY = min(static_cast<int32>(RectMaxY), BufferHeight - 1);
 
-    for (int32 i = 0; i < 19; ++i)
+    if (BufferType == EOcclusionBufferType::Masked)
     {
-        SampleCoords[0][i] = OriginalSamplesArray[i].X;  // X
-        SampleCoords[1][i] = OriginalSamplesArray[i].Y;  // Y
-        SampleCoords[2][i] = OriginalSamplesArray[i].Z;  // Z
+        return IsRectVisibleMasked(PixelMinX, PixelMinY, PixelMaxX, PixelMaxY, NearestZ);
     }
+    return IsRectVisibleHiZ(PixelMinX, PixelMinY, PixelMaxX, PixelMaxY, NearestZ);
+}
 
-    // 패딩
-    for (int32 i = 19; i < 20; ++i)
+bool COcclusionCuller::IsRectVisibleHiZ(int32 PixelMinX, int32 PixelMinY, int32 PixelMaxX, int32 PixelMaxY, float NearestZ) const
+{
+    // 사각형이 약 2x2 texel을 덮는 Mip Level 선택
+    const int32 Extent = max(PixelMaxX - PixelMinX, PixelMaxY - PixelMinY) + 1;
+    int32 Level = 0;
+    while (Level < HI_Z_LEVEL_COUNT - 1 && Extent > (2 << Level))
     {
-        SampleCoords[0][i] = 1e30f;
-        SampleCoords[1][i] = 1e30f;
-        SampleCoords[2][i] = 1e30f;
+        ++Level;
     }
 
+    // 덮이는 texel(최대 3x3)의 최대 깊이보다 가까우면 보임
     constexpr float Z_TOLERANCE = 0.001f;
-    for (int32 BatchIdx = 0; BatchIdx < BatchCount; ++BatchIdx)
-    {
-        BatchProjectionInput Input;
-        Input.WorldX = _mm_load_ps(&SampleCoords[0][BatchIdx * 4]);
-        Input.WorldY = _mm_load_ps(&SampleCoords[1][BatchIdx * 4]);
-        Input.WorldZ = _mm_load_ps(&SampleCoords[2][BatchIdx * 4]);
+    const float TestZ = NearestZ - Z_TOLERANCE;
+    const int32 LevelWidth = Z_BUFFER_WIDTH >> Level;
+    const float* LevelData = HiZPyramid.data() + HiZLevelOffsets[Level];
 
-        BatchProjectionResult ProjectionResult = BatchProject4(Input);
+    for (int32 Y = PixelMinY >> Level; Y <= (PixelMaxY >> Level); ++Y)
+    {
+        const float* Row = LevelData + Y * LevelWidth;
+        for (int32 X = PixelMinX >> Level; X <= (PixelMaxX >> Level); ++X)
+        {
+            if (TestZ < Row[X])
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
 
-        // 멤버 배열에 저장
-        _mm_store_si128((__m128i*)TempPixelCoords[0], ProjectionResult.PixelX);
-        _mm_store_si128((__m128i*)TempPixelCoords[1], ProjectionResult.PixelY);
-        _mm_store_ps(TempScreenZ, ProjectionResult.ScreenZ);
+bool COcclusionCuller::IsRectVisibleMasked(int32 PixelMinX, int32 PixelMinY, int32 PixelMaxX, int32 PixelMaxY, float NearestZ) const
+{
+    constexpr float Z_TOLERANCE = 0.001f;
+    const float TestZ = NearestZ - Z_TOLERANCE;
+    const __m256i LaneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
 
-        for (int32 i = 0; i < 4; ++i)
+    for (int32 TileY = PixelMinY / MASKED_TILE_HEIGHT; TileY <= PixelMaxY / MASKED_TILE_HEIGHT; ++TileY)
+    {
+        // 사각형이 덮는 타일 내 행(Lane) 선택 마스크
+        const int32 TileOriginY = TileY * MASKED_TILE_HEIGHT;
+        const __m256i RowSelect = _mm256_andnot_si256(
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(PixelMinY - TileOriginY), LaneIndex),
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(PixelMaxY - TileOriginY + 1), LaneIndex));
+
+        const FMaskedOcclusionTile* Row = MaskedTiles.data() + TileY * MaskedTileCountX;
+        for (int32 TileX = PixelMinX / MASKED_TILE_WIDTH; TileX <= PixelMaxX / MASKED_TILE_WIDTH; ++TileX)
         {
-            int32 SampleIdx = BatchIdx * 4 + i;
-            if (SampleIdx >= 19) break;
+            const FMaskedOcclusionTile& Tile = Row[TileX];
+
+            // Reference Layer보다 뒤에 있으면 이 타일에서는 가려짐
+            if (TestZ >= Tile.ZMax0) { continue; }
 
-            int32 X = TempPixelCoords[0][i];  // PixelX
-            int32 Y = TempPixelCoords[1][i];  // PixelY
+            const int32 TileOriginX = TileX * MASKED_TILE_WIDTH;
+            const int32 FirstBit = max(PixelMinX - TileOriginX, 0);
+            const int32 LastBit = min(PixelMaxX - TileOriginX, MASKED_TILE_WIDTH - 1);
+            const uint32 ColumnBits = (0xFFFFFFFFu << FirstBit) & (0xFFFFFFFFu >> (MASKED_TILE_WIDTH - 1 - LastBit));
+            const __m256i RectMask = _mm256_and_si256(RowSelect, _mm256_set1_epi32(static_cast<int32>(ColumnBits)));
 
-            if (X >= 0 && X < Z_BUFFER_WIDTH && Y >= 0 && Y < Z_BUFFER_HEIGHT)
+            // Working Layer로 덮이지 않은 픽셀이 있으면 그 픽셀의 상한은 ZMax0 이므로 보임
+            const __m256i TileMask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Tile.Mask));
+            if (!_mm256_testc_si256(TileMask, RectMask) || TestZ < Tile.ZMax1)
             {
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-                if (TempScreenZ[i] < CPU_ZBuffer[Index] + Z_TOLERANCE)
-                {
-                    return true;
-                }
+                return true;
             }
         }
     }
@@ -289,8 +1135,8 @@ BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput
     // -----------------------------------------------------------
     // 4. NDC to Screen coordinates (4개 동시)
     // -----------------------------------------------------------
-    __m128 HalfWidth = _mm_set1_ps(Z_BUFFER_WIDTH * 0.5f);
-    __m128 HalfHeight = _mm_set1_ps(Z_BUFFER_HEIGHT * 0.5f);
+    __m128 HalfWidth = _mm_set1_ps(BufferWidth * 0.5f);
+    __m128 HalfHeight = _mm_set1_ps(BufferHeight * 0.5f);
 
     BatchProjectionResult Result;
     // X: (ClipX + 1.0) * 0.5 * Width
@@ -298,6 +1144,7 @@ BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput
     // Y: (1.0 - ClipY) * 0.5 * Height
     Result.ScreenY = _mm_mul_ps(_mm_sub_ps(Ones, ClipY), HalfHeight);
     Result.ScreenZ = ClipZ; // ScreenZ (NDC Z)
+    Result.ValidMask = W_is_positive;
 
     // 5. 정수형 픽셀 좌표로 변환
     // _mm_cvtps_epi32는 기본적으로 TRUNCATE (버림)을 수행
@@ -306,111 +1153,3 @@ BatchProjectionResult COcclusionCuller::BatchProject4(const BatchProjectionInput
 
     return Result;
 }
-
-void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer)
-{        
-    // 1. 바운딩 박스 계산
-    int32 MinX = max(0, (int32)min({ P1.X, P2.X, P3.X }));
-    int32 MaxX = min(Z_BUFFER_WIDTH - 1, (int32)max({ P1.X, P2.X, P3.X }));
-    int32 MinY = max(0, (int32)min({ P1.Y, P2.Y, P3.Y }));
-    int32 MaxY = min(Z_BUFFER_HEIGHT - 1, (int32)max({ P1.Y, P2.Y, P3.Y }));
-
-    // 3. 삼각형 면적 계산 (degenerate triangle 체크용)
-    float Area = 0.5f * abs((P2.X - P1.X) * (P3.Y - P1.Y) - (P3.X - P1.X) * (P2.Y - P1.Y));
-    if (Area < 0.001f) { return; }
-
-    // 4. Barycentric 좌표 계산을 위한 분모 미리 계산 (최적화)
-    float Denom1 = (P2.X - P3.X) * (P1.Y - P3.Y) - (P2.Y - P3.Y) * (P1.X - P3.X);
-    float Denom2 = (P3.X - P1.X) * (P2.Y - P1.Y) - (P3.Y - P1.Y) * (P2.X - P1.X);
-
-    // 5. 분모가 0에 가까우면 degenerate triangle
-    if (abs(Denom1) < 0.0001f || abs(Denom2) < 0.0001f) { return; }
-
-    // 6. 역수 미리 계산
-    float InvDenom1 = 1.0f / Denom1;
-    float InvDenom2 = 1.0f / Denom2;
-
-    // 7. 바운딩 박스 내의 모든 픽셀에 대해 검사
-    for (int32 Y = MinY; Y <= MaxY; ++Y)
-    {
-        for (int32 X = MinX; X <= MaxX; ++X)
-        {
-            // 픽셀 중심점
-            float PixelX = X + 0.5f;
-            float PixelY = Y + 0.5f;
-
-            // Barycentric coordinates 계산 (최적화된 버전)
-            float W1 = ((P2.X - P3.X) * (PixelY - P3.Y) - (P2.Y - P3.Y) * (PixelX - P3.X)) * InvDenom1;
-            float W2 = ((P3.X - P1.X) * (PixelY - P1.Y) - (P3.Y - P1.Y) * (PixelX - P1.X)) * InvDenom2;
-            float W3 = 1.0f - W1 - W2;
-
-            const float EPSILON = -0.0001f; // 경계 케이스 처리
-            if (W1 >= EPSILON && W2 >= EPSILON && W3 >= EPSILON)
-            {
-                // 깊이값 보간
-                float InterpolatedZ = W1 * P1.Z + W2 * P2.Z + W3 * P3.Z;
-
-                int32 Index = Y * Z_BUFFER_WIDTH + X;
-
-                // 깊이 테스트 및 업데이트
-                if (InterpolatedZ < ZBuffer[Index])
-                {
-                    ZBuffer[Index] = InterpolatedZ;
-                }
-            }
-        }
-    }
-}
-
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
-{
-    Triangles.clear();
-
-    if (!Prim) { return Triangles; }
-
-    FWorldAABBData& Data = CachedAABBs[Prim->CachedAABBIndex];
-    const FVector& WorldCenter = Data.Center;
-    FVector Extent = (Data.Min - Data.Max) * 0.5f;
-
-    constexpr float OccluderScale = 0.5f;
-
-    FVector WorldMin = WorldCenter - Extent * OccluderScale;
-    FVector WorldMax = WorldCenter + Extent * OccluderScale;
-
-    // AABB의 8개 정점 계산
-    FVector Vertices[8];
-    Vertices[0] = FVector(WorldMin.X, WorldMin.Y, WorldMin.Z); // 000
-    Vertices[1] = FVector(WorldMax.X, WorldMin.Y, WorldMin.Z); // 100
-    Vertices[2] = FVector(WorldMax.X, WorldMax.Y, WorldMin.Z); // 110
-    Vertices[3] = FVector(WorldMin.X, WorldMax.Y, WorldMin.Z); // 010
-    Vertices[4] = FVector(WorldMin.X, WorldMin.Y, WorldMax.Z); // 001
-    Vertices[5] = FVector(WorldMax.X, WorldMin.Y, WorldMax.Z); // 101
-    Vertices[6] = FVector(WorldMax.X, WorldMax.Y, WorldMax.Z); // 111
-    Vertices[7] = FVector(WorldMin.X, WorldMax.Y, WorldMax.Z); // 011
-
-    // Front face (Z = Min)
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[2]);
-    Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[3]);
-
-    // Back face (Z = Max)
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[7]);
-    Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[7]); Triangles.push_back(Vertices[6]);
-
-    // Left face (X = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[0]); Triangles.push_back(Vertices[3]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[7]);
-
-    // Right face (X = Max)
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[2]);
-
-    // Bottom face (Y = Min)
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[5]); Triangles.push_back(Vertices[1]);
-    Triangles.push_back(Vertices[4]); Triangles.push_back(Vertices[1]); Triangles.push_back(Vertices[0]);
-
-    // Top face (Y = Max)
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[2]); Triangles.push_back(Vertices[6]);
-    Triangles.push_back(Vertices[3]); Triangles.push_back(Vertices[6]); Triangles.push_back(Vertices[7]);
-
-    return Triangles;
-}
@@ -3,19 +3,139 @@
 #include "Core/Public/Object.h"
 #include "Global/Octree.h"
 
+#include <immintrin.h>
+
 namespace
 {
-	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
+	/**
+	 * @brief 비트 마스크에서 켜진 비트에 해당하는 프리미티브를 OutObjects에 추가
+	 */
+	void AppendVisiblePrimitives(const uint32* InVisibleMask, int32 InCount, const TArray<UPrimitiveComponent*>& InPrimitives,
+		TArray<TObjectPtr<UPrimitiveComponent>>& OutObjects)
+	{
+		for (int32 Word = 0; Word < (InCount + 31) / 32; ++Word)
+		{
+			uint32 Bits = InVisibleMask[Word];
+			while (Bits)
+			{
+				UPrimitiveComponent* Primitive = InPrimitives[Word * 32 + static_cast<int32>(_tzcnt_u32(Bits))];
+				if (Primitive) { OutObjects.push_back(TObjectPtr<UPrimitiveComponent>(Primitive)); }
+				Bits &= Bits - 1;
+			}
+		}
+	}
+}
+
+void FBoundsSoA::Resize(int32 InCount)
+{
+	Count = InCount;
+	const size_t PaddedCount = (static_cast<size_t>(InCount) + LANE_COUNT - 1) / LANE_COUNT * LANE_COUNT;
+
+	MinX.resize(PaddedCount);
+	MinY.resize(PaddedCount);
+	MinZ.resize(PaddedCount);
+	MaxX.resize(PaddedCount);
+	MaxY.resize(PaddedCount);
+	MaxZ.resize(PaddedCount);
+	Primitives.resize(PaddedCount);
+	Revisions.resize(PaddedCount);
+
+	// 패딩 영역은 0으로 두고, 결과 비트에서 Count 이후를 제거한다
+	for (size_t Index = InCount; Index < PaddedCount; ++Index)
+	{
+		Set(static_cast<int32>(Index), nullptr, FVector(), FVector());
+	}
+}
+
+void FBoundsSoA::Set(int32 Index, UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax)
+{
+	MinX[Index] = InMin.X;
+	MinY[Index] = InMin.Y;
+	MinZ[Index] = InMin.Z;
+	MaxX[Index] = InMax.X;
+	MaxY[Index] = InMax.Y;
+	MaxZ[Index] = InMax.Z;
+	Primitives[Index] = InPrimitive;
+	Revisions[Index] = InPrimitive ? InPrimitive->GetBoundsRevision() : 0;
+}
+
+void FBoundsSoA::Update(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	const int32 PreviousCount = Count;
+	Resize(static_cast<int32>(InPrimitives.size()));
+
+	for (int32 Index = 0; Index < Count; ++Index)
 	{
-		FVector Min, Max;
-		InPrimitive->GetWorldAABB(Min, Max);
+		UPrimitiveComponent* Primitive = InPrimitives[Index];
+		if (Index < PreviousCount && Primitives[Index] == Primitive &&
+			(!Primitive || Revisions[Index] == Primitive->GetBoundsRevision()))
+		{
+			continue;
+		}
 
-		return FAABB(Min, Max);
+		// nullptr은 어떤 평면에도 통과하지 못하는 뒤집힌 박스로 기록
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX), Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		if (Primitive) { Primitive->GetWorldAABB(Min, Max); }
+		Set(Index, Primitive, Min, Max);
 	}
 }
 
-void ViewVolumeCuller::Cull(FOctree* StaticOctree, TArray<UPrimitiveComponent*>& DynamicPrimitives, const FViewProjConstants& ViewProjConstants)
+void FFrustum::CheckIntersectionBatch(const FBoundsSoA& Bounds, int32 Begin, int32 End, uint32* OutVisibleMask, uint8 PlaneMask) const
 {
+	// 활성 평면마다 법선 부호에 따라 가장 "안쪽"(내적이 최소)인 코너의 축별 배열을 미리 선택
+	const float* ClosestX[6];
+	const float* ClosestY[6];
+	const float* ClosestZ[6];
+	__m256 PlaneX[6], PlaneY[6], PlaneZ[6], PlaneW[6];
+	int32 ActivePlaneCount = 0;
+	for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+	{
+		if ((PlaneMask & (1 << PlaneIndex)) == 0) { continue; }
+
+		const int32 i = ActivePlaneCount++;
+		const FVector4& P = Planes[PlaneIndex];
+		ClosestX[i] = P.X > 0 ? Bounds.MinX.data() : Bounds.MaxX.data();
+		ClosestY[i] = P.Y > 0 ? Bounds.MinY.data() : Bounds.MaxY.data();
+		ClosestZ[i] = P.Z > 0 ? Bounds.MinZ.data() : Bounds.MaxZ.data();
+		PlaneX[i] = _mm256_set1_ps(P.X);
+		PlaneY[i] = _mm256_set1_ps(P.Y);
+		PlaneZ[i] = _mm256_set1_ps(P.Z);
+		PlaneW[i] = _mm256_set1_ps(P.W);
+	}
+
+	const __m256 Zero = _mm256_setzero_ps();
+	const int32 PaddedEnd = min((End + FBoundsSoA::LANE_COUNT - 1) / FBoundsSoA::LANE_COUNT * FBoundsSoA::LANE_COUNT, Bounds.GetPaddedCount());
+
+	for (int32 Base = Begin; Base < PaddedEnd; Base += FBoundsSoA::LANE_COUNT)
+	{
+		// 한 평면이라도 가장 안쪽 코너가 바깥에 있으면 Outside
+		__m256 Outside = Zero;
+		for (int32 i = 0; i < ActivePlaneCount; ++i)
+		{
+			__m256 Distance = _mm256_fmadd_ps(PlaneX[i], _mm256_loadu_ps(ClosestX[i] + Base), PlaneW[i]);
+			Distance = _mm256_fmadd_ps(PlaneY[i], _mm256_loadu_ps(ClosestY[i] + Base), Distance);
+			Distance = _mm256_fmadd_ps(PlaneZ[i], _mm256_loadu_ps(ClosestZ[i] + Base), Distance);
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Distance, Zero, _CMP_GT_OQ));
+		}
+
+		uint32 VisibleBits = static_cast<uint32>(~_mm256_movemask_ps(Outside)) & 0xFFu;
+		const int32 ValidLanes = End - Base;
+		if (ValidLanes < FBoundsSoA::LANE_COUNT)
+		{
+			VisibleBits &= (1u << ValidLanes) - 1u;
+		}
+
+		const int32 Bit = Base - Begin;
+		if ((Bit & 31) == 0) { OutVisibleMask[Bit >> 5] = 0; }
+		OutVisibleMask[Bit >> 5] |= VisibleBits << (Bit & 31);
+	}
+}
+
+void ViewVolumeCuller::Cull(FOctree* StaticOctree, const TArray<UPrimitiveComponent*>& DynamicPrimitives, const FViewProjConstants& ViewProjConstants)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	Stats = FFrustumCullStats();
+
 	// 이전의 Cull했던 정보를 지운다.
 	RenderableObjects.clear();
 	CurrentFrustum.Clear();
@@ -46,12 +166,21 @@ void ViewVolumeCuller::Cull(FOctree* StaticOctree, TArray<UPrimitiveComponent*>&
 		CullOctree(StaticOctree);
 	}
 
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
+	const uint64 DynamicStartCycles = FPlatformTime::Cycles64();
+	CullPrimitiveList(DynamicPrimitives, DynamicBounds, VisibleMask);
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+
+	Stats.DynamicPrimitiveCount = static_cast<uint32>(DynamicPrimitives.size());
+	Stats.VisibleCount = static_cast<uint32>(RenderableObjects.size());
+	Stats.DynamicMilliseconds = FPlatformTime::ToMilliseconds(EndCycles - DynamicStartCycles);
+	Stats.TotalMilliseconds = FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+
+	if (bIsStatsReportRequested)
 	{
-		if (Primitive && CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
-		{
-			RenderableObjects.push_back(TObjectPtr<UPrimitiveComponent>(Primitive));
-		}
+		bIsStatsReportRequested = false;
+		UE_LOG_INFO("Frustum Cull: Dynamic %u prims %.3f ms | Octree nodes %u, prim tests %u, plane tests %u (coherency %s) | Visible %u | Total %.3f ms",
+			Stats.DynamicPrimitiveCount, Stats.DynamicMilliseconds, Stats.OctreeNodeCount, Stats.OctreePrimitiveTestCount,
+			Stats.OctreePlaneTestCount, bIsPlaneCoherencyEnabled ? "on" : "off", Stats.VisibleCount, Stats.TotalMilliseconds);
 	}
 }
 
@@ -60,21 +189,48 @@ const TArray<TObjectPtr<UPrimitiveComponent>>& ViewVolumeCuller::GetRenderableOb
 	return RenderableObjects;
 }
 
+void ViewVolumeCuller::CullPrimitiveList(const TArray<UPrimitiveComponent*>& Primitives, FBoundsSoA& Bounds, TArray<uint32>& Mask, uint8 PlaneMask)
+{
+	const int32 PrimitiveCount = static_cast<int32>(Primitives.size());
+	if (PrimitiveCount == 0) { return; }
+
+	// GetWorldAABB는 부모 Transform 캐시를 갱신할 수 있으므로 수집은 단일 스레드에서 수행
+	Bounds.Update(Primitives);
+
+	Mask.resize((PrimitiveCount + 31) / 32);
+	CurrentFrustum.CheckIntersectionBatch(Bounds, 0, PrimitiveCount, Mask.data(), PlaneMask);
+	AppendVisiblePrimitives(Mask.data(), PrimitiveCount, Bounds.Primitives, RenderableObjects);
+}
+
 void ViewVolumeCuller::CullOctree(FOctree* Octree)
 {
 	if (!Octree) { return; }
 
-	// 0. 탐색할 노드를 추가합니다.
-	TDeque<FOctree*> VisitngNodes;
-	VisitngNodes.push_back(Octree);
+	// 0. 탐색할 노드를 추가합니다. (루트는 6개 평면 모두 검사)
+	OctreeStack.clear();
+	OctreeStack.push_back({ Octree, FFrustum::ALL_PLANES_MASK });
 
-	while (VisitngNodes.empty() == false)
+	while (OctreeStack.empty() == false)
 	{
-		FOctree* CurrentNode = VisitngNodes.back();
-		VisitngNodes.pop_back();
+		const FOctreeCullEntry Entry = OctreeStack.back();
+		OctreeStack.pop_back();
+		FOctree* CurrentNode = Entry.Node;
+		++Stats.OctreeNodeCount;
 
 		// 현재 옥트리 노드(자신)의 경계와 절두체의 관계를 확인합니다.
-		EBoundCheckResult result = CurrentFrustum.CheckIntersection(CurrentNode->GetBoundingBox());
+		// 비교용으로 끈 경우, 마스크를 물려받지 않고 0번 평면부터 모두 검사합니다.
+		uint8 ActivePlaneMask = FFrustum::ALL_PLANES_MASK;
+		uint8 LastRejectPlane = 0;
+		if (bIsPlaneCoherencyEnabled)
+		{
+			ActivePlaneMask = Entry.ActivePlaneMask;
+			LastRejectPlane = CurrentNode->GetLastRejectPlane();
+		}
+
+		EBoundCheckResult result = CurrentFrustum.CheckIntersectionMasked(
+			CurrentNode->GetBoundingBox(), ActivePlaneMask, LastRejectPlane, Stats.OctreePlaneTestCount);
+
+		if (bIsPlaneCoherencyEnabled) { CurrentNode->SetLastRejectPlane(LastRejectPlane); }
 	
 		// Case 1. 노드가 절두체 밖에 있다면, 즉시 다음 노드로 넘어갑니다. 
 		if (result == EBoundCheckResult::Outside)
@@ -84,23 +240,21 @@ void ViewVolumeCuller::CullOctree(FOctree* Octree)
 		// Case 2. 노드가 절두체 안에 완전히 포함된다면, 전부 포함하고 다음 노드로 넘어갑니다.
 		else if (result == EBoundCheckResult::Inside)
 		{
-			TArray<UPrimitiveComponent*> Primitives;
-			CurrentNode->GetAllPrimitives(Primitives);
-			RenderableObjects.insert(RenderableObjects.end(), Primitives.begin(), Primitives.end());
+			AppendSubtree(CurrentNode);
 			continue;
 		}
 		// Case 3. 노드가 절두체와 부분적으로 겹쳐진다면, 개별 검사를 합니다.
 		else if (result == EBoundCheckResult::Intersect)
 		{
-			// 노드가 겹치면, 현재 노드에 있는 프리미티브들만 개별적으로 검사합니다.
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
-			{
-				if (Primitive && 
-					CurrentFrustum.CheckIntersection(GetPrimitiveBoundingBox(Primitive)) != EBoundCheckResult::Outside)
-				{
-					RenderableObjects.push_back(TObjectPtr<UPrimitiveComponent>(Primitive));
-				}
-			}
+			// 노드가 겹치면, 현재 노드에 있는 프리미티브들만 SoA로 모아 아직 걸쳐 있는 평면들에 대해 8개씩 검사합니다.
+			if (!bIsPlaneCoherencyEnabled) { ActivePlaneMask = FFrustum::ALL_PLANES_MASK; }
+			const TArray<UPrimitiveComponent*>& NodePrimitives = CurrentNode->GetPrimitives();
+			CullPrimitiveList(NodePrimitives, NodeBounds, NodeVisibleMask, ActivePlaneMask);
+
+			uint32 ActivePlaneCount = 0;
+			for (uint8 Bits = ActivePlaneMask; Bits; Bits &= Bits - 1) { ++ActivePlaneCount; }
+			Stats.OctreePrimitiveTestCount += static_cast<uint32>(NodePrimitives.size());
+			Stats.OctreePlaneTestCount += ActivePlaneCount * static_cast<uint32>(NodePrimitives.size());
 
 			// 2. 자식 노드들을 탐색 대상에 추가합니다.
 			if (CurrentNode->IsLeafNode() == false)
@@ -108,7 +262,7 @@ void ViewVolumeCuller::CullOctree(FOctree* Octree)
 				const TArray<FOctree*>& Children = CurrentNode->GetChildren();
 				for (FOctree* Child : Children)
 				{
-					if (Child != nullptr) { VisitngNodes.push_back(Child); }
+					if (Child != nullptr) { OctreeStack.push_back({ Child, ActivePlaneMask }); }
 				}
 			}
 
@@ -116,4 +270,17 @@ void ViewVolumeCuller::CullOctree(FOctree* Octree)
 
 	}
 
-}
\ No newline at end of file
+}
+
+void ViewVolumeCuller::AppendSubtree(const FOctree* Node)
+{
+	const TArray<UPrimitiveComponent*>& Primitives = Node->GetPrimitives();
+	RenderableObjects.insert(RenderableObjects.end(), Primitives.begin(), Primitives.end());
+
+	if (Node->IsLeafNode()) { return; }
+
+	for (const FOctree* Child : Node->GetChildren())
+	{
+		if (Child) { AppendSubtree(Child); }
+	}
+}
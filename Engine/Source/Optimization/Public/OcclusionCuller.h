@@ -1,9 +1,46 @@
 ﻿#pragma once
 
+class UPrimitiveComponent;
+
+/**
+ * @brief Screen Space로 투영된 오클루더 삼각형
+ * 래스터라이징에 필요한 Edge Function과 깊이 평면 계수를 Setup 단계에서 미리 계산해둔다
+ * Lambda(X, Y) = A * X + B * Y + C (면적으로 정규화된 Barycentric 좌표)
+ */
+struct FOccluderTriangle
+{
+    int32 MinX, MinY, MaxX, MaxY; // 화면에 클램프된 픽셀 바운딩 박스
+    float EdgeA[3];
+    float EdgeB[3];
+    float EdgeC[3];
+    float DepthA, DepthB, DepthC; // Z(X, Y) = DepthA * X + DepthB * Y + DepthC
+    float MinZ, MaxZ;             // 정점 깊이 범위
+};
+
+/**
+ * @brief Masked 버퍼의 32x8 타일
+ * Masked Occlusion Culling 방식으로, 깊이를 픽셀별로 저장하지 않고
+ * Reference Layer(ZMax0, 타일 전체의 보수적 최대 깊이)와 Working Layer(Mask로 덮인 픽셀들의 최대 깊이 ZMax1)만 유지한다
+ */
+struct FMaskedOcclusionTile
+{
+    uint32 Mask[8];   // 행(Y)별 32비트 Coverage (비트 i = 타일 내 X 오프셋 i)
+    float ZMax0;
+    float ZMax1;
+};
+
+/**
+ * @brief 타일별 래스터라이징 통계 (작업 분배 확인용)
+ */
+struct FOcclusionTileStats
+{
+    uint32 TriangleCount = 0;
+    double Milliseconds = 0.0;
+};
+
 /**
  * @brief Occlusion Culling 을 담당하는 클래스
  */
-class UPrimitiveComponent;
 
 class COcclusionCuller
 {
@@ -13,8 +50,13 @@ public:
     /**
      * @brief 컬링 프로세스를 위한 환경을 초기화하고 View/Projection 행렬을 설정.
      * 매 프레임 컬링을 시작하기 전에 호출되어야 함
+     * @param InBufferType 깊이 버퍼 형식 (Float: 256x256 고정, Masked: InMaskedWidth x InMaskedHeight)
+     * @param InMaskedWidth Masked 버퍼 가로 해상도 (32의 배수로 올림)
+     * @param InMaskedHeight Masked 버퍼 세로 해상도 (32의 배수로 올림)
      */
-    void InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix);
+    void InitializeCuller(const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix,
+        EOcclusionBufferType InBufferType = EOcclusionBufferType::Float,
+        int32 InMaskedWidth = DEFAULT_MASKED_BUFFER_WIDTH, int32 InMaskedHeight = DEFAULT_MASKED_BUFFER_HEIGHT);
 
      /**
      * @brief 오클루전 컬링의 전체 프로세스를 실행하고 최종 가시 오브젝트 목록을 반환
@@ -25,11 +67,68 @@ public:
     TArray<TObjectPtr<UPrimitiveComponent>> PerformCulling(const TArray<TObjectPtr<UPrimitiveComponent>>& AllStaticMeshes, const FVector& CameraPos);
 
     // Constants
+    static constexpr int DEFAULT_MASKED_BUFFER_WIDTH = 1024;
+    static constexpr int DEFAULT_MASKED_BUFFER_HEIGHT = 512;
     static constexpr int Z_BUFFER_WIDTH = 256;
     static constexpr int Z_BUFFER_HEIGHT = 256;
     static constexpr int Z_BUFFER_SIZE = Z_BUFFER_WIDTH * Z_BUFFER_HEIGHT;
 
+    // Binning Tile (SIMD 폭의 배수여야 함)
+    static constexpr int TILE_WIDTH = 32;
+    static constexpr int TILE_HEIGHT = 32;
+
+    // Masked 버퍼 타일 (Binning Tile 하나에 세로로 4개)
+    static constexpr int MASKED_TILE_WIDTH = 32;
+    static constexpr int MASKED_TILE_HEIGHT = 8;
+
+    // Temporal Reuse
+    static constexpr uint32 TEMPORAL_REBUILD_INTERVAL = 8;         // 카메라 이동 중 정적 버퍼를 다시 만드는 주기 (프레임)
+    static constexpr uint32 TEMPORAL_VISIBLE_RETEST_INTERVAL = 4;  // 지난 프레임에 보였던 오브젝트의 재검사 주기 (프레임)
+    static constexpr uint32 TEMPORAL_DYNAMIC_OCCLUDER_FRAMES = 60; // 움직인 오클루더를 Dynamic으로 취급하는 기간 (프레임)
+
+    // Hi-Z 피라미드 레벨 수 (256x256 -> 1x1)
+    static constexpr int HI_Z_LEVEL_COUNT = 9;
+
+    /**
+     * @brief 다음 컬링 프레임에서 타일별 삼각형 수와 래스터라이징 시간을 수집하여 로그로 출력
+     */
+    void RequestTileStatsReport() { bIsTileStatsRequested = true; }
+    const TArray<FOcclusionTileStats>& GetTileStats() const { return TileStats; }
+
+    /**
+     * @brief 시간적 재사용 모드
+     * 정적 오클루더로 만든 깊이 버퍼를 보관해두고, 카메라가 움직이면 재투영하여 시작 버퍼로 사용한다
+     * 매 프레임에는 움직인(Dynamic) 오클루더만 다시 래스터라이징하고, 지난 프레임에 가려졌던 오브젝트만 다시 테스트한다
+     * (보였던 오브젝트는 TEMPORAL_VISIBLE_RETEST_INTERVAL 프레임마다 나누어 재검사)
+     */
+    void SetTemporalEnabled(bool bInEnabled);
+    bool IsTemporalEnabled() const { return bIsTemporalEnabled; }
+
+    EOcclusionBufferType GetBufferType() const { return BufferType; }
+    int32 GetBufferWidth() const { return BufferWidth; }
+    int32 GetBufferHeight() const { return BufferHeight; }
+
 private:
+    /**
+     * @brief 버퍼 형식과 해상도가 바뀐 경우 Binning Tile 및 Masked 타일 배열을 다시 할당
+     */
+    void SetBufferFormat(EOcclusionBufferType InBufferType, int32 InMaskedWidth, int32 InMaskedHeight);
+
+    void ClearDepthBuffer();
+
+    /**
+     * @brief 시간적 재사용 모드의 컬링 (CachedAABBs가 채워진 뒤 호출)
+     * 정적 오클루더가 움직였거나, 카메라 이동 중 재구성 주기가 지났으면 정적 버퍼를 다시 만든다
+     */
+    TArray<TObjectPtr<UPrimitiveComponent>> PerformTemporalCulling(const FVector& CameraPos);
+
+    /**
+     * @brief 정적 깊이 버퍼를 현재 View로 재투영 (Float 버퍼 전용)
+     * 인접한 4개 픽셀 중심으로 이루어진 쿼드를 새 화면에 래스터라이징하며, 깊이는 네 정점 중 최대값을 사용 (보수적)
+     * 깊이 불연속(실루엣)에 걸친 쿼드와 빈 픽셀은 건너뛰어 가장 먼 깊이로 남긴다
+     */
+    void ReprojectStaticDepth();
+
     /**
     * @brief 카메라에서 과도하게 가까운 애들 제외
     * @param AllCandidates 가까운 곳의 Occluders 후보
@@ -37,46 +136,115 @@ private:
     */
     TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
 
+    /**
+     * @brief 오클루더 삼각형을 일괄 투영하고 타일로 Binning한 뒤, 타일 단위로 병렬 래스터라이징
+     */
     void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
 
     /**
-     * @brief World Pos > Clip Space > Screen Coordinate
-     * @return 스크린 좌표 (X, Y)와 NDC Depth (Z)를 담은 FVector
+     * @brief 모든 오클루더의 AABB 정점을 SoA 배열에 모아 SIMD로 한 번에 투영
+     */
+    void ProjectOccluderVertices(const TArray<UPrimitiveComponent*>& SelectedOccluders);
+
+    /**
+     * @brief 투영된 정점으로 삼각형을 Setup하고, 겹치는 타일의 Bin에 삼각형 인덱스를 추가
+     */
+    void SetupAndBinTriangles();
+
+    /**
+     * @brief CPU Z-Buffer로부터 각 texel이 하위 2x2 영역의 최대(가장 먼) 깊이를 갖는 Mip 피라미드를 구성
      */
-    FVector Project(const FVector& WorldPos) const;
+    void BuildHiZPyramid();
 
     /**
-     * @brief 해당 메시 컴포넌트가 Z-Buffer에 의해 가려지는지 테스트합니다.
-     * @return 바운딩 박스의 코너 중 하나라도 보이면 true를 반환합니다.
+     * @brief 해당 메시 컴포넌트가 Hi-Z 피라미드에 의해 가려지는지 테스트합니다.
+     * AABB를 한 번 투영한 스크린 사각형이 약 2x2 texel을 덮는 레벨에서, 가장 가까운 깊이를 texel의 최대 깊이와 비교
+     * @return 가려졌다고 확신할 수 없으면 true를 반환합니다. (보수적)
      */
     bool IsMeshVisible(const struct FWorldAABBData& AABBData);
 
+    /**
+     * @brief 스크린 사각형(픽셀 단위, 버퍼 내부로 클램프됨)이 Hi-Z 피라미드 기준으로 보이는지 테스트
+     */
+    bool IsRectVisibleHiZ(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY, float NearestZ) const;
+
+    /**
+     * @brief 스크린 사각형이 Masked 버퍼 기준으로 보이는지 테스트
+     * 타일의 ZMax0보다 가까우면서 Mask로 덮이지 않은 픽셀이 있거나, 덮인 픽셀의 ZMax1보다 가까우면 보임
+     */
+    bool IsRectVisibleMasked(int32 MinX, int32 MinY, int32 MaxX, int32 MaxY, float NearestZ) const;
+
     struct BatchProjectionResult BatchProject4(const struct BatchProjectionInput& Input) const;
 
 
     /**
-     * @brief CPU Z-Buffer에 삼각형을 래스터라이징, 깊이 테스트 수행
+     * @brief 한 타일에 Binning된 삼각형들을 4-wide SSE Edge Function으로 래스터라이징, 깊이 테스트 수행
+     * 타일끼리는 Z-Buffer 영역이 겹치지 않으므로 서로 다른 스레드에서 동시에 호출 가능
      */
-    void RasterizeTriangle(const FVector& P1, const FVector& P2, const FVector& P3, TArray<float>& ZBuffer);
+    void RasterizeTile(int32 TileIndex);
 
     /**
-     * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
+     * @brief 한 Binning Tile에 속한 32x8 Masked 타일들에 삼각형 Coverage를 AVX2로 계산하여 병합
+     * 행(Lane)마다 세 Edge의 X 구간을 구해 비트 마스크로 변환하고, Reference/Working Layer를 갱신한다
      */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
+    void RasterizeMaskedTile(int32 TileIndex);
+
+    void LogTileStats() const;
+
+    EOcclusionBufferType BufferType = EOcclusionBufferType::Float;
+    int32 BufferWidth = Z_BUFFER_WIDTH;
+    int32 BufferHeight = Z_BUFFER_HEIGHT;
+    int32 TileCountX = Z_BUFFER_WIDTH / TILE_WIDTH;
+    int32 TileCountY = Z_BUFFER_HEIGHT / TILE_HEIGHT;
 
     TArray<float> CPU_ZBuffer;
+    TArray<FMaskedOcclusionTile> MaskedTiles;
+    int32 MaskedTileCountX = 0;
+    TArray<float> HiZPyramid;                   // 모든 레벨을 하나의 배열에 연속 저장
+    int32 HiZLevelOffsets[HI_Z_LEVEL_COUNT];
     FMatrix CurrentViewProj;
 
     TArray<struct FWorldAABBData> CachedAABBs;
-    TArray<FVector> Triangles;
+
+    // Binned Rasterizer
+    TArray<float> OccluderVertexX;      // 오클루더 AABB 정점 (SoA, 오클루더당 8개)
+    TArray<float> OccluderVertexY;
+    TArray<float> OccluderVertexZ;
+    TArray<float> ProjectedX;           // 투영된 정점의 스크린 좌표
+    TArray<float> ProjectedY;
+    TArray<float> ProjectedZ;
+    TArray<uint8> ProjectedValid;       // W > 0 (Near Plane 앞) 여부
+    TArray<FOccluderTriangle> ScreenTriangles;
+    TArray<TArray<int32>> TileBins;
+    TArray<FOcclusionTileStats> TileStats;
+    bool bIsTileStatsRequested = false;
+    bool bIsCollectingTileStats = false;
     TArray<UPrimitiveComponent*> FilteredOccluders;    
     TArray<TObjectPtr<UPrimitiveComponent>> VisibleMeshComponents;
     uint32 Frame = 0;
 
-    // For SIMD
-    alignas(16) float SampleCoords[3][20];     // [0]=X, [1]=Y, [2]=Z
-    alignas(16) int32 TempPixelCoords[2][4];   // [0]=X, [1]=Y  
-    alignas(16) float TempScreenZ[4];
+    // Temporal Reuse
+    struct FOccluderSnapshot
+    {
+        FVector Min;
+        FVector Max;
+    };
+
+    bool bIsTemporalEnabled = false;
+    bool bHasTemporalHistory = false;
+    uint32 StaticBuildFrame = 0;
+    FMatrix StaticViewProj;
+    TArray<float> StaticZBuffer;
+    TArray<FMaskedOcclusionTile> StaticMaskedTiles;
+    TMap<UPrimitiveComponent*, FOccluderSnapshot> StaticOccluders;  // 정적 버퍼에 래스터라이징된 오클루더 (비교용, 역참조하지 않음)
+    TSet<UPrimitiveComponent*> DynamicOccluders;                     // 매 프레임 다시 래스터라이징할 오클루더
+    TMap<UPrimitiveComponent*, uint32> OccluderMovedFrames;          // 오클루더가 마지막으로 움직인 프레임
+    TSet<UPrimitiveComponent*> PreviousVisibleComponents;
+    TSet<UPrimitiveComponent*> NextVisibleComponents;
+    TArray<float> ReprojectedX;
+    TArray<float> ReprojectedY;
+    TArray<float> ReprojectedZ;
+    TArray<float> ReprojectedW;
 };
 
 struct FWorldAABBData
@@ -97,4 +265,5 @@ struct alignas(16) BatchProjectionResult
     __m128 ScreenX, ScreenY, ScreenZ; // 4개 점의 스크린 좌표
     __m128i PixelX, PixelY;          // 정수형 픽셀 좌표
     __m128 InBoundsMask;             // 화면 경계 내부 마스크
+    __m128 ValidMask;                // W > 0 (Near Plane 앞) 마스크
 };
@@ -5,6 +5,49 @@
 
 class FOctree;
 
+/**
+ * @brief 프러스텀 컬링용 월드 AABB의 SoA(Structure of Arrays) 미러
+ * AVX 8-wide 테스트를 위해 배열 길이는 항상 8의 배수로 패딩된다
+ * Revisions에 수집 당시의 UPrimitiveComponent::GetBoundsRevision() 값을 보관하여, 움직인 프리미티브만 다시 수집한다
+ */
+struct FBoundsSoA
+{
+	static constexpr int32 LANE_COUNT = 8;
+
+	TArray<float> MinX, MinY, MinZ;
+	TArray<float> MaxX, MaxY, MaxZ;
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<uint64> Revisions;
+	int32 Count = 0;
+
+	/**
+	 * @brief 길이를 InCount로 맞춘다 (기존 항목은 유지, 패딩 영역은 0)
+	 */
+	void Resize(int32 InCount);
+	void Set(int32 Index, UPrimitiveComponent* InPrimitive, const FVector& InMin, const FVector& InMax);
+
+	/**
+	 * @brief InPrimitives와 미러를 동기화하고, 프리미티브가 바뀌었거나 Transform이 갱신된 항목만 월드 AABB를 다시 수집
+	 */
+	void Update(const TArray<UPrimitiveComponent*>& InPrimitives);
+	int32 GetPaddedCount() const { return static_cast<int32>(MinX.size()); }
+};
+
+/**
+ * @brief 프러스텀 컬링 통계 (stat frustum)
+ */
+struct FFrustumCullStats
+{
+	uint32 DynamicPrimitiveCount = 0;
+	uint32 OctreeNodeCount = 0;
+	uint32 OctreePrimitiveTestCount = 0;
+	// 옥트리 노드 및 노드 프리미티브에 대해 수행한 평면-박스 테스트 수
+	uint32 OctreePlaneTestCount = 0;
+	uint32 VisibleCount = 0;
+	double DynamicMilliseconds = 0.0;
+	double TotalMilliseconds = 0.0;
+};
+
 enum class EBoundCheckResult
 {
 	Outside,
@@ -14,6 +57,8 @@ enum class EBoundCheckResult
 
 struct FFrustum
 {
+    static constexpr uint8 ALL_PLANES_MASK = 0x3F;
+
     FVector4 Planes[6];
 
     EBoundCheckResult CheckIntersection(const FAABB& BBox) const
@@ -52,6 +97,57 @@ struct FFrustum
         return Result;
     }
 
+    /**
+     * @brief 활성 평면 마스크와 평면 일관성(Plane Coherency)을 사용하는 CheckIntersection
+     * @param InOutActivePlaneMask 검사할 평면 비트. 박스가 완전히 안쪽에 있는 평면의 비트는 제거되어 자식에게 전달된다
+     * @param InOutLastRejectPlane 이전에 이 박스를 거절한 평면. 가장 먼저 검사하며, 다른 평면이 거절하면 갱신된다
+     * @param OutPlaneTestCount 수행한 평면 테스트 수를 누적
+     */
+    EBoundCheckResult CheckIntersectionMasked(const FAABB& BBox, uint8& InOutActivePlaneMask, uint8& InOutLastRejectPlane, uint32& OutPlaneTestCount) const
+    {
+        for (int Order = 0; Order < 6; ++Order)
+        {
+            // 0번째는 마지막 거절 평면, 이후는 그 평면을 건너뛴 나머지 순서
+            const int i = Order == 0 ? InOutLastRejectPlane : (Order - 1 < InOutLastRejectPlane ? Order - 1 : Order);
+            const uint8 PlaneBit = static_cast<uint8>(1 << i);
+            if ((InOutActivePlaneMask & PlaneBit) == 0) { continue; }
+
+            ++OutPlaneTestCount;
+            const FVector4& P = Planes[i];
+
+            FVector Closest(
+                P.X > 0 ? BBox.Min.X : BBox.Max.X,
+                P.Y > 0 ? BBox.Min.Y : BBox.Max.Y,
+                P.Z > 0 ? BBox.Min.Z : BBox.Max.Z
+            );
+
+            if (P.Dot3(Closest) + P.W > 0)
+            {
+                InOutLastRejectPlane = static_cast<uint8>(i);
+                return EBoundCheckResult::Outside;
+            }
+
+            FVector Farthest(
+                P.X > 0 ? BBox.Max.X : BBox.Min.X,
+                P.Y > 0 ? BBox.Max.Y : BBox.Min.Y,
+                P.Z > 0 ? BBox.Max.Z : BBox.Min.Z
+            );
+
+            if (P.Dot3(Farthest) + P.W < 0)
+            {
+                InOutActivePlaneMask &= static_cast<uint8>(~PlaneBit);
+            }
+        }
+
+        return InOutActivePlaneMask == 0 ? EBoundCheckResult::Inside : EBoundCheckResult::Intersect;
+    }
+
+    /**
+     * @brief SoA 배열의 [Begin, End) 범위 박스를 AVX로 8개씩 PlaneMask의 평면들에 대해 테스트하여 보이는 박스의 비트를 기록
+     * Begin은 32의 배수여야 하며, OutVisibleMask[Begin / 32]부터 32개 단위 워드에 기록된다 (Count 이후의 패딩 비트는 0)
+     */
+    void CheckIntersectionBatch(const FBoundsSoA& Bounds, int32 Begin, int32 End, uint32* OutVisibleMask, uint8 PlaneMask = ALL_PLANES_MASK) const;
+
     void Clear() { for (int i = 0; i < 6; ++i) { Planes[i] = FVector4::Zero(); }; }
 };
 
@@ -65,14 +161,56 @@ public:
 
 	void Cull(
         FOctree* StaticOctree,
-        TArray<UPrimitiveComponent*>& DynamicPrimitives,
+        const TArray<UPrimitiveComponent*>& DynamicPrimitives,
 		const FViewProjConstants& ViewProjConstants
 	);
 
 	const TArray<TObjectPtr<UPrimitiveComponent>>& GetRenderableObjects() const;
+	const FFrustumCullStats& GetStats() const { return Stats; }
+
+	/**
+	 * @brief 다음 Cull 호출에서 컬링 통계를 로그로 출력
+	 */
+	static void RequestStatsReport() { bIsStatsReportRequested = true; }
+
+	/**
+	 * @brief 옥트리 탐색 시 활성 평면 마스크/평면 일관성 사용 여부 (끄면 모든 노드를 6개 평면으로 검사, 비교용)
+	 */
+	static void SetPlaneCoherencyEnabled(bool bInEnabled) { bIsPlaneCoherencyEnabled = bInEnabled; }
+	static bool IsPlaneCoherencyEnabled() { return bIsPlaneCoherencyEnabled; }
+
 private:
     void CullOctree(FOctree* Octree);
 
+	/**
+	 * @brief 절두체 안에 완전히 포함된 서브트리의 프리미티브를 임시 배열 없이 RenderableObjects에 바로 추가
+	 */
+	void AppendSubtree(const FOctree* Node);
+
+	/**
+	 * @brief Primitives를 SoA 미러 Bounds와 동기화한 뒤 8-wide로 테스트하여 보이는 것만 RenderableObjects에 추가
+	 * Dynamic Primitive 전체(프레임 간 유지되는 미러)와, 부분적으로 겹치는 옥트리 노드의 프리미티브에 사용된다
+	 */
+	void CullPrimitiveList(const TArray<UPrimitiveComponent*>& Primitives, FBoundsSoA& Bounds, TArray<uint32>& Mask,
+		uint8 PlaneMask = FFrustum::ALL_PLANES_MASK);
+
+	// 옥트리 탐색 스택 항목 (노드와, 부모에서 물려받은 활성 평면 마스크)
+	struct FOctreeCullEntry
+	{
+		FOctree* Node;
+		uint8 ActivePlaneMask;
+	};
+
     FFrustum CurrentFrustum{};
     TArray<TObjectPtr<UPrimitiveComponent>> RenderableObjects{};
+
+	FBoundsSoA DynamicBounds;
+	FBoundsSoA NodeBounds;
+	TArray<uint32> VisibleMask;
+	TArray<uint32> NodeVisibleMask;
+	TArray<FOctreeCullEntry> OctreeStack;
+	FFrustumCullStats Stats;
+
+	static inline bool bIsStatsReportRequested = false;
+	static inline bool bIsPlaneCoherencyEnabled = true;
 };
\ No newline at end of file
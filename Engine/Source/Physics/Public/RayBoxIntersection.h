@@ -0,0 +1,86 @@
+#pragma once
+#include "Global/CoreTypes.h"
+#include "Global/Vector.h"
+
+/**
+ * @brief BVH, QBVH, SceneBVH가 공유하는 Ray-AABB 슬랩 테스트와 바운드 계산
+ * 순회 루프 안에서 호출되므로 모두 inline으로 둔다
+ */
+
+// 순회 중 반복 사용되는 Ray 정보 (축마다 역방향을 미리 계산)
+struct FRayTraversalData
+{
+	float Origin[3];
+	float InverseDirection[3];
+	bool bIsParallel[3];
+};
+
+inline FRayTraversalData MakeRayTraversalData(const FRay& Ray)
+{
+	FRayTraversalData Data;
+	const float Origin[3] = { Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z };
+	const float Direction[3] = { Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z };
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Data.Origin[Axis] = Origin[Axis];
+		Data.bIsParallel[Axis] = fabs(Direction[Axis]) < MATH_EPSILON;
+		Data.InverseDirection[Axis] = Data.bIsParallel[Axis] ? 0.0f : 1.0f / Direction[Axis];
+	}
+	return Data;
+}
+
+/**
+ * @brief Slab Method로 [InMinT, InMaxT] 구간 안에서 Ray가 Box에 들어가는 거리를 계산 (CheckIntersectionRayBox와 같은 판정)
+ */
+inline bool GetRayBoxEntry(const FRayTraversalData& Ray, const float BoxMin[3], const float BoxMax[3], float InMinT, float InMaxT, float& OutEntryT)
+{
+	float TMin = InMinT;
+	float TMax = InMaxT;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Ray.bIsParallel[Axis])
+		{
+			if (Ray.Origin[Axis] < BoxMin[Axis] || Ray.Origin[Axis] > BoxMax[Axis]) { return false; }
+			continue;
+		}
+
+		float T1 = (BoxMin[Axis] - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+		float T2 = (BoxMax[Axis] - Ray.Origin[Axis]) * Ray.InverseDirection[Axis];
+		if (T1 > T2) { std::swap(T1, T2); }
+
+		TMin = max(TMin, T1);
+		TMax = min(TMax, T2);
+		if (TMax < TMin) { return false; }
+	}
+
+	OutEntryT = TMin;
+	return true;
+}
+
+inline bool GetRayBoxEntry(const FRayTraversalData& Ray, const FVector& InMin, const FVector& InMax, float InMinT, float InMaxT, float& OutEntryT)
+{
+	const float BoxMin[3] = { InMin.X, InMin.Y, InMin.Z };
+	const float BoxMax[3] = { InMax.X, InMax.Y, InMax.Z };
+	return GetRayBoxEntry(Ray, BoxMin, BoxMax, InMinT, InMaxT, OutEntryT);
+}
+
+inline void GrowBounds(FVector& InOutMin, FVector& InOutMax, const FVector& InMin, const FVector& InMax)
+{
+	InOutMin = FVector(min(InOutMin.X, InMin.X), min(InOutMin.Y, InMin.Y), min(InOutMin.Z, InMin.Z));
+	InOutMax = FVector(max(InOutMax.X, InMax.X), max(InOutMax.Y, InMax.Y), max(InOutMax.Z, InMax.Z));
+}
+
+inline float GetSurfaceArea(const FVector& InMin, const FVector& InMax)
+{
+	const FVector Extent = InMax - InMin;
+	return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+}
+
+// 노드처럼 float[3]로 바운드를 저장하는 구조용
+inline float GetSurfaceArea(const float InMin[3], const float InMax[3])
+{
+	const float ExtentX = InMax[0] - InMin[0];
+	const float ExtentY = InMax[1] - InMin[1];
+	const float ExtentZ = InMax[2] - InMin[2];
+	return 2.f * (ExtentX * ExtentY + ExtentY * ExtentZ + ExtentZ * ExtentX);
+}
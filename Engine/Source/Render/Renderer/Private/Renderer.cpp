@@ -29,6 +29,7 @@ void URenderer::Init(HWND InWindowHandle)
 	DeviceResources = new UDeviceResources(InWindowHandle);
 	Pipeline = new UPipeline(GetDeviceContext());
 	ViewportClient = new FViewport();
+	OcclusionCuller = new COcclusionCuller();
 
 	// 렌더링 상태 및 리소스 생성
 	CreateRasterizerState();
@@ -57,6 +58,7 @@ void URenderer::Release()
 	ReleaseBlendState();
 	ReleaseRasterizerState();
 
+	SafeDelete(OcclusionCuller);
 	SafeDelete(ViewportClient);
 	SafeDelete(FontRenderer);
 	SafeDelete(Pipeline);
@@ -219,10 +221,10 @@ void URenderer::RenderLevel(UCamera* InCurrentCamera)
 
 	// 오클루전 컬링 수행
 	TIME_PROFILE(Occlusion)
-	static COcclusionCuller Culler;
 	const FViewProjConstants& ViewProj = InCurrentCamera->GetFViewProjConstants();
-	Culler.InitializeCuller(ViewProj.View, ViewProj.Projection);
-	TArray<TObjectPtr<UPrimitiveComponent>> FinalVisiblePrims = Culler.PerformCulling(
+	OcclusionCuller->InitializeCuller(ViewProj.View, ViewProj.Projection,
+		OcclusionBufferType, OcclusionMaskedWidth, OcclusionMaskedHeight);
+	TArray<TObjectPtr<UPrimitiveComponent>> FinalVisiblePrims = OcclusionCuller->PerformCulling(
 		InCurrentCamera->GetViewVolumeCuller().GetRenderableObjects(),
 		InCurrentCamera->GetLocation()
 	);
@@ -500,7 +502,7 @@ void URenderer::RenderPrimitiveDefault(UPrimitiveComponent* InPrimitiveComp, ID3
     
 	Pipeline->SetVertexBuffer(InPrimitiveComp->GetVertexBuffer(), Stride);
 
-	if (InPrimitiveComp->GetIndexBuffer() && InPrimitiveComp->GetIndicesData())
+	if (InPrimitiveComp->GetIndexBuffer() && !InPrimitiveComp->GetIndicesData().empty())
 	{
 		Pipeline->SetIndexBuffer(InPrimitiveComp->GetIndexBuffer(), 0);
 		Pipeline->DrawIndexed(InPrimitiveComp->GetNumIndices(), 0, 0);
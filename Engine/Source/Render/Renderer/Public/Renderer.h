@@ -18,6 +18,7 @@ class UFontRenderer;
 class FViewport;
 class UCamera;
 class UPipeline;
+class COcclusionCuller;
 
 /**
  * @brief Rendering Pipeline 전반을 처리하는 클래스
@@ -116,6 +117,8 @@ public:
 	UDeviceResources* GetDeviceResources() const { return DeviceResources; }
 	FViewport* GetViewportClient() const { return ViewportClient; }
 	UPipeline* GetPipeline() const { return Pipeline; }
+	COcclusionCuller* GetOcclusionCuller() const { return OcclusionCuller; }
+	EOcclusionBufferType GetOcclusionBufferType() const { return OcclusionBufferType; }
 	bool GetIsResizing() const { return bIsResizing; }
 
 	ID3D11RasterizerState* GetRasterizerState(const FRenderState& InRenderState);
@@ -126,11 +129,21 @@ public:
 	ID3D11Buffer* GetConstantBufferViewProj() const { return ConstantBufferViewProj; }
 
 	void SetIsResizing(bool isResizing) { bIsResizing = isResizing; }
+	void SetOcclusionBufferType(EOcclusionBufferType InType, int32 InMaskedWidth, int32 InMaskedHeight)
+	{
+		OcclusionBufferType = InType;
+		OcclusionMaskedWidth = InMaskedWidth;
+		OcclusionMaskedHeight = InMaskedHeight;
+	}
 
 private:
 	UPipeline* Pipeline = nullptr;
 	UDeviceResources* DeviceResources = nullptr;
 	UFontRenderer* FontRenderer = nullptr;
+	COcclusionCuller* OcclusionCuller = nullptr;
+	EOcclusionBufferType OcclusionBufferType = EOcclusionBufferType::Float;
+	int32 OcclusionMaskedWidth = 1024;
+	int32 OcclusionMaskedHeight = 512;
 	TArray<UPrimitiveComponent*> PrimitiveComponents;
 
 	// States
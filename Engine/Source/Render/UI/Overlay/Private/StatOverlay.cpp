@@ -3,6 +3,8 @@
 #include "Global/Types.h"
 #include "Manager/Time/Public/TimeManager.h"
 #include "Global/Memory.h"
+#include "Global/ObjectPool.h"
+#include "Global/AllocationTracker.h"
 #include "Render/Renderer/Public/Renderer.h"
 
 IMPLEMENT_SINGLETON_CLASS_BASE(UStatOverlay)
@@ -113,14 +115,34 @@ void UStatOverlay::RenderFPS(ID2D1DeviceContext* D2DCtx)
 
 void UStatOverlay::RenderMemory(ID2D1DeviceContext* d2dCtx)
 {
-    float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+    constexpr float MEGA_BYTES = 1024.0f * 1024.0f;
 
-    char Buf[64];
-    sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+    const FAllocationStats TotalStats = FAllocationTracker::GetTotalStats();
+    float MemoryMB = static_cast<float>(TotalStats.CurrentBytes) / MEGA_BYTES;
+    float PeakMB = static_cast<float>(TotalStats.PeakBytes) / MEGA_BYTES;
+
+    // UObject는 전역 힙이 아닌 슬랩 풀에서 할당되므로 따로 표시
+    const FObjectPoolAllocator::FStats PoolStats = FObjectPoolAllocator::GetStats();
+
+    char Buf[128];
+    sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%lld allocs, Peak %.1f MB), UObject Pool: %u objects", MemoryMB,
+        TotalStats.CurrentCount, PeakMB, PoolStats.ObjectCount);
     FString text = Buf;
 
     float OffsetY = IsStatEnabled(EStatType::FPS) ? 20.0f : 0.0f;
     RenderText(d2dCtx, text, OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 0.0f);
+
+    // 태그별 사용량
+    FString TagText;
+    for (int32 Tag = 0; Tag < static_cast<int32>(EAllocationTag::Count); ++Tag)
+    {
+        const FAllocationStats TagStats = FAllocationTracker::GetStats(static_cast<EAllocationTag>(Tag));
+        sprintf_s(Buf, sizeof(Buf), "%s%s %.1f", TagText.empty() ? "" : " | ", FAllocationTracker::GetTagName(static_cast<EAllocationTag>(Tag)),
+            static_cast<float>(TagStats.CurrentBytes) / MEGA_BYTES);
+        TagText += Buf;
+    }
+    TagText += " MB";
+    RenderText(d2dCtx, TagText, OverlayX, OverlayY + OffsetY + 20.0f, 1.0f, 1.0f, 0.0f);
 }
 
 void UStatOverlay::RenderPicking(ID2D1DeviceContext* D2DCtx)
@@ -134,7 +156,7 @@ void UStatOverlay::RenderPicking(ID2D1DeviceContext* D2DCtx)
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
 
     float r = 0.0f, g = 1.0f, b = 0.8f;
     if (LastPickingTimeMs > 5.0f) { r = 1.0f; g = 0.0f; b = 0.0f; }
@@ -149,7 +171,7 @@ void UStatOverlay::RenderTimeInfo(ID2D1DeviceContext* D2DCtx)
 
     float OffsetY = 0.0f;
     if (IsStatEnabled(EStatType::FPS))    OffsetY += 20.0f;
-    if (IsStatEnabled(EStatType::Memory)) OffsetY += 20.0f;
+    if (IsStatEnabled(EStatType::Memory)) OffsetY += 40.0f;
     if (IsStatEnabled(EStatType::Picking)) OffsetY += 20.0f;
 
     float CurrentY = OverlayY + OffsetY;
@@ -2,6 +2,24 @@
 #include "Render/UI/Widget/Public/ConsoleWidget.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/UELogParser.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Optimization/Public/OcclusionCuller.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Global/LinearOctree.h"
+#include "Global/SceneBVH.h"
+#include "Level/Public/Level.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Public/BillBoardComponent.h"
+#include "Component/Public/UUIDTextComponent.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Texture/Public/Material.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Editor/Public/EditorEngine.h"
+#include "Editor/Public/Editor.h"
+#include "Editor/Public/Viewport.h"
+#include "Utility/Public/Benchmark.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
 
@@ -65,6 +83,9 @@ streamsize ConsoleStreamBuffer::xsputn(const char* InString, streamsize InCount)
 
 void UConsoleWidget::RenderWidget()
 {
+	// 지난 프레임 이후 추가된 로그를 옮긴다
+	FlushPendingLogs();
+
 	// 제어 버튼들
 	if (ImGui::Button("Clear"))
 	{
@@ -155,6 +176,35 @@ void UConsoleWidget::Update()
 void UConsoleWidget::ClearLog()
 {
 	LogItems.clear();
+
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	PendingLogItems.clear();
+}
+
+/**
+ * @brief 로그를 대기 목록에 추가 (어느 스레드에서든 호출 가능)
+ */
+void UConsoleWidget::EnqueueLog(FLogEntry&& InLogEntry)
+{
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	PendingLogItems.push_back(std::move(InLogEntry));
+}
+
+/**
+ * @brief 대기 중인 로그를 LogItems로 옮김 (메인 스레드 전용)
+ */
+void UConsoleWidget::FlushPendingLogs()
+{
+	{
+		std::lock_guard<std::mutex> Lock(LogMutex);
+		if (PendingLogItems.empty()) { return; }
+
+		LogItems.insert(LogItems.end(), std::make_move_iterator(PendingLogItems.begin()), std::make_move_iterator(PendingLogItems.end()));
+		PendingLogItems.clear();
+	}
+
+	// Auto Scroll
+	bIsScrollToBottom = true;
 }
 
 /**
@@ -246,10 +296,7 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	LogEntry.Message = FString(Buffer);
 	delete[] Buffer;
 
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	EnqueueLog(std::move(LogEntry));
 }
 
 /**
@@ -283,10 +330,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 		LogEntry.Message.pop_back();
 	}
 
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	EnqueueLog(std::move(LogEntry));
 }
 
 /**
@@ -390,8 +434,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry LogEntry;
 				LogEntry.Type = ELogType::UELog;
 				LogEntry.Message = FString(Result.FormattedMessage);
-				LogItems.push_back(LogEntry);
-				bIsScrollToBottom = true;
+				EnqueueLog(std::move(LogEntry));
 			}
 			else
 			{
@@ -399,8 +442,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry ErrorEntry;
 				ErrorEntry.Type = ELogType::Error;
 				ErrorEntry.Message = "UELogParser: UE_LOG 파싱 오류: " + FString(Result.ErrorMessage);
-				LogItems.push_back(ErrorEntry);
-				bIsScrollToBottom = true;
+				EnqueueLog(std::move(ErrorEntry));
 			}
 		}
 		catch (const std::exception& e)
@@ -408,16 +450,14 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 예외 발생: " + FString(e.what());
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			EnqueueLog(std::move(ErrorEntry));
 		}
 		catch (...)
 		{
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 알 수 없는 오류가 발생했습니다.";
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			EnqueueLog(std::move(ErrorEntry));
 		}
 	}
 
@@ -438,6 +478,54 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// Occlusion 버퍼 형식 변경
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 10 && CommandLower.substr(0, 10) == "occlusion ")
+	{
+		HandleOcclusionCommand(CommandLower.substr(10));
+	}
+
+	// Frustum 컬링 옵션 변경
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 8 && CommandLower.substr(0, 8) == "frustum ")
+	{
+		HandleFrustumCommand(CommandLower.substr(8));
+	}
+
+	// Octree 관련 명령
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 7 && CommandLower.substr(0, 7) == "octree ")
+	{
+		HandleOctreeCommand(CommandLower.substr(7));
+	}
+
+	// BVH 관련 명령
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 4 && CommandLower.substr(0, 4) == "bvh ")
+	{
+		HandleBVHCommand(CommandLower.substr(4));
+	}
+
+	// Static Mesh 관련 명령
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 5 && CommandLower.substr(0, 5) == "mesh ")
+	{
+		HandleMeshCommand(CommandLower.substr(5));
+	}
+
+	// UObject 관련 명령
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 7 && CommandLower.substr(0, 7) == "object ")
+	{
+		HandleObjectCommand(CommandLower.substr(7));
+	}
+
 	// Help 명령어 입력
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -448,8 +536,32 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  HELP - Show This Help");
 		AddLog(ELogType::Info, "  STAT FPS - Show FPS overlay");
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
+		AddLog(ELogType::Info, "  STAT MEMORYDUMP - Print current/peak allocation per tag (Asset, Level, Render, UI, ObjectPool)");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
+		AddLog(ELogType::Info, "  STAT OCCLUSION - Report occlusion tile triangle counts and timings");
+		AddLog(ELogType::Info, "  STAT FRUSTUM - Report frustum cull primitive counts and timings");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  OCCLUSION FLOAT - Use 256x256 float occlusion depth buffer");
+		AddLog(ELogType::Info, "  OCCLUSION MASKED [Width Height] - Use masked coverage occlusion buffer (default 1024x512)");
+		AddLog(ELogType::Info, "  OCCLUSION TEMPORAL [ON|OFF] - Reuse occlusion depth and visibility across frames");
+		AddLog(ELogType::Info, "  FRUSTUM COHERENCY [ON|OFF] - Use plane masks and plane coherency in octree frustum culling");
+		AddLog(ELogType::Info, "  OCTREE BENCH [Count] - Compare FOctree and linear octree build/query/edit times on level primitives (or Count seeded cubes, e.g. 50000 / 500000)");
+		AddLog(ELogType::Info, "  OCTREE CHECK - Verify that a primitive which lost its octree owner record leaves no stale entry after moving and removal");
+		AddLog(ELogType::Info, "  OCTREE LOOSE <Factor> - Rebuild the level octree as a loose octree (1 = tight)");
+		AddLog(ELogType::Info, "  OCTREE STATS - Show octree depth/occupancy histogram");
+		AddLog(ELogType::Info, "  BVH BENCH - Compare incremental and binned SAH BVH build time/cost for loaded meshes");
+		AddLog(ELogType::Info, "  BVH PICK - Report triangle tests per pick (all candidates vs closest hit) for loaded meshes");
+		AddLog(ELogType::Info, "  BVH LAYOUT - Compare BVH node memory per triangle and ray traversal time (FNode vs compact node)");
+		AddLog(ELogType::Info, "  BVH QBVH - Compare closest-hit pick time of binary BVH and 4-wide SSE QBVH for loaded meshes");
+		AddLog(ELogType::Info, "  BVH SCENE - Compare octree candidate picking and ordered scene BVH queries on level primitives");
+		AddLog(ELogType::Info, "  BVH RAYS [Count] [LevelPath] - Fire rays from every viewport (optionally at a saved level) and report picking rays/sec");
+		AddLog(ELogType::Info, "  MESH LOADBENCH [Count] - Compare .objbin load time (element-wise/bulk, unbuffered/buffered) for the largest loaded meshes");
+		AddLog(ELogType::Info, "  MESH OBJBENCH [Count] - Report .obj read and parse throughput (MB/s) for the largest loaded meshes");
+		AddLog(ELogType::Info, "  OBJECT CASTBENCH [Count] - Compare IsA/Cast throughput (legacy super chain vs class tree range) over level components (default 100000)");
+		AddLog(ELogType::Info, "  OBJECT ITERBENCH - Compare TObjectIterator cost (full object array scan vs per-class object lists)");
+		AddLog(ELogType::Info, "  OBJECT POOLBENCH [Count] - Compare spawn/destroy and iteration cost (global heap vs UObject slab pool) per component type (default 10000)");
+		AddLog(ELogType::Info, "  OBJECT POOLSTATS - Print UObject slab pool usage per size class");
+		AddLog(ELogType::Info, "  OBJECT NAMEBENCH [Count] - Compare FName construction and unique name cost (lowercase copy + string maps vs hashed table) (default 100000)");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -489,6 +601,10 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowMemory(true);
 		AddLog(ELogType::Success, "Memory overlay enabled");
 	}
+	else if (StatCommand == "memorydump")
+	{
+		FAllocationTracker::DumpStats();
+	}
 	else if (StatCommand == "pick" || StatCommand == "picking")
 	{
 		StatOverlay.ShowPicking(true);
@@ -499,6 +615,19 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowTime(true);
 		AddLog(ELogType::Success, "Time overlay enabled");
 	}
+	else if (StatCommand == "occlusion")
+	{
+		if (COcclusionCuller* OcclusionCuller = URenderer::GetInstance().GetOcclusionCuller())
+		{
+			OcclusionCuller->RequestTileStatsReport();
+			AddLog(ELogType::Success, "Occlusion tile stats will be reported on the next frame");
+		}
+	}
+	else if (StatCommand == "frustum")
+	{
+		ViewVolumeCuller::RequestStatsReport();
+		AddLog(ELogType::Success, "Frustum cull stats will be reported on the next frame");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll(true);
@@ -512,10 +641,373 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.c_str());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, none");
+		AddLog(ELogType::Info, "Available: fps, memory, memorydump, pick, occlusion, frustum, none");
+	}
+}
+
+void UConsoleWidget::HandleOcclusionCommand(const FString& OcclusionCommand)
+{
+	std::istringstream Stream(OcclusionCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "float")
+	{
+		URenderer::GetInstance().SetOcclusionBufferType(EOcclusionBufferType::Float,
+			COcclusionCuller::DEFAULT_MASKED_BUFFER_WIDTH, COcclusionCuller::DEFAULT_MASKED_BUFFER_HEIGHT);
+		AddLog(ELogType::Success, "Occlusion buffer: Float %dx%d",
+			COcclusionCuller::Z_BUFFER_WIDTH, COcclusionCuller::Z_BUFFER_HEIGHT);
+	}
+	else if (Mode == "masked")
+	{
+		int32 Width = COcclusionCuller::DEFAULT_MASKED_BUFFER_WIDTH;
+		int32 Height = COcclusionCuller::DEFAULT_MASKED_BUFFER_HEIGHT;
+		if (Stream >> Width >> Height)
+		{
+			Width = std::clamp(Width, 32, 4096);
+			Height = std::clamp(Height, 32, 4096);
+		}
+		else
+		{
+			Width = COcclusionCuller::DEFAULT_MASKED_BUFFER_WIDTH;
+			Height = COcclusionCuller::DEFAULT_MASKED_BUFFER_HEIGHT;
+		}
+
+		URenderer::GetInstance().SetOcclusionBufferType(EOcclusionBufferType::Masked, Width, Height);
+		AddLog(ELogType::Success, "Occlusion buffer: Masked %dx%d", Width, Height);
+	}
+	else if (Mode == "temporal")
+	{
+		FString Toggle;
+		Stream >> Toggle;
+		if (COcclusionCuller* OcclusionCuller = URenderer::GetInstance().GetOcclusionCuller())
+		{
+			const bool bEnable = Toggle.empty() ? !OcclusionCuller->IsTemporalEnabled() : Toggle == "on";
+			OcclusionCuller->SetTemporalEnabled(bEnable);
+			AddLog(ELogType::Success, "Occlusion temporal reuse %s", bEnable ? "enabled" : "disabled");
+		}
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown occlusion command: %s", OcclusionCommand.c_str());
+		AddLog(ELogType::Info, "Available: float, masked [Width Height], temporal [on|off]");
+	}
+}
+
+void UConsoleWidget::HandleFrustumCommand(const FString& FrustumCommand)
+{
+	std::istringstream Stream(FrustumCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "coherency")
+	{
+		FString Toggle;
+		Stream >> Toggle;
+		const bool bEnable = Toggle.empty() ? !ViewVolumeCuller::IsPlaneCoherencyEnabled() : Toggle == "on";
+		ViewVolumeCuller::SetPlaneCoherencyEnabled(bEnable);
+		AddLog(ELogType::Success, "Frustum plane coherency %s", bEnable ? "enabled" : "disabled");
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown frustum command: %s", FrustumCommand.c_str());
+		AddLog(ELogType::Info, "Available: coherency [on|off]");
+	}
+}
+
+void UConsoleWidget::HandleOctreeCommand(const FString& OctreeCommand)
+{
+	std::istringstream Stream(OctreeCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "bench")
+	{
+		// 개수를 주면 레벨 대신 고정 시드로 생성한 큐브로 측정
+		const int32 SyntheticCount = FBenchmark::ReadCount(Stream, 0);
+		if (SyntheticCount > 0)
+		{
+			RunSyntheticOctreeBenchmark(SyntheticCount);
+			return;
+		}
+
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		FOctree* StaticOctree = CurrentLevel ? CurrentLevel->GetStaticOctree() : nullptr;
+		if (!StaticOctree)
+		{
+			AddLog(ELogType::Error, "Octree bench: no level octree");
+			return;
+		}
+
+		TArray<UPrimitiveComponent*> Primitives;
+		StaticOctree->GetAllPrimitives(Primitives);
+		const TArray<UPrimitiveComponent*>& DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
+		Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+
+		RunOctreeBenchmark(Primitives, StaticOctree->GetBoundingBox());
+	}
+	else if (Mode == "check")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		FOctree* StaticOctree = CurrentLevel ? CurrentLevel->GetStaticOctree() : nullptr;
+		if (!StaticOctree)
+		{
+			AddLog(ELogType::Error, "Octree check: no level octree");
+			return;
+		}
+
+		TArray<UPrimitiveComponent*> Primitives;
+		StaticOctree->GetAllPrimitives(Primitives);
+
+		RunOctreeOwnerCheck(Primitives, StaticOctree->GetBoundingBox());
+	}
+	else if (Mode == "loose")
+	{
+		float Looseness = 0.0f;
+		if (!(Stream >> Looseness) || Looseness < 1.0f)
+		{
+			AddLog(ELogType::Error, "Usage: octree loose <Factor>  (Factor >= 1, 1 = tight octree)");
+			return;
+		}
+
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "Octree loose: no level");
+			return;
+		}
+
+		CurrentLevel->RebuildStaticOctree(Looseness);
+		AddLog(ELogType::Success, "Static octree rebuilt with looseness %.2f", Looseness);
+	}
+	else if (Mode == "stats")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		FOctree* StaticOctree = CurrentLevel ? CurrentLevel->GetStaticOctree() : nullptr;
+		if (!StaticOctree)
+		{
+			AddLog(ELogType::Error, "Octree stats: no level octree");
+			return;
+		}
+
+		FOctreeStats Stats;
+		StaticOctree->GatherStats(Stats);
+
+		AddLog(ELogType::System, "Octree Stats (looseness %.2f, dynamic %zu)", StaticOctree->GetLooseness(), CurrentLevel->GetDynamicPrimitives().size());
+		AddLog(ELogType::Info, "  Depth  Nodes  Leaves  Primitives  Interior  MaxPerNode");
+		for (int Depth = 0; Depth <= MAX_DEPTH; ++Depth)
+		{
+			const FOctreeStats::FDepthStats& DepthStats = Stats.Depths[Depth];
+			if (DepthStats.NodeCount == 0) { continue; }
+
+			AddLog(ELogType::Info, "  %5d  %5u  %6u  %10u  %8u  %10u", Depth, DepthStats.NodeCount, DepthStats.LeafCount,
+				DepthStats.PrimitiveCount, DepthStats.InteriorPrimitiveCount, DepthStats.MaxNodePrimitiveCount);
+		}
+
+		AddLog(ELogType::Info, "  Primitives per node (node count):");
+		for (int Bucket = 0; Bucket < FOctreeStats::OCCUPANCY_BUCKET_COUNT; ++Bucket)
+		{
+			uint32 NodeCount = 0;
+			for (int Depth = 0; Depth <= MAX_DEPTH; ++Depth) { NodeCount += Stats.Depths[Depth].OccupancyBuckets[Bucket]; }
+			AddLog(ELogType::Info, "    %-7s %u", FOctreeStats::GetOccupancyBucketName(Bucket), NodeCount);
+		}
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown octree command: %s", OctreeCommand.c_str());
+		AddLog(ELogType::Info, "Available: bench [Count], check, loose <Factor>, stats");
 	}
 }
 
+void UConsoleWidget::HandleBVHCommand(const FString& BVHCommand)
+{
+	std::istringstream Stream(BVHCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "bench")
+	{
+		RunLoadedMeshBenchmark("BVH bench", 0, &RunBVHBuildBenchmark);
+	}
+	else if (Mode == "pick")
+	{
+		RunLoadedMeshBenchmark("BVH pick", 0, &RunBVHPickBenchmark);
+	}
+	else if (Mode == "layout")
+	{
+		RunLoadedMeshBenchmark("BVH layout", 0, &RunBVHLayoutBenchmark);
+	}
+	else if (Mode == "qbvh")
+	{
+		RunLoadedMeshBenchmark("BVH qbvh", 0, &RunQBVHPickBenchmark);
+	}
+	else if (Mode == "scene")
+	{
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel || !CurrentLevel->GetStaticOctree())
+		{
+			AddLog(ELogType::Error, "BVH scene: no level octree");
+			return;
+		}
+
+		RunSceneBVHBenchmark(CurrentLevel);
+	}
+	else if (Mode == "rays")
+	{
+		const int32 RayCount = FBenchmark::ReadCount(Stream, 100000);
+
+		FString LevelPath;
+		if (Stream >> LevelPath && !GEditor->LoadLevel(LevelPath))
+		{
+			AddLog(ELogType::Error, "BVH rays: failed to load level %s", LevelPath.c_str());
+			return;
+		}
+
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel || !CurrentLevel->GetStaticOctree())
+		{
+			AddLog(ELogType::Error, "BVH rays: no level octree");
+			return;
+		}
+
+		TArray<UCamera*> Cameras;
+		for (FViewportClient& ViewportClient : URenderer::GetInstance().GetViewportClient()->GetViewports())
+		{
+			Cameras.push_back(&ViewportClient.Camera);
+		}
+
+		RunPickRayBenchmark(GEditor->GetEditorModule()->GetObjectPicker(), Cameras, CurrentLevel, RayCount);
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown bvh command: %s", BVHCommand.c_str());
+		AddLog(ELogType::Info, "Available: bench, pick, layout, qbvh, scene, rays");
+	}
+}
+
+void UConsoleWidget::HandleMeshCommand(const FString& MeshCommand)
+{
+	std::istringstream Stream(MeshCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "loadbench")
+	{
+		RunLoadedMeshBenchmark("Mesh loadbench", FBenchmark::ReadCount(Stream, 3), &RunCookedMeshLoadBenchmark);
+	}
+	else if (Mode == "objbench")
+	{
+		RunLoadedMeshBenchmark("Mesh objbench", FBenchmark::ReadCount(Stream, 3), [](FStaticMesh* InStaticMesh)
+		{
+			RunObjImportBenchmark(InStaticMesh->PathFileName.ToString());
+		});
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown mesh command: %s", MeshCommand.c_str());
+		AddLog(ELogType::Info, "Available: loadbench, objbench");
+	}
+}
+
+void UConsoleWidget::HandleObjectCommand(const FString& ObjectCommand)
+{
+	std::istringstream Stream(ObjectCommand);
+	FString Mode;
+	Stream >> Mode;
+
+	if (Mode == "castbench")
+	{
+		const int32 ObjectCount = FBenchmark::ReadCount(Stream, 100000);
+
+		ULevel* CurrentLevel = GWorld ? GWorld->GetLevel() : nullptr;
+		if (!CurrentLevel)
+		{
+			AddLog(ELogType::Error, "Object castbench: no level");
+			return;
+		}
+
+		TArray<UObject*> Components;
+		for (const TObjectPtr<AActor>& Actor : CurrentLevel->GetLevelActors())
+		{
+			if (!Actor) { continue; }
+			for (const TObjectPtr<UActorComponent>& Component : Actor->GetOwnedComponents())
+			{
+				if (Component) { Components.push_back(Component.Get()); }
+			}
+		}
+		if (Components.empty())
+		{
+			AddLog(ELogType::Warning, "Object castbench: no component in level");
+			return;
+		}
+
+		// 레벨의 컴포넌트를 반복해 ObjectCount개로 채운 뒤, URenderer::RenderLevel과 같은 순서로 분기
+		TArray<UObject*> Objects;
+		Objects.reserve(ObjectCount);
+		for (int32 Index = 0; Index < ObjectCount; ++Index)
+		{
+			Objects.push_back(Components[Index % Components.size()]);
+		}
+
+		RunCastBenchmark(Objects, { UStaticMeshComponent::StaticClass(), UBillBoardComponent::StaticClass(),
+			UUUIDTextComponent::StaticClass(), UTextComponent::StaticClass() });
+	}
+	else if (Mode == "iterbench")
+	{
+		// UStaticMeshComponentWidget이 매 프레임 순회하는 클래스와, 하위 트리 순회를 확인할 상위 클래스
+		RunObjectIteratorBenchmark({ UStaticMesh::StaticClass(), UMaterial::StaticClass(), UStaticMeshComponent::StaticClass(),
+			UActorComponent::StaticClass() });
+	}
+	else if (Mode == "poolbench")
+	{
+		const int32 ObjectCount = FBenchmark::ReadCount(Stream, 10000);
+
+		// 액터 하나가 생성하는 컴포넌트 종류를 번갈아 할당 (첫 번째 종류를 순회 대상으로 사용)
+		RunObjectPoolBenchmark({ sizeof(UStaticMeshComponent), sizeof(UUUIDTextComponent), sizeof(UBillBoardComponent), sizeof(AActor) },
+			ObjectCount);
+	}
+	else if (Mode == "poolstats")
+	{
+		FObjectPoolAllocator::DumpStats();
+	}
+	else if (Mode == "namebench")
+	{
+		RunNameBenchmark(FBenchmark::ReadCount(Stream, 100000));
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown object command: %s", ObjectCommand.c_str());
+		AddLog(ELogType::Info, "Available: castbench, iterbench, poolbench, poolstats, namebench");
+	}
+}
+
+/**
+ * @brief 로드된 Static Mesh마다 벤치마크를 실행
+ * @param InCommandName 경고 로그에 표시할 명령 이름
+ * @param InMaxMeshCount 0보다 크면 버텍스가 많은 메시부터 이 개수만 실행
+ */
+void UConsoleWidget::RunLoadedMeshBenchmark(const char* InCommandName, int32 InMaxMeshCount, const TFunction<void(FStaticMesh*)>& InBenchmark)
+{
+	TArray<FStaticMesh*> StaticMeshes;
+	FObjManager::GetLoadedStaticMeshAssets(StaticMeshes);
+	if (StaticMeshes.empty())
+	{
+		AddLog(ELogType::Warning, "%s: no static mesh loaded", InCommandName);
+		return;
+	}
+
+	if (InMaxMeshCount > 0)
+	{
+		std::sort(StaticMeshes.begin(), StaticMeshes.end(), [](const FStaticMesh* A, const FStaticMesh* B)
+		{
+			return A->Vertices.size() > B->Vertices.size();
+		});
+		StaticMeshes.resize(std::min(StaticMeshes.size(), static_cast<size_t>(InMaxMeshCount)));
+	}
+
+	for (FStaticMesh* StaticMesh : StaticMeshes) { InBenchmark(StaticMesh); }
+}
+
 /**
  * @brief 실제 터미널 명령어를 실행하고 결과를 콘솔에 표시하는 함수
  * @param InCommand 실행할 터미널 명령어
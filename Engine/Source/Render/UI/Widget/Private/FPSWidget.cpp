@@ -4,6 +4,7 @@
 #include "Manager/Time/Public/TimeManager.h"
 
 #include "Manager/Config/Public/ConfigManager.h"
+#include "Global/ObjectPool.h"
 
 constexpr float REFRESH_INTERVAL = 0.1f;
 
@@ -79,8 +80,21 @@ void UFPSWidget::RenderWidget()
 	if (bShowGraph)
 	{
 		ImGui::Text("동적 할당된 메모리 정보");
-		ImGui::Text("Overall Object Count: %u", TotalAllocationCount);
-		ImGui::Text("Overall Memory: %.3f KB", static_cast<float>(TotalAllocationBytes) / KILO);
+		const FAllocationStats TotalStats = FAllocationTracker::GetTotalStats();
+		ImGui::Text("Overall Object Count: %lld", TotalStats.CurrentCount);
+		ImGui::Text("Overall Memory: %.3f KB (Peak %.3f KB)", static_cast<float>(TotalStats.CurrentBytes) / KILO,
+			static_cast<float>(TotalStats.PeakBytes) / KILO);
+		for (int32 Tag = 0; Tag < static_cast<int32>(EAllocationTag::Count); ++Tag)
+		{
+			const FAllocationStats TagStats = FAllocationTracker::GetStats(static_cast<EAllocationTag>(Tag));
+			ImGui::Text("  %s: %.3f KB, %lld (Peak %.3f KB)", FAllocationTracker::GetTagName(static_cast<EAllocationTag>(Tag)),
+				static_cast<float>(TagStats.CurrentBytes) / KILO, TagStats.CurrentCount, static_cast<float>(TagStats.PeakBytes) / KILO);
+		}
+
+		const FObjectPoolAllocator::FStats PoolStats = FObjectPoolAllocator::GetStats();
+		ImGui::Text("UObject Pool Object Count: %u", PoolStats.ObjectCount);
+		ImGui::Text("UObject Pool Memory: %.3f / %.3f KB (%u slabs)", static_cast<float>(PoolStats.UsedBytes) / KILO,
+			static_cast<float>(PoolStats.SlabBytes) / KILO, PoolStats.SlabCount);
 		ImGui::Separator();
 
 		ImGui::Text("Frame Time History:");
@@ -22,8 +22,10 @@ void UTargetActorTransformWidget::Update()
 	// TODO(KHJ): 적절한 위치를 찾을 것
 	ULevel* CurrentLevel = GWorld->GetLevel();
 
-	LevelMemoryByte = CurrentLevel->GetAllocatedBytes();
-	LevelObjectCount = CurrentLevel->GetAllocatedCount();
+	// Level 태그로 집계된 할당 (레벨 로드, Actor Spawn, 레벨 Tick)
+	const FAllocationStats LevelStats = FAllocationTracker::GetStats(EAllocationTag::Level);
+	LevelMemoryByte = static_cast<uint64>(std::max<int64>(LevelStats.CurrentBytes, 0));
+	LevelObjectCount = static_cast<uint32>(std::max<int64>(LevelStats.CurrentCount, 0));
 
 	if (CurrentLevel)
 	{
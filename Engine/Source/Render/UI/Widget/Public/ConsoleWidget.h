@@ -1,10 +1,13 @@
 #pragma once
 #include "Widget.h"
 
+#include <mutex>
+
 using std::streambuf;
 
 class UConsoleWidget;
 struct ImGuiInputTextCallbackData;
+struct FStaticMesh;
 
 struct FLogEntry
 {
@@ -60,6 +63,13 @@ public:
 	// Console command
 	void ProcessCommand(const char* InCommand);
 	void HandleStatCommand(const FString& StatCommand);
+	void HandleOcclusionCommand(const FString& OcclusionCommand);
+	void HandleFrustumCommand(const FString& FrustumCommand);
+	void HandleOctreeCommand(const FString& OctreeCommand);
+	void HandleBVHCommand(const FString& BVHCommand);
+	void HandleMeshCommand(const FString& MeshCommand);
+	void HandleObjectCommand(const FString& ObjectCommand);
+	void RunLoadedMeshBenchmark(const char* InCommandName, int32 InMaxMeshCount, const TFunction<void(FStaticMesh*)>& InBenchmark);
 	void ExecuteTerminalCommand(const char* InCommand);
 
 	// Use external terminal
@@ -77,7 +87,11 @@ private:
 	int HistoryPosition;
 
 	// Log output
+	// LogItems와 bIsScrollToBottom은 메인 스레드에서만 접근하며, Worker 스레드를 포함한 모든 로그 추가는
+	// LogMutex로 보호되는 PendingLogItems에 쌓았다가 RenderWidget에서 옮긴다
 	TArray<FLogEntry> LogItems;
+	TArray<FLogEntry> PendingLogItems;
+	std::mutex LogMutex;
 	bool bIsAutoScroll;
 	bool bIsScrollToBottom;
 
@@ -91,4 +105,6 @@ private:
 	static ImVec4 GetColorByLogType(ELogType InType);
 
 	void AddLogInternal(ELogType InType, const char* fmt, va_list InArguments);
+	void EnqueueLog(FLogEntry&& InLogEntry);
+	void FlushPendingLogs();
 };
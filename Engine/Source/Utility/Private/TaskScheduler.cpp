@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "Utility/Public/TaskScheduler.h"
+
+namespace
+{
+	// ParallelFor 작업을 수행 중인 스레드인지 여부 (중첩 호출 시 순차 처리를 위해 사용)
+	thread_local bool bIsInsideParallelFor = false;
+}
+
+FTaskScheduler& FTaskScheduler::GetInstance()
+{
+	static FTaskScheduler Instance;
+	return Instance;
+}
+
+FTaskScheduler::FTaskScheduler()
+{
+	const uint32 HardwareThreads = std::thread::hardware_concurrency();
+	const uint32 WorkerCount = HardwareThreads > 1 ? HardwareThreads - 1 : 0;
+
+	Workers.reserve(WorkerCount);
+	for (uint32 Index = 0; Index < WorkerCount; ++Index)
+	{
+		Workers.emplace_back(&FTaskScheduler::WorkerLoop, this);
+	}
+}
+
+FTaskScheduler::~FTaskScheduler()
+{
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		bIsShuttingDown = true;
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable()) { Worker.join(); }
+	}
+	Workers.clear();
+}
+
+void FTaskScheduler::ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody)
+{
+	if (InCount <= 0) { return; }
+
+	// 작업이 하나뿐이거나, Worker가 없거나, 이미 ParallelFor 내부에서 호출된 경우 순차 처리
+	if (InCount == 1 || Workers.empty() || bIsInsideParallelFor)
+	{
+		for (int32 Index = 0; Index < InCount; ++Index) { InBody(Index); }
+		return;
+	}
+
+	// 다른 스레드가 Worker를 사용 중이라면 기다리지 않고 순차 처리
+	std::unique_lock<std::mutex> DispatchLock(DispatchMutex, std::try_to_lock);
+	if (!DispatchLock.owns_lock())
+	{
+		for (int32 Index = 0; Index < InCount; ++Index) { InBody(Index); }
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(JobMutex);
+		CurrentBody = &InBody;
+		CurrentTag = FAllocationTracker::GetCurrentTag();
+		JobCount = InCount;
+		NextIndex.store(0);
+		PendingWorkers = static_cast<int32>(Workers.size());
+		++JobGeneration;
+	}
+	WakeCondition.notify_all();
+
+	// 호출 스레드도 작업에 참여
+	RunCurrentJob();
+
+	std::unique_lock<std::mutex> Lock(JobMutex);
+	DoneCondition.wait(Lock, [this]() { return PendingWorkers == 0; });
+	CurrentBody = nullptr;
+	JobCount = 0;
+}
+
+void FTaskScheduler::WorkerLoop()
+{
+	uint64 SeenGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(JobMutex);
+			WakeCondition.wait(Lock, [this, SeenGeneration]() { return bIsShuttingDown || JobGeneration != SeenGeneration; });
+
+			if (bIsShuttingDown) { return; }
+			SeenGeneration = JobGeneration;
+		}
+
+		RunCurrentJob();
+
+		{
+			std::lock_guard<std::mutex> Lock(JobMutex);
+			if (--PendingWorkers == 0) { DoneCondition.notify_one(); }
+		}
+	}
+}
+
+void FTaskScheduler::RunCurrentJob()
+{
+	bIsInsideParallelFor = true;
+	FScopedAllocationTag ScopedTag(CurrentTag);
+
+	for (int32 Index = NextIndex.fetch_add(1); Index < JobCount; Index = NextIndex.fetch_add(1))
+	{
+		(*CurrentBody)(Index);
+	}
+
+	bIsInsideParallelFor = false;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "Utility/Public/ScopeCycleCounter.h"
+
+#include <istream>
+
+/**
+ * @brief Run*Benchmark 함수와 콘솔 벤치마크 명령이 공유하는 시간 측정 / 인자 처리
+ */
+struct FBenchmark
+{
+	// 반복 측정 횟수 기본값
+	static constexpr int32 DEFAULT_REPEAT_COUNT = 5;
+
+	/**
+	 * @brief InBody를 한 번 실행한 시간 (ms)
+	 */
+	template<typename FunctionType>
+	static double MeasureOnce(FunctionType&& InBody)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		InBody();
+		return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	/**
+	 * @brief InBody를 InRepeatCount번 실행한 시간 중 최솟값 (ms, 캐시/스케줄링 잡음 제거용)
+	 */
+	template<typename FunctionType>
+	static double MeasureBest(FunctionType&& InBody, int32 InRepeatCount = DEFAULT_REPEAT_COUNT)
+	{
+		double BestMs = DBL_MAX;
+		for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			BestMs = min(BestMs, MeasureOnce(InBody));
+		}
+		return BestMs;
+	}
+
+	/**
+	 * @brief InBody를 InRepeatCount번 실행한 평균 시간 (ms)
+	 */
+	template<typename FunctionType>
+	static double MeasureAverage(FunctionType&& InBody, int32 InRepeatCount = DEFAULT_REPEAT_COUNT)
+	{
+		double TotalMs = 0.0;
+		for (int32 Repeat = 0; Repeat < InRepeatCount; ++Repeat)
+		{
+			TotalMs += MeasureOnce(InBody);
+		}
+		return TotalMs / max(InRepeatCount, 1);
+	}
+
+	/**
+	 * @brief 콘솔 인자에서 개수를 읽음
+	 * @return 인자가 없거나 0 이하면 InDefaultCount
+	 */
+	static int32 ReadCount(std::istream& InStream, int32 InDefaultCount)
+	{
+		int32 Count = 0;
+		if (!(InStream >> Count) || Count <= 0) { return InDefaultCount; }
+		return Count;
+	}
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+/**
+ * @brief CPU 병렬 처리를 위한 Worker Thread Pool
+ * 엔진 시작 시 (코어 수 - 1)개의 Worker를 생성해두고, ParallelFor 호출 시 호출 스레드도 함께 작업을 나누어 처리한다
+ * 한 번에 하나의 ParallelFor만 Worker에 분배되며, 중첩 호출이나 동시 호출은 호출 스레드에서 순차 처리된다
+ */
+class FTaskScheduler
+{
+public:
+	static FTaskScheduler& GetInstance();
+
+	/**
+	 * @brief [0, InCount) 범위의 인덱스를 Worker들에 분배하여 InBody를 실행하고, 모든 작업이 끝날 때까지 대기
+	 * @param InCount 작업 개수
+	 * @param InBody 각 인덱스에 대해 실행할 함수 (서로 다른 인덱스는 동시에 실행될 수 있음)
+	 */
+	void ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody);
+
+	// 호출 스레드를 포함한 동시 실행 가능 스레드 수
+	int32 GetThreadCount() const { return static_cast<int32>(Workers.size()) + 1; }
+
+	FTaskScheduler(const FTaskScheduler&) = delete;
+	FTaskScheduler& operator=(const FTaskScheduler&) = delete;
+
+private:
+	FTaskScheduler();
+	~FTaskScheduler();
+
+	void WorkerLoop();
+	void RunCurrentJob();
+
+	TArray<std::thread> Workers;
+
+	// Dispatch 직렬화 (동시에 두 스레드가 ParallelFor를 호출하는 경우)
+	std::mutex DispatchMutex;
+
+	// Worker 깨우기 및 완료 대기
+	std::mutex JobMutex;
+	std::condition_variable WakeCondition;
+	std::condition_variable DoneCondition;
+
+	const TFunction<void(int32)>* CurrentBody = nullptr;
+	// Worker도 호출 스레드의 할당 태그로 집계
+	EAllocationTag CurrentTag = EAllocationTag::Default;
+	int32 JobCount = 0;
+	std::atomic<int32> NextIndex = 0;
+	int32 PendingWorkers = 0;
+	uint64 JobGeneration = 0;
+	bool bIsShuttingDown = false;
+};